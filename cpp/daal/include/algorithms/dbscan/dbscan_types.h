@@ -54,7 +54,9 @@ const int undefined = -2;
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method */
+    defaultDense = 0, /*!< Default: performance-oriented method */
+    kdTreeDense  = 1  /*!< Method that uses k-d tree to answer neighborhood queries.
+                           Available in the batch processing mode and on the step6Local of the distributed processing mode */
 };
 
 /**
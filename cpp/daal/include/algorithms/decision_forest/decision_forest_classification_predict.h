@@ -53,7 +53,8 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense  = 0, /*!< Default method */
+    compiledDense = 1  /*!< Blocks of observations are evaluated on the compact breadth-first layout of the trees built once for the model */
 };
 
 /**
@@ -0,0 +1,107 @@
+/* file: decision_forest_regression_row_predictor.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for decision forest regression prediction of a single observation
+//--
+*/
+
+#ifndef __DECISION_FOREST_REGRESSION_ROW_PREDICTOR_H__
+#define __DECISION_FOREST_REGRESSION_ROW_PREDICTOR_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/decision_forest/decision_forest_regression_model.h"
+#include "algorithms/decision_forest/decision_forest_regression_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace regression
+{
+namespace prediction
+{
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * @ingroup decision_forest_regression_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__REGRESSION__PREDICTION__ROWPREDICTOR"></a>
+ * \brief Predicts decision forest regression results for one observation at a time.
+ *        The model is compiled once by prepare(), then every call of predict() runs in the calling thread
+ *        on the raw array of the feature values without numeric tables, input validation and threading.
+ *        Calls of predict() on the same object are not thread-safe, every scoring thread uses its own object.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the decision forest algorithm, double or float
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT RowPredictor
+{
+public:
+    class Impl;
+
+    RowPredictor();
+    ~RowPredictor();
+
+    /**
+     * Prepares the object for the prediction based on the model
+     * \param[in] model     Trained decision forest regression model
+     * \param[in] data      Table whose data dictionary defines the types of the features, e.g. the training data set.
+     *                      All the features are considered ordered if the table is not provided
+     * \return Status of the preparation
+     */
+    services::Status prepare(const decision_forest::regression::ModelPtr & model,
+                             const data_management::NumericTablePtr & data = data_management::NumericTablePtr());
+
+    /**
+     * Predicts the response of one observation
+     * \param[in]  x         Array of getNumberOfFeatures() feature values of the observation
+     * \param[out] response  Predicted response
+     * \return Status of the prediction
+     */
+    services::Status predict(const algorithmFPType * x, algorithmFPType * response);
+
+    /**
+     * Returns the number of features expected by predict()
+     * \return Number of features of the model, 0 if the object is not prepared
+     */
+    size_t getNumberOfFeatures() const;
+
+private:
+    Impl * _impl;
+
+    RowPredictor(const RowPredictor &);
+    RowPredictor & operator=(const RowPredictor &);
+};
+/** @} */
+} // namespace interface1
+using interface1::RowPredictor;
+
+} // namespace prediction
+} // namespace regression
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+#endif
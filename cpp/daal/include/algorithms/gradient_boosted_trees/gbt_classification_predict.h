@@ -245,7 +245,7 @@ public:
 
     typedef algorithms::gbt::classification::prediction::Input InputType;
     typedef algorithms::gbt::classification::prediction::Parameter ParameterType;
-    typedef typename super::ResultType ResultType;
+    typedef algorithms::gbt::classification::prediction::Result ResultType;
 
     InputType input; /*!< %Input objects of the algorithm */
 
@@ -302,7 +302,7 @@ protected:
 
     services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, _par, 0);
+        services::Status s = static_cast<ResultType *>(_result.get())->template allocate<algorithmFPType>(&input, _par, 0);
         _res               = _result.get();
         return s;
     }
@@ -311,6 +311,7 @@ protected:
     {
         _in = &input;
         _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _result.reset(new ResultType());
     }
 
 private:
@@ -56,6 +56,30 @@ enum Method
     defaultDense = 0 /*!< Default method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULTID"></a>
+ * \brief Available identifiers of the results computed in addition to the ones of the classifier
+ */
+enum ResultId
+{
+    predictionContributions = classifier::prediction::lastResultId + 1, /*!< SHAP feature contributions to the raw boosted values, n x (p + 1)
+                                                                             for two classes and n x nClasses * (p + 1) otherwise */
+    predictionInteractions  = predictionContributions + 1,              /*!< SHAP feature interaction values of the raw boosted values,
+                                                                             n x (p + 1)^2 for two classes and n x nClasses * (p + 1)^2 otherwise */
+    lastResultId            = predictionInteractions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the results computed in addition to the ones of the classifier, see classifier::ResultToComputeId.
+ * The flags are combined with the classifier ones in the resultsToEvaluate field of the parameter
+ */
+enum ResultToComputeId
+{
+    computeShapContributions = 0x00000008ULL, /*!< Compute SHAP feature contributions of every observation */
+    computeShapInteractions  = 0x00000010ULL  /*!< Compute SHAP feature interaction values of every observation */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -96,6 +120,67 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     size_t nIterations; /*!< Number of iterations of the trained model to be used for prediction */
 };
 /* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULT"></a>
+ * \brief Provides interface for the result of gradient boosted trees model-based prediction.
+ *        The SHAP values of two classes describe the raw boosted value of the class 1. Otherwise the values
+ *        of every class are stored one after another in a row, the last of the (p + 1) values of a class holds its bias term
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    using classifier::prediction::Result::get;
+    using classifier::prediction::Result::set;
+
+    /**
+     * Returns the result of gradient boosted trees model-based prediction
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of gradient boosted trees model-based prediction
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Allocates memory to store the result of gradient boosted trees model-based prediction
+     * \param[in] input   %Input object
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Algorithm method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method);
+
+    /**
+     * Checks the result of gradient boosted trees model-based prediction
+     * \param[in] input   %Input object
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using classifier::prediction::Result::check;
+
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+typedef services::SharedPtr<const Result> ResultConstPtr;
 } // namespace interface2
 
 /**
@@ -159,6 +244,9 @@ public:
 } // namespace interface1
 using interface2::Parameter;
 using interface1::Input;
+using interface2::Result;
+using interface2::ResultPtr;
+using interface2::ResultConstPtr;
 } // namespace prediction
 /** @} */
 } // namespace classification
@@ -86,8 +86,20 @@ enum ModelInputId
  */
 enum ResultId
 {
-    prediction   = algorithms::regression::prediction::prediction, /*!< Result of gradient boosted trees model-based prediction */
-    lastResultId = prediction
+    prediction              = algorithms::regression::prediction::prediction, /*!< Result of gradient boosted trees model-based prediction */
+    predictionContributions = prediction + 1,              /*!< SHAP feature contributions, n x (p + 1), the last column holds the bias term */
+    predictionInteractions  = predictionContributions + 1, /*!< SHAP feature interaction values, n x (p + 1)^2 */
+    lastResultId            = predictionInteractions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSSION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the results computed in addition to the predicted responses
+ */
+enum ResultToComputeId
+{
+    computeShapContributions = 0x00000001ULL, /*!< Compute SHAP feature contributions of every observation */
+    computeShapInteractions  = 0x00000002ULL  /*!< Compute SHAP feature interaction values of every observation */
 };
 
 /**
@@ -96,19 +108,14 @@ enum ResultId
 namespace interface1
 {
 /**
- * <a name="DAAL-STRUCT-ALGORITHMS__GBT__REGRESSION__PREDICTION__PARAMETER"></a>
  * \brief Parameters of the prediction algorithm
- *
- * \snippet gradient_boosted_trees/gbt_regression_predict_types.h Parameter source code
  */
-/* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     Parameter() : daal::algorithms::Parameter(), nIterations(0) {}
     Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations) {}
     size_t nIterations; /*!< Number of iterations of the trained model to be uses for prediction*/
 };
-/* [Parameter source code] */
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSSION__PREDICTION__INPUT"></a>
@@ -212,7 +219,29 @@ typedef services::SharedPtr<Result> ResultPtr;
 typedef services::SharedPtr<const Result> ResultConstPtr;
 
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__GBT__REGRESSION__PREDICTION__PARAMETER"></a>
+ * \brief Parameters of the prediction algorithm
+ *
+ * \snippet gradient_boosted_trees/gbt_regression_predict_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    Parameter() : interface1::Parameter(), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : interface1::Parameter(o), resultsToCompute(o.resultsToCompute) {}
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute, see ResultToComputeId */
+};
+/* [Parameter source code] */
+} // namespace interface2
+
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
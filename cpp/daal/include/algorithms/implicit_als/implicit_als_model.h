@@ -48,12 +48,8 @@ namespace implicit_als
 namespace interface1
 {
 /**
- * <a name="DAAL-STRUCT-ALGORITHMS__IMPLICIT_ALS__PARAMETER"></a>
  * \brief Parameters for the compute() method of the implicit ALS algorithm
- *
- * \snippet implicit_als/implicit_als_model.h Parameter source code
  */
-/* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     /**
@@ -76,7 +72,6 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
-/* [Parameter source code] */
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__IMPLICIT_ALS__MODEL"></a>
@@ -281,7 +276,47 @@ private:
 
 typedef services::SharedPtr<PartialModel> PartialModelPtr;
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__IMPLICIT_ALS__PARAMETER"></a>
+ * \brief Parameters for the compute() method of the implicit ALS algorithm
+ *
+ * \snippet implicit_als/implicit_als_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    /**
+     * Constructs parameters of the implicit ALS initialization algorithm
+     * \param[in] nFactors            Number of factors
+     * \param[in] maxIterations       Maximum number of iterations of the implicit ALS training algorithm
+     * \param[in] alpha               Confidence parameter of the implicit ALS training algorithm
+     * \param[in] lambda              Regularization parameter
+     * \param[in] preferenceThreshold Threshold used to define preference values
+     * \param[in] nCGIterations       Number of conjugate gradient iterations used to update each row of factors,
+     *                                0 to solve the systems of normal equations exactly by Cholesky decomposition
+     */
+    Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01, double preferenceThreshold = 0.0,
+              size_t nCGIterations = 0)
+        : interface1::Parameter(nFactors, maxIterations, alpha, lambda, preferenceThreshold), nCGIterations(nCGIterations)
+    {}
+
+    size_t nCGIterations; /*!< Number of conjugate gradient iterations warm-started from the current factors that approximately solve
+                               the system of normal equations for each row of factors. The exact solution is computed when equal to 0.
+                               In the distributed processing mode the iterations of the step 4 start from the factors stored
+                               in its partial result. A partial result allocated by the algorithm holds zeros, so the step 4 starts
+                               from the previous factors only if their partial result is passed to the algorithm via setPartialResult() */
+};
+/* [Parameter source code] */
+
+} // namespace interface2
+
+using interface2::Parameter;
 using interface1::ModelPtr;
 using interface1::Model;
 using interface1::PartialModelPtr;
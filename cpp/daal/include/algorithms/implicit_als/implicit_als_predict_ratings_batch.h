@@ -91,7 +91,7 @@ public:
     typedef algorithms::implicit_als::prediction::ratings::Result ResultType;
 
     InputType input;         /*!< Input objects for the algorithm */
-    ParameterType parameter; /*!< \ref implicit_als::interface1::Parameter "Parameters" of the ratings prediction algorithm */
+    ParameterType parameter; /*!< \ref implicit_als::interface2::Parameter "Parameters" of the ratings prediction algorithm */
 
     /**
      * Default constructor
@@ -96,7 +96,7 @@ public:
  *      - \ref Method       Computation methods
  *
  * \par References
- *      - \ref implicit_als::interface1::Parameter "implicit_als::Parameter" class
+ *      - \ref implicit_als::interface2::Parameter "implicit_als::Parameter" class
  *      - \ref Distributed class
  */
 template <ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
@@ -127,7 +127,7 @@ public:
     typedef algorithms::implicit_als::prediction::ratings::PartialResult PartialResultType;
 
     DistributedInput<step1Local> input; /*!< %Input data structure */
-    ParameterType parameter;            /*!< \ref implicit_als::interface1::Parameter "Parameters" of the algorithm */
+    ParameterType parameter;            /*!< \ref implicit_als::interface2::Parameter "Parameters" of the algorithm */
 
     /**
      * Default constructor
@@ -86,7 +86,7 @@ public:
     typedef algorithms::implicit_als::training::Result ResultType;
 
     InputType input;         /*!< %Input data structure */
-    ParameterType parameter; /*!< %Algorithm \ref implicit_als::interface1::Parameter "parameter" */
+    ParameterType parameter; /*!< %Algorithm \ref implicit_als::interface2::Parameter "parameter" */
 
     /** Default constructor */
     Batch() { initialize(); }
@@ -209,7 +209,7 @@ public:
     typedef algorithms::implicit_als::training::DistributedPartialResultStep1 PartialResultType;
 
     DistributedInput<step1Local> input; /*!< %Input data structure */
-    ParameterType parameter;            /*!< %Training \ref implicit_als::interface1::Parameter "parameters" */
+    ParameterType parameter;            /*!< %Training \ref implicit_als::interface2::Parameter "parameters" */
 
     /** Default constructor */
     Distributed() { initialize(); }
@@ -316,7 +316,7 @@ public:
     typedef algorithms::implicit_als::training::DistributedPartialResultStep2 PartialResultType;
 
     DistributedInput<step2Master> input; /*!< %Input data structure */
-    ParameterType parameter;             /*!< %Training \ref implicit_als::interface1::Parameter "parameters" */
+    ParameterType parameter;             /*!< %Training \ref implicit_als::interface2::Parameter "parameters" */
 
     /** Default constructor */
     Distributed() { initialize(); }
@@ -423,7 +423,7 @@ public:
     typedef algorithms::implicit_als::training::DistributedPartialResultStep3 PartialResultType;
 
     DistributedInput<step3Local> input; /*!< %Input data structure */
-    ParameterType parameter;            /*!< %Training \ref implicit_als::interface1::Parameter "parameters" */
+    ParameterType parameter;            /*!< %Training \ref implicit_als::interface2::Parameter "parameters" */
 
     /** Default constructor */
     Distributed() { initialize(); }
@@ -530,7 +530,7 @@ public:
     typedef algorithms::implicit_als::training::DistributedPartialResultStep4 PartialResultType;
 
     DistributedInput<step4Local> input; /*!< %Input data structure */
-    ParameterType parameter;            /*!< %Training \ref implicit_als::interface1::Parameter "parameters" */
+    ParameterType parameter;            /*!< %Training \ref implicit_als::interface2::Parameter "parameters" */
 
     /** Default constructor */
     Distributed() { initialize(); }
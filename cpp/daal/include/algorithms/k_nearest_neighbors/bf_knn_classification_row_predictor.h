@@ -0,0 +1,100 @@
+/* file: bf_knn_classification_row_predictor.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for brute force k nearest neighbors classification prediction of a single observation
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_ROW_PREDICTOR_H__
+#define __BF_KNN_CLASSIFICATION_ROW_PREDICTOR_H__
+
+#include "algorithms/k_nearest_neighbors/bf_knn_classification_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace prediction
+{
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * @ingroup bf_knn_classification_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BF_KNN_CLASSIFICATION__PREDICTION__ROWPREDICTOR"></a>
+ * \brief Predicts brute force k nearest neighbors classification results for one observation at a time.
+ *        The training data of the model is copied once by prepare(), then every call of predict() runs in the calling thread
+ *        on the raw array of the feature values without numeric tables, input validation and threading.
+ *        Calls of predict() on the same object are not thread-safe, every scoring thread uses its own object.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the k nearest neighbors algorithm, double or float
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT RowPredictor
+{
+public:
+    class Impl;
+
+    RowPredictor();
+    ~RowPredictor();
+
+    /**
+     * Prepares the object for the prediction based on the model
+     * \param[in] model     Trained brute force kNN model, the training data must be kept in the model
+     * \param[in] parameter Parameters of the prediction: number of neighbors
+     * \return Status of the preparation
+     */
+    services::Status prepare(const bf_knn_classification::ModelPtr & model, const Parameter & parameter);
+
+    /**
+     * Predicts the class of one observation by the majority vote of its k nearest neighbors
+     * \param[in]  x     Array of getNumberOfFeatures() feature values of the observation
+     * \param[out] label Predicted class label
+     * \return Status of the prediction
+     */
+    services::Status predict(const algorithmFPType * x, algorithmFPType * label);
+
+    /**
+     * Returns the number of features expected by predict()
+     * \return Number of features of the model, 0 if the object is not prepared
+     */
+    size_t getNumberOfFeatures() const;
+
+private:
+    Impl * _impl;
+
+    RowPredictor(const RowPredictor &);
+    RowPredictor & operator=(const RowPredictor &);
+};
+/** @} */
+} // namespace interface1
+using interface1::RowPredictor;
+
+} // namespace prediction
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -28,6 +28,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_defines.h"
+#include "algorithms/engines/engine.h"
 
 namespace daal
 {
@@ -48,9 +49,15 @@ namespace kmeans
  */
 enum Method
 {
-    lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
-    defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydDense        = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
+    defaultDense      = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
+    lloydCSR          = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    boundedLloydDense = 2, /*!< Lloyd algorithm that skips distance computations for observations whose nearest centroid cannot change.
+                                Categorical features are not supported. In the distributed processing mode the distance bounds
+                                are kept in the partial result of the step1Local algorithm, so they carry over to the next iteration
+                                only if the same step1Local algorithm object is reused or its partial result is passed to
+                                the new object via setPartialResult(); otherwise every iteration computes all distances */
+    miniBatchDense    = 3  /*!< Mini-batch algorithm that updates centroids on batches of observations with per-centroid learning rates */
 };
 
 /**
@@ -96,7 +103,9 @@ enum PartialResultId
     partialAssignments,         /*!< Table containing assignments of observations to particular clusters */
     partialCandidatesDistances, /*!< Table containing goal function of observations most distant from their assigned cluster center */
     partialCandidatesCentroids, /*!< Table containing observations most distant from their assigned cluster center */
-    lastPartialResultId = partialCandidatesCentroids
+    partialLowerBounds,         /*!< Table containing lower bounds of distances from observations to groups of centroids (boundedLloydDense) */
+    partialBoundsCentroids,     /*!< Table containing centroids the lower bounds are computed for (boundedLloydDense) */
+    lastPartialResultId = partialBoundsCentroids
 };
 
 /**
@@ -372,14 +381,10 @@ public:
 namespace interface2
 {
 /**
- * <a name="DAAL-STRUCT-ALGORITHMS__KMEANS__PARAMETER"></a>
  * \brief Parameters for K-Means algorithm
  * \par Enumerations
  *      - \ref DistanceType Methods for distance computation
- *
- * \snippet kmeans/kmeans_types.h Parameter source code
  */
-/* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     /**
@@ -405,11 +410,50 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
-/* [Parameter source code] */
 
 } // namespace interface2
 
-using interface2::Parameter;
+/**
+ * \brief Contains version 3.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__KMEANS__PARAMETER"></a>
+ * \brief Parameters for K-Means algorithm
+ * \par Enumerations
+ *      - \ref DistanceType Methods for distance computation
+ *
+ * \snippet kmeans/kmeans_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    /**
+     *  Constructs parameters of K-Means algorithm
+     *  \param[in] _nClusters   Number of clusters
+     *  \param[in] _maxIterations Number of iterations
+     */
+    Parameter(size_t _nClusters, size_t _maxIterations);
+
+    /**
+     *  Constructs parameters of K-Means algorithm by copying another parameters of K-Means algorithm.
+     *  The engine of the other parameters is cloned
+     *  \param[in] other    Parameters of K-Means algorithm
+     */
+    Parameter(const Parameter & other);
+
+    size_t batchSize;          /*!< miniBatchDense only. Number of observations in a mini-batch */
+    engines::EnginePtr engine; /*!< miniBatchDense only. Engine to be used for sampling mini-batches in the batch processing mode.
+                                    If it is not set, the mt2203 engine with the default seed is created by the computation */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+
+} // namespace interface3
+
+using interface3::Parameter;
 using interface1::InputIface;
 using interface1::Input;
 using interface1::PartialResult;
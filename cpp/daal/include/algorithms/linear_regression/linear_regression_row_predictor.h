@@ -0,0 +1,105 @@
+/* file: linear_regression_row_predictor.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for linear regression prediction of a single observation
+//--
+*/
+
+#ifndef __LINEAR_REGRESSION_ROW_PREDICTOR_H__
+#define __LINEAR_REGRESSION_ROW_PREDICTOR_H__
+
+#include "algorithms/linear_regression/linear_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace prediction
+{
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * @ingroup linear_regression_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LINEAR_REGRESSION__PREDICTION__ROWPREDICTOR"></a>
+ * \brief Predicts linear regression results for one observation at a time.
+ *        The coefficients of the model are copied once by prepare(), then every call of predict() runs in the calling thread
+ *        on the raw array of the feature values without numeric tables, input validation and threading.
+ *        Calls of predict() on the same object are not thread-safe, every scoring thread uses its own object.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the linear regression algorithm, double or float
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT RowPredictor
+{
+public:
+    class Impl;
+
+    RowPredictor();
+    ~RowPredictor();
+
+    /**
+     * Prepares the object for the prediction based on the model
+     * \param[in] model     Trained linear regression model
+     * \return Status of the preparation
+     */
+    services::Status prepare(const linear_regression::ModelPtr & model);
+
+    /**
+     * Predicts the responses of one observation
+     * \param[in]  x         Array of getNumberOfFeatures() feature values of the observation
+     * \param[out] responses Array of the predicted responses of size getNumberOfResponses()
+     * \return Status of the prediction
+     */
+    services::Status predict(const algorithmFPType * x, algorithmFPType * responses);
+
+    /**
+     * Returns the number of responses computed by predict()
+     * \return Number of responses of the model, 0 if the object is not prepared
+     */
+    size_t getNumberOfResponses() const;
+
+    /**
+     * Returns the number of features expected by predict()
+     * \return Number of features of the model, 0 if the object is not prepared
+     */
+    size_t getNumberOfFeatures() const;
+
+private:
+    Impl * _impl;
+
+    RowPredictor(const RowPredictor &);
+    RowPredictor & operator=(const RowPredictor &);
+};
+/** @} */
+} // namespace interface1
+using interface1::RowPredictor;
+
+} // namespace prediction
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
+#endif
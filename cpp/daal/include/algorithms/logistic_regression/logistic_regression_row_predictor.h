@@ -0,0 +1,102 @@
+/* file: logistic_regression_row_predictor.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for logistic regression prediction of a single observation
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_ROW_PREDICTOR_H__
+#define __LOGISTIC_REGRESSION_ROW_PREDICTOR_H__
+
+#include "algorithms/classifier/classifier_model.h"
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace prediction
+{
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+/**
+ * @ingroup logistic_regression_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__ROWPREDICTOR"></a>
+ * \brief Predicts logistic regression results for one observation at a time.
+ *        The coefficients of the model are copied once by prepare(), then every call of predict() runs in the calling thread
+ *        on the raw array of the feature values without numeric tables, input validation and threading.
+ *        Calls of predict() on the same object are not thread-safe, every scoring thread uses its own object.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the logistic regression algorithm, double or float
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT RowPredictor
+{
+public:
+    class Impl;
+
+    RowPredictor();
+    ~RowPredictor();
+
+    /**
+     * Prepares the object for the prediction based on the model
+     * \param[in] model     Trained logistic regression model
+     * \param[in] parameter Parameters of the prediction: number of classes
+     * \return Status of the preparation
+     */
+    services::Status prepare(const logistic_regression::ModelPtr & model, const classifier::Parameter & parameter);
+
+    /**
+     * Predicts the class of one observation
+     * \param[in]  x             Array of getNumberOfFeatures() feature values of the observation
+     * \param[out] label         Predicted class label, not computed if nullptr
+     * \param[out] probabilities Array of the predicted probabilities of the classes of size nClasses, not computed if nullptr
+     * \return Status of the prediction
+     */
+    services::Status predict(const algorithmFPType * x, algorithmFPType * label, algorithmFPType * probabilities = nullptr);
+
+    /**
+     * Returns the number of features expected by predict()
+     * \return Number of features of the model, 0 if the object is not prepared
+     */
+    size_t getNumberOfFeatures() const;
+
+private:
+    Impl * _impl;
+
+    RowPredictor(const RowPredictor &);
+    RowPredictor & operator=(const RowPredictor &);
+};
+/** @} */
+} // namespace interface2
+using interface2::RowPredictor;
+
+} // namespace prediction
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -229,6 +229,34 @@ public:
     virtual services::Status compute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__CROSS_ENTROPY__BATCHCONTAINER_FASTCSR"></a>
+ * \brief Provides methods to run implementations of the Cross-entropy loss objective function for sparse data in CSR format.
+ *        This class is associated with the Batch class and supports the method of computing
+ *        the Cross-entropy loss objective function in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the Cross-entropy loss objective function, double or float
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BatchContainer<algorithmFPType, fastCSR, cpu> : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for cross_entropy_loss objective function with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of cross_entropy_loss objective function in the batch processing mode
+     *
+     * \return Status of computations
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__CROSS_ENTROPY__BATCH"></a>
  * \brief Computes the Cross-entropy loss objective function in the batch processing mode.
@@ -226,6 +226,34 @@ public:
     virtual services::Status compute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__LOGISTIC_LOSS__BATCHCONTAINER_FASTCSR"></a>
+ * \brief Provides methods to run implementations of the Logistic loss objective function for sparse data in CSR format.
+ *        This class is associated with the Batch class and supports the method of computing
+ *        the Logistic loss objective function in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the Logistic loss objective function, double or float
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BatchContainer<algorithmFPType, fastCSR, cpu> : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for logistic loss objective function with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of logistic loss objective function in the batch processing mode
+     *
+     * \return Status of computations
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__LOGISTIC_LOSS__BATCH"></a>
  * \brief Computes the Logistic loss objective function in the batch processing mode.
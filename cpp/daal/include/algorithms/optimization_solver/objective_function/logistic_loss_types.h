@@ -67,7 +67,8 @@ enum InputId
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. */
+    defaultDense = 0, /*!< Default: performance-oriented method. */
+    fastCSR      = 1  /*!< Performance-oriented method for sparse data in CSR format, not supported by the SAGA solver */
 };
 
 /**
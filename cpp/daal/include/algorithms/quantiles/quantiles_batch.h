@@ -37,6 +37,130 @@ namespace quantiles
 {
 namespace interface1
 {
+/**
+ * \brief Provides methods to run implementations of the quantiles algorithm.  \DAAL_DEPRECATED
+ *        It is associated with the daal::algorithms::quantiles::interface1::Batch class
+ *        and supports methods of quantiles computation in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the quantiles algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DAAL_DEPRECATED BatchContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    DAAL_DEPRECATED virtual ~BatchContainer();
+    /**
+     * Computes the result of the quantiles algorithm in the batch processing mode
+     */
+    DAAL_DEPRECATED virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * \brief Computes values of quantiles in the batch processing mode.  \DAAL_DEPRECATED
+ * <!-- \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Quantiles computation methods
+ *      - \ref InputId  Identifiers of quantiles input objects
+ *      - \ref ResultId Identifiers of quantiles results
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    typedef algorithms::quantiles::interface1::Input InputType;
+    typedef algorithms::quantiles::interface1::Parameter ParameterType;
+    typedef algorithms::quantiles::interface1::Result ResultType;
+
+    InputType input;         /*!< %input data structure */
+    ParameterType parameter; /*!< Quantiles parameters structure */
+
+    /** Default constructor     */
+    DAAL_DEPRECATED Batch() { initialize(); }
+
+    /**
+     * Constructs algorithm that computes quantiles by copying input objects and parameters
+     * of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    DAAL_DEPRECATED Batch(const Batch<algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the quantile algorithms
+     * \return Structure that contains computed results of the quantile algorithms
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store results of the quantile algorithms
+     * \param[in] result Structure to store results of the quantile algorithms
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        if (!result) return services::Status(services::ErrorNullResult);
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res               = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in                  = &input;
+        _par                 = &parameter;
+        _result.reset(new ResultType());
+    }
+
+    ResultPtr _result;
+
+private:
+    Batch & operator=(const Batch &);
+};
+} // namespace interface1
+
+/**
+ * \brief Contains version 2.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
 /**
  * @defgroup quantiles_batch Batch
  * @ingroup quantiles
@@ -162,9 +286,9 @@ private:
     Batch & operator=(const Batch &);
 };
 /** @} */
-} // namespace interface1
-using interface1::BatchContainer;
-using interface1::Batch;
+} // namespace interface2
+using interface2::BatchContainer;
+using interface2::Batch;
 
 } // namespace quantiles
 } // namespace algorithms
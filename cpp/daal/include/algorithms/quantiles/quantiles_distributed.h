@@ -0,0 +1,299 @@
+/* file: quantiles_distributed.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the quantiles algorithm in the distributed processing mode
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_H__
+#define __QUANTILES_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/quantiles/quantiles_types.h"
+#include "algorithms/quantiles/quantiles_online.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface2
+{
+/**
+ * @defgroup quantiles_distributed Distributed
+ * @ingroup quantiles
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the quantiles algorithm in the distributed processing mode.
+ *        It is associated with the daal::algorithms::quantiles::Distributed class
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template <ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer
+{};
+
+/**
+ * \brief Provides methods to run implementations of the second step of the quantiles algorithm
+ *        in the distributed processing mode.
+ *        It is associated with the daal::algorithms::quantiles::Distributed class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step2Master, algorithmFPType, method, cpu> : public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the quantiles algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Merges the partial results computed on local nodes into the partial result
+     * in the second step of the distributed processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the quantiles algorithm
+     * in the second step of the distributed processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED"></a>
+ * \brief Computes approximate values of quantiles in the distributed processing mode.
+ * <!-- \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a> -->
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Quantiles computation methods
+ *      - \ref InputId          Identifiers of quantiles input objects
+ *      - \ref PartialResultId  Identifiers of quantiles partial results
+ *      - \ref ResultId         Identifiers of quantiles results
+ */
+template <ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = sketchDense>
+class DAAL_EXPORT Distributed
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the partial result of the quantiles algorithm on a local node in the first step
+ *        of the distributed processing mode. The local node may process its data set by blocks as in the online processing mode
+ * <!-- \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template <typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Online<algorithmFPType, method>
+{
+public:
+    typedef Online<algorithmFPType, method> super;
+
+    typedef typename super::InputType InputType;
+    typedef typename super::ParameterType ParameterType;
+    typedef typename super::ResultType ResultType;
+    typedef typename super::PartialResultType PartialResultType;
+
+    /** Default constructor */
+    Distributed() {}
+
+    /**
+     * Constructs algorithm that computes quantiles by copying input objects and parameters
+     * of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> & other) : Online<algorithmFPType, method>(other) {}
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+private:
+    Distributed & operator=(const Distributed &);
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Merges the partial results computed on local nodes and computes the quantiles in the second step
+ *        of the distributed processing mode. The merged sketches keep the same bounded size as the local ones
+ * <!-- \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template <typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    typedef algorithms::quantiles::DistributedInput<step2Master> InputType;
+    typedef algorithms::quantiles::Parameter ParameterType;
+    typedef algorithms::quantiles::Result ResultType;
+    typedef algorithms::quantiles::PartialResult PartialResultType;
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< Quantiles parameters structure */
+
+    /** Default constructor */
+    Distributed() { initialize(); }
+
+    /**
+     * Constructs algorithm that computes quantiles by copying input objects and parameters
+     * of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    virtual ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the quantile algorithms
+     * \return Structure that contains computed results of the quantile algorithms
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store results of the quantile algorithms
+     * \param[in] result Structure to store results of the quantile algorithms
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the quantile algorithms
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store partial results of the quantile algorithms
+     * \param[in] partialResult Structure to store partial results of the quantile algorithms
+     * \param[in] initFlag      Flag that specifies whether the partial results are initialized
+     */
+    services::Status setPartialResult(const PartialResultPtr & partialResult, bool initFlag = false)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres          = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, method);
+        _res               = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in                        = &input;
+        _par                       = &parameter;
+        _result.reset(new ResultType());
+        _partialResult.reset(new PartialResultType());
+    }
+
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+
+private:
+    Distributed & operator=(const Distributed &);
+};
+/** @} */
+} // namespace interface2
+using interface2::DistributedContainer;
+using interface2::Distributed;
+
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+#endif
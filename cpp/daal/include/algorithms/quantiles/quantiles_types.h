@@ -47,7 +47,9 @@ namespace quantiles
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    defaultDense = 0, /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    sketchDense  = 1  /*!< Mergeable sketch of bounded size that computes approximate quantiles.
+                           Available in the online and distributed processing modes */
 };
 
 /**
@@ -70,13 +72,33 @@ enum ResultId
     lastResultId = quantiles
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantiles algorithm
+ */
+enum PartialResultId
+{
+    sketchValues,     /*!< Values kept in the sketches of the features, one row per feature */
+    sketchLevelSizes, /*!< Number of levels, compaction state and sizes of the levels of the sketches, one row per feature */
+    lastPartialResultId = sketchLevelSizes
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the quantiles algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults, /*!< Collection of partial results computed on local nodes */
+    lastMasterInputId = partialResults
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
 namespace interface1
 {
 /**
- * <a name="DAAL-STRUCT-ALGORITHMS__QUANTILES__PARAMETER"></a>
  * \brief Parameters of the quantiles algorithm
  */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
@@ -86,7 +108,6 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 };
 
 /**
- * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT"></a>
  * \brief %Input objects for the quantiles algorithm
  */
 class DAAL_EXPORT Input : public daal::algorithms::Input
@@ -120,7 +141,6 @@ public:
 };
 
 /**
- * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
  *        quantiles algorithm in the batch processing mode
  */
@@ -175,12 +195,301 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
-/** @} */
 } // namespace interface1
-using interface1::Parameter;
-using interface1::Input;
-using interface1::Result;
-using interface1::ResultPtr;
+
+/**
+ * \brief Contains version 2.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__QUANTILES__PARAMETER"></a>
+ * \brief Parameters of the quantiles algorithm
+ */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    Parameter(const data_management::NumericTablePtr quantileOrders = data_management::NumericTablePtr());
+    size_t sketchSize; /*!< sketchDense only. Number of values kept on the top level of the sketch of a feature,
+                            the rank error of the quantiles decreases as 1/sketchSize */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUTIFACE"></a>
+ * \brief Abstract class that specifies interface for classes that declare input of the quantiles algorithm
+ */
+class DAAL_EXPORT InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    InputIface(const InputIface & other) : daal::algorithms::Input(other) {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \param[out] nFeatures Number of features
+     * \return Status of the call
+     */
+    virtual services::Status getNumberOfFeatures(size_t & nFeatures) const = 0;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT"></a>
+ * \brief %Input objects for the quantiles algorithm
+ */
+class DAAL_EXPORT Input : public InputIface
+{
+public:
+    Input();
+    Input(const Input & other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \param[out] nFeatures Number of features
+     * \return Status of the call
+     */
+    services::Status getNumberOfFeatures(size_t & nFeatures) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns an input object for the quantiles algorithm
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets the input object of the quantiles algorithm
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Check the correctness of the %Input object
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    virtual services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the
+ *        quantiles algorithm in the online or distributed processing mode
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult)
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the quantiles algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Initializes partial results of the quantiles algorithm with empty sketches
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Returns the number of features in the partial result of the quantiles algorithm
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Returns the partial result of the quantiles algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the quantiles algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const;
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the
+ *        quantiles algorithm in the batch processing mode or finalizeCompute() method
+ *        in the online or distributed processing mode
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store final results of the quantile algorithms
+     * \param[in] input     Input objects for the quantiles algorithm
+     * \param[in] parameter Parameters of the quantiles algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Allocates memory to store final results of the quantile algorithms
+     * \param[in] partialResult Partial results of the quantiles algorithm
+     * \param[in] parameter     Parameters of the quantiles algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                          const int method);
+
+    /**
+     * Returns the final result of the quantiles algorithm
+     * \param[in] id   Identifier of the final result, \ref ResultId
+     * \return         Final result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the Result object of the quantiles algorithm
+     * \param[in] id        Identifier of the Result object
+     * \param[in] value     Pointer to the Result object
+     */
+    void set(ResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the object
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    virtual services::Status check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] pres   Pointer to the partial results structure
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    virtual services::Status check(const daal::algorithms::PartialResult * pres, const daal::algorithms::Parameter * par,
+                                   int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const;
+
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode on the master node
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template <ComputeStep step>
+class DAAL_EXPORT DistributedInput : public InputIface
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput & other);
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \param[out] nFeatures Number of features
+     * \return Status of the call
+     */
+    services::Status getNumberOfFeatures(size_t & nFeatures) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const PartialResultPtr & partialResult);
+
+    /**
+     * Sets input object for the quantiles algorithm in the distributed processing mode
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr & ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of distributed input objects
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the input objects of the quantiles algorithm on the master node
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/** @} */
+} // namespace interface2
+using interface2::Parameter;
+using interface2::InputIface;
+using interface2::Input;
+using interface2::PartialResult;
+using interface2::PartialResultPtr;
+using interface2::Result;
+using interface2::ResultPtr;
+using interface2::DistributedInput;
 
 } // namespace quantiles
 } // namespace algorithms
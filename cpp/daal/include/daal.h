@@ -25,9 +25,11 @@
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
+#include "data_management/compression/lz4compression.h"
 #include "data_management/compression/lzocompression.h"
 #include "data_management/compression/rlecompression.h"
 #include "data_management/compression/zlibcompression.h"
+#include "data_management/compression/zstdcompression.h"
 #include "data_management/features/compatibility.h"
 #include "data_management/data_source/csv_feature_manager.h"
 #include "data_management/data_source/data_source.h"
@@ -62,6 +64,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_multinode_batch.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
@@ -77,6 +80,7 @@
 #include "algorithms/linear_regression/linear_regression_model_builder.h"
 #include "algorithms/linear_regression/linear_regression_ne_model.h"
 #include "algorithms/linear_regression/linear_regression_predict.h"
+#include "algorithms/linear_regression/linear_regression_row_predictor.h"
 #include "algorithms/linear_regression/linear_regression_qr_model.h"
 #include "algorithms/linear_regression/linear_regression_training_distributed.h"
 #include "algorithms/linear_regression/linear_regression_training_batch.h"
@@ -187,6 +191,8 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -249,6 +255,7 @@
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_model.h"
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_predict.h"
+#include "algorithms/k_nearest_neighbors/bf_knn_classification_row_predictor.h"
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_training_batch.h"
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_training_types.h"
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_predict_types.h"
@@ -265,24 +272,29 @@
 #include "algorithms/decision_forest/decision_forest_classification_model.h"
 #include "algorithms/decision_forest/decision_forest_classification_model_builder.h"
 #include "algorithms/decision_forest/decision_forest_classification_predict.h"
+#include "algorithms/decision_forest/decision_forest_classification_row_predictor.h"
 #include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
 #include "algorithms/decision_forest/decision_forest_regression_model.h"
 #include "algorithms/decision_forest/decision_forest_regression_predict.h"
+#include "algorithms/decision_forest/decision_forest_regression_row_predictor.h"
 #include "algorithms/decision_forest/decision_forest_regression_training_batch.h"
 #include "algorithms/decision_forest/decision_forest_regression_training_types.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_model_builder.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_predict.h"
+#include "algorithms/gradient_boosted_trees/gbt_classification_row_predictor.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_training_batch.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_training_types.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_model_builder.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_row_predictor.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_batch.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
 #include "algorithms/logistic_regression/logistic_regression_model.h"
 #include "algorithms/logistic_regression/logistic_regression_model_builder.h"
 #include "algorithms/logistic_regression/logistic_regression_predict.h"
+#include "algorithms/logistic_regression/logistic_regression_row_predictor.h"
 #include "algorithms/logistic_regression/logistic_regression_training_batch.h"
 #include "algorithms/logistic_regression/logistic_regression_training_types.h"
 #include "algorithms/lasso_regression/lasso_regression_model.h"
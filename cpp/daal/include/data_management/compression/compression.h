@@ -63,10 +63,12 @@ enum CompressionLevel
  */
 enum CompressionMethod
 {
-    zlib, /*!< DEFLATE compression method with a ZLIB block header or a simple GZIP block header */
-    lzo,  /*!< LZO1X compatible compression method */
-    rle,  /*!< Run-Length Encoding method */
-    bzip2 /*!< BZIP2 compression method */
+    zlib,  /*!< DEFLATE compression method with a ZLIB block header or a simple GZIP block header */
+    lzo,   /*!< LZO1X compatible compression method */
+    rle,   /*!< Run-Length Encoding method */
+    bzip2, /*!< BZIP2 compression method */
+    lz4,   /*!< LZ4 compression method with the input data split into the blocks compressed in parallel */
+    zstd   /*!< Zstandard compression method with the input data split into the blocks compressed in parallel */
 };
 
 /**
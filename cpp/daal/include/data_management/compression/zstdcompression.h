@@ -0,0 +1,199 @@
+/* file: zstdcompression.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Zstandard compression and decompression interface.
+//--
+*/
+
+#ifndef __ZSTDCOMPRESSION_H__
+#define __ZSTDCOMPRESSION_H__
+#include "data_management/compression/compression.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup data_compression
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ZSTDCOMPRESSIONPARAMETER"></a>
+ *
+ * \brief Parameter for Zstandard compression and decompression.
+ * The input data is split into blocks of blockSize bytes that are compressed independently and in parallel.
+ * Each Zstandard compressed block consists of a header with two sections: 1) uncompressed data size (4 bytes) and 2) compressed data size (4 bytes),
+ * followed by the Zstandard frame. The block is stored uncompressed if both sizes in its header are equal
+ *
+ * \snippet compression/zstdcompression.h ZstdCompressionParameter source code
+ *
+ */
+/* [ZstdCompressionParameter source code] */
+class DAAL_EXPORT ZstdCompressionParameter : public data_management::CompressionParameter
+{
+public:
+    /**
+     * %ZstdCompressionParameter constructor
+     * \param _clevel    Compression level, \ref CompressionLevel. level0 ... level9 correspond to Zstandard levels 1 ... 10,
+     *                   defaultLevel corresponds to the default Zstandard level 3
+     * \param _blockSize Size in bytes of the blocks of the input data compressed independently
+     */
+    ZstdCompressionParameter(CompressionLevel _clevel = defaultLevel, size_t _blockSize = 1024 * 1024)
+        : data_management::CompressionParameter(_clevel), blockSize(_blockSize)
+    {}
+
+    ~ZstdCompressionParameter() {}
+
+    size_t blockSize; /*!< Size in bytes of the blocks of the input data compressed independently, from 1 byte to 1 GB */
+};
+/* [ZstdCompressionParameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-COMPRESSOR_ZSTD"></a>
+ *
+ * \brief Implementation of the Compressor class for the Zstandard compression method
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref ZstdCompressionParameter class
+ */
+template <>
+class DAAL_EXPORT Compressor<zstd> : public data_management::CompressorImpl
+{
+public:
+    /**
+     * \brief Compressor<zstd> constructor
+     */
+    Compressor();
+    ~Compressor();
+    /**
+     * Associates an input data block with a compressor
+     * \param[in] inBlock Pointer to the data block to compress. Must be at least size+offset bytes
+     * \param[in] size     Number of bytes to compress in inBlock
+     * \param[in] offset   Offset in bytes, the starting position for compression in inBlock
+     */
+    void setInputDataBlock(byte * inBlock, size_t size, size_t offset);
+    /**
+     * Associates an input data block with a compressor
+     * \param[in] inBlock Reference to the data block to compress
+     */
+    void setInputDataBlock(DataBlock & inBlock) { setInputDataBlock(inBlock.getPtr(), inBlock.getSize(), 0); }
+
+    /**
+     * Performs Zstandard compression of a data block
+     * \param[out] outBlock Pointer to the data block where compression results are stored. Must be at least size+offset bytes
+     * \param[in] size       Number of bytes available in outBlock
+     * \param[in] offset     Offset in bytes, the starting position for compression in outBlock
+     */
+    void run(byte * outBlock, size_t size, size_t offset);
+    /**
+     * Performs Zstandard compression of a data block
+     * \param[out] outBlock Reference to the data block where compression results are stored
+     */
+    void run(DataBlock & outBlock) { run(outBlock.getPtr(), outBlock.getSize(), 0); }
+
+    ZstdCompressionParameter parameter; /*!< Zstandard compression parameters structure */
+
+protected:
+    void initialize();
+
+private:
+    void * _next_in;
+    size_t _avail_in;
+
+    void * _internalBuff;
+    size_t _internalBuffOff;
+    size_t _internalBuffLen;
+
+    void compressBlocks();
+    void finalizeCompression();
+};
+
+/**
+ * <a name="DAAL-CLASS-DECOMPRESSOR_ZSTD"></a>
+ *
+ * \brief Implementation of the Decompressor class for the Zstandard decompression method
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref ZstdCompressionParameter class
+ */
+template <>
+class DAAL_EXPORT Decompressor<zstd> : public data_management::DecompressorImpl
+{
+public:
+    /**
+     * \brief Decompressor<zstd> constructor
+     */
+    Decompressor();
+    ~Decompressor();
+    /**
+     * Associates an input data block with a decompressor
+     * \param[in] inBlock Pointer to the data block to decompress. Must be at least size+offset bytes
+     * \param[in] size     Number of bytes to decompress in inBlock
+     * \param[in] offset   Offset in bytes, the starting position for decompression in inBlock
+     */
+    void setInputDataBlock(byte * inBlock, size_t size, size_t offset);
+    /**
+     * Associates an input data block with a decompressor
+     * \param[in] inBlock Reference to the data block to decompress
+     */
+    void setInputDataBlock(DataBlock & inBlock) { setInputDataBlock(inBlock.getPtr(), inBlock.getSize(), 0); }
+    /**
+     * Performs Zstandard decompression of a data block
+     * \param[out] outBlock Pointer to the data block where decompression results are stored. Must be at least size+offset bytes
+     * \param[in] size       Number of bytes available in outBlock
+     * \param[in] offset     Offset in bytes, the starting position for decompression in outBlock
+     */
+    void run(byte * outBlock, size_t size, size_t offset);
+    /**
+     * Performs Zstandard decompression of a data block
+     * \param[out] outBlock Reference to the data block where decompression results are stored
+     */
+    void run(DataBlock & outBlock) { run(outBlock.getPtr(), outBlock.getSize(), 0); }
+
+    ZstdCompressionParameter parameter; /*!< Zstandard compression parameters structure */
+
+protected:
+    void initialize();
+
+private:
+    void * _next_in;
+    size_t _avail_in;
+
+    void * _internalBuff;
+    size_t _internalBuffOff;
+    size_t _internalBuffLen;
+
+    void decompressBlocks(byte * out, size_t outLen);
+    void finalizeCompression();
+};
+/** @} */
+} // namespace interface1
+using interface1::ZstdCompressionParameter;
+using interface1::Compressor;
+using interface1::Decompressor;
+
+} //namespace data_management
+} //namespace daal
+#endif //__ZSTDCOMPRESSION_H
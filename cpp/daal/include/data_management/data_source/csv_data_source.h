@@ -55,7 +55,8 @@ public:
         byDefault                   = 0,
         allocateNumericTable        = 1 << 0,
         createDictionaryFromContext = 1 << 1,
-        parseHeader                 = 1 << 2
+        parseHeader                 = 1 << 2,
+        memoryMapFile               = 1 << 3 /*!< Map the file into memory and parse numeric data in parallel, used by FileDataSource */
     };
 
     static CsvDataSourceOptions::Value unite(const CsvDataSourceOptions::Value & lhs, const CsvDataSourceOptions::Value & rhs)
@@ -77,6 +78,8 @@ public:
 
     bool getParseHeaderFlag() const { return _impl.getFlag(parseHeader); }
 
+    bool getMemoryMapFileFlag() const { return _impl.getFlag(memoryMapFile); }
+
 private:
     internal::DataSourceOptionsImpl<Value> _impl;
 };
@@ -272,26 +275,12 @@ public:
         BlockDescriptor<DAAL_DATA_TYPE> ntBlock;
         nt->getBlockOfRows(0, nt->getNumberOfRows(), readWrite, ntBlock);
 
-        for (; j < maxRows && !iseof(); j++)
+        s = parseRows(maxRows, rowOffset, nt, ntBlock, j);
+        if (!s)
         {
-            s = readLine();
-            if (!s)
-            {
-                this->_status.add(services::throwIfPossible(s));
-
-                return 0;
-            }
-            if (!_rawLineLength)
-            {
-                break;
-            }
-
-            services::BufferView<DAAL_DATA_TYPE> rowBuffer(ntBlock.getBlockPtr() + (rowOffset + j) * nt->getNumberOfColumns(),
-                                                           ntBlock.getNumberOfColumns());
-
-            _featureManager.parseRowIn(_rawLineBuffer, _rawLineLength, this->_dict.get(), rowBuffer, rowOffset + j);
+            this->_status.add(services::throwIfPossible(s));
 
-            super::updateStatistics(j, nt, ntBlock.getBlockPtr(), rowOffset);
+            return 0;
         }
 
         nt->releaseBlockOfRows(ntBlock);
@@ -352,6 +341,40 @@ protected:
     virtual bool iseof() const          = 0;
     virtual services::Status readLine() = 0;
 
+    /**
+     *  Reads up to maxRows rows of data and converts them into the numeric representation
+     *  \param[in]  maxRows    Maximal number of rows to read
+     *  \param[in]  rowOffset  Position in the numeric table at which to store the first row
+     *  \param[in]  nt         Numeric table to store the result of parsing
+     *  \param[in]  ntBlock    Block of all rows of the numeric table
+     *  \param[out] nRows      Number of rows read
+     *  \return Status of reading
+     */
+    virtual services::Status parseRows(size_t maxRows, size_t rowOffset, NumericTable * nt, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock, size_t & nRows)
+    {
+        services::Status s;
+        for (nRows = 0; nRows < maxRows && !iseof(); nRows++)
+        {
+            s = readLine();
+            if (!s)
+            {
+                return s;
+            }
+            if (!_rawLineLength)
+            {
+                break;
+            }
+
+            services::BufferView<DAAL_DATA_TYPE> rowBuffer(ntBlock.getBlockPtr() + (rowOffset + nRows) * nt->getNumberOfColumns(),
+                                                           ntBlock.getNumberOfColumns());
+
+            _featureManager.parseRowIn(_rawLineBuffer, _rawLineLength, this->_dict.get(), rowBuffer, rowOffset + nRows);
+
+            super::updateStatistics(nRows, nt, ntBlock.getBlockPtr(), rowOffset);
+        }
+        return s;
+    }
+
     virtual services::Status resetNumericTable(NumericTable * nt, const size_t newSize)
     {
         services::Status s;
@@ -327,6 +327,11 @@ public:
      */
     void setDelimiter(char delimiter) { _delimiter = delimiter; }
 
+    /**
+     *  Returns the character used as a delimiter for parsing CSV data
+     */
+    char getDelimiter() const { return _delimiter; }
+
 public:
     /**
      * Gets number of columns which must be allocated in numeric table
@@ -479,6 +484,35 @@ public:
         }
     }
 
+    /**
+     * Gets the index of the numeric table column for every token of the row, if all the features are continuous
+     * and parsing of a row does not depend on the other rows
+     * \param[out] columnIndices  Index of the column for every token, negative for the tokens filtered out
+     * \return true if the row tokens can be converted independently, false otherwise
+     */
+    bool getContinuousColumnIndices(services::Collection<int> & columnIndices) const
+    {
+        if (_modifiersManager) return false;
+
+        columnIndices.clear();
+        for (size_t i = 0; i < _numberOfTokens && i < funcList.size(); i++)
+        {
+            if (funcList[i] == ModifierIface::contFunc)
+            {
+                columnIndices.push_back((int)auxVect[i].idx);
+            }
+            else if (funcList[i] == ModifierIface::nullFunc)
+            {
+                columnIndices.push_back(-1);
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * Finalizes CSV data parsing
      * \param[in]  dictionary  Pointer to the dictionary
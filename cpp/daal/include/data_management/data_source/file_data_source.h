@@ -25,6 +25,7 @@
 #define __FILE_DATA_SOURCE_H__
 
 #include <cstdio>
+#include <cstring>
 
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
@@ -32,6 +33,8 @@
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data_source/csv_feature_manager.h"
+#include "data_management/data_source/internal/csv_parallel_parser.h"
 
 namespace daal
 {
@@ -88,7 +91,7 @@ public:
      */
     FileDataSource(const std::string & fileName, CsvDataSourceOptions options, size_t initialMaxRows = 10) : super(options, initialMaxRows)
     {
-        _status |= initialize(fileName);
+        _status |= initialize(fileName, options.getMemoryMapFileFlag());
     }
 
     virtual ~FileDataSource()
@@ -101,6 +104,11 @@ public:
     services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
     {
         services::Status s = super::createDictionaryFromContext();
+        if (_mappedFile)
+        {
+            _mappedFilePos = 0;
+            return s;
+        }
         fseek(_file, 0, SEEK_SET);
         _fileBufferPos = _fileBufferLen;
         return s;
@@ -109,7 +117,11 @@ public:
     DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE { return (iseof() ? DataSourceIface::endOfData : DataSourceIface::readyForLoad); }
 
 protected:
-    bool iseof() const DAAL_C11_OVERRIDE { return (_fileBufferPos == _readedFromFileLen && feof(_file)); }
+    bool iseof() const DAAL_C11_OVERRIDE
+    {
+        if (_mappedFile) return (_mappedFilePos >= _mappedFileSize);
+        return (_fileBufferPos == _readedFromFileLen && feof(_file));
+    }
 
     bool readLine(char * buffer, int count, int & pos)
     {
@@ -147,6 +159,7 @@ protected:
     services::Status readLine() DAAL_C11_OVERRIDE
     {
         _rawLineLength = 0;
+        if (_mappedFile) return readMappedLine();
         while (!iseof())
         {
             int readLen = 0;
@@ -175,8 +188,42 @@ protected:
         return services::Status();
     }
 
+    /* Rows of the mapped file are read line by line, see the specialization for CSVFeatureManager */
+    services::Status parseRows(size_t maxRows, size_t rowOffset, NumericTable * nt, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock,
+                               size_t & nRows) DAAL_C11_OVERRIDE
+    {
+        return super::parseRows(maxRows, rowOffset, nt, ntBlock, nRows);
+    }
+
+    services::Status readMappedLine()
+    {
+        if (iseof()) return services::Status();
+
+        const char * const line = _mappedFileData + _mappedFilePos;
+        const size_t nLeft      = _mappedFileSize - _mappedFilePos;
+        const char * lineEnd    = (const char *)memchr(line, '\n', nLeft);
+        size_t lineLength       = (lineEnd ? lineEnd - line : nLeft);
+        _mappedFilePos += (lineEnd ? lineLength + 1 : lineLength);
+
+        while (lineLength > 0 && line[lineLength - 1] == '\r')
+        {
+            lineLength--;
+        }
+        while (lineLength + 1 > (size_t)_rawLineBufferLen)
+        {
+            if (!super::enlargeBuffer()) return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+        if (lineLength && services::internal::daal_memcpy_s(_rawLineBuffer, _rawLineBufferLen, line, lineLength))
+        {
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+        _rawLineBuffer[lineLength] = '\0';
+        _rawLineLength             = (int)lineLength;
+        return services::Status();
+    }
+
 private:
-    services::Status initialize(const std::string & fileName)
+    services::Status initialize(const std::string & fileName, bool memoryMapFile = false)
     {
         _file              = NULL;
         _fileName          = fileName;
@@ -184,10 +231,19 @@ private:
         _fileBufferPos     = _fileBufferLen;
         _fileBuffer        = NULL;
         _readedFromFileLen = 0;
+        _mappedFileData    = NULL;
+        _mappedFileSize    = 0;
+        _mappedFilePos     = 0;
         if (fileName.find('\0') != std::string::npos)
         {
             return services::throwIfPossible(services::ErrorNullByteInjection);
         }
+        if (memoryMapFile)
+        {
+            services::Status s;
+            _mappedFile = internal::mapFile(fileName.c_str(), _mappedFileData, _mappedFileSize, s);
+            return services::throwIfPossible(s);
+        }
 #if (defined(_MSC_VER) && (_MSC_VER >= 1400))
         errno_t error;
         error = fopen_s(&_file, fileName.c_str(), "r");
@@ -222,9 +278,47 @@ protected:
     int _fileBufferPos;
     int _readedFromFileLen;
 
+    services::SharedPtr<Base> _mappedFile; /* keeps the file mapped, empty if the file is read through the buffer */
+    const char * _mappedFileData;
+    size_t _mappedFileSize;
+    size_t _mappedFilePos;
+
 private:
     static const size_t INITIAL_FILE_BUFFER_LENGTH = 1048576;
 };
+/* Rows of continuous features are converted in parallel directly from the mapped file */
+template <>
+inline services::Status FileDataSource<CSVFeatureManager, DAAL_SUMMARY_STATISTICS_TYPE>::parseRows(size_t maxRows, size_t rowOffset,
+                                                                                                 NumericTable * nt,
+                                                                                                 BlockDescriptor<DAAL_DATA_TYPE> & ntBlock,
+                                                                                                 size_t & nRows)
+{
+    CSVFeatureManager & featureManager = this->getFeatureManager();
+    services::Collection<int> columnIndices;
+    if (!_mappedFile || !featureManager.getContinuousColumnIndices(columnIndices))
+    {
+        return super::parseRows(maxRows, rowOffset, nt, ntBlock, nRows);
+    }
+
+    const size_t nCols  = ntBlock.getNumberOfColumns();
+    size_t nParsedChars = 0;
+    nRows               = 0;
+    if (!iseof())
+    {
+        nRows = internal::parseCsvNumericRows<DAAL_DATA_TYPE>(_mappedFileData + _mappedFilePos, _mappedFileSize - _mappedFilePos,
+                                                              featureManager.getDelimiter(), columnIndices.data(), columnIndices.size(),
+                                                              ntBlock.getBlockPtr() + rowOffset * nCols, nCols, maxRows, nParsedChars);
+    }
+    _mappedFilePos += nParsedChars;
+
+    services::Status s;
+    for (size_t i = 0; i < nRows && s; i++)
+    {
+        s |= this->updateStatistics(i, nt, ntBlock.getBlockPtr(), rowOffset);
+    }
+    return s;
+}
+
 /** @} */
 
 } // namespace interface1
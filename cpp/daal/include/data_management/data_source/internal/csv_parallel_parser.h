@@ -0,0 +1,65 @@
+/* file: csv_parallel_parser.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __CSV_PARALLEL_PARSER_H__
+#define __CSV_PARALLEL_PARSER_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+#include "services/daal_shared_ptr.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ * Maps the whole file into memory for reading
+ * \param[in]  fileName  Name of the file
+ * \param[out] data      Pointer to the contents of the file, null if the file is empty
+ * \param[out] size      Size of the file in bytes
+ * \param[out] status    Status of the mapping
+ * \return Handle that keeps the file mapped until it is released, empty if the mapping failed
+ */
+DAAL_EXPORT services::SharedPtr<Base> mapFile(const char * fileName, const char *& data, size_t & size, services::Status & status);
+
+/**
+ * Parses up to maxRows lines of CSV text that contain numeric features only.
+ * The text is split into chunks aligned to line ends that are parsed in parallel.
+ * Parsing stops at the first empty line that is consumed, the same way as sequential parsing does
+ * \param[in]  text           Text to parse, lines are separated by '\n'
+ * \param[in]  textSize       Size of the text in bytes
+ * \param[in]  delimiter      Delimiter of the tokens in the line
+ * \param[in]  columnIndices  Index of the output column for every token of the line, negative to skip the token
+ * \param[in]  nTokens        Number of elements in columnIndices, extra tokens of the line are skipped
+ * \param[out] rows           Output rows, missing tokens leave the corresponding values intact
+ * \param[in]  nRowColumns    Number of values in the output row
+ * \param[in]  maxRows        Maximal number of lines to parse
+ * \param[out] nParsedChars   Number of characters of the text consumed by the parser
+ * \return Number of parsed rows
+ */
+template <typename FPType>
+DAAL_EXPORT size_t parseCsvNumericRows(const char * text, size_t textSize, char delimiter, const int * columnIndices, size_t nTokens, FPType * rows,
+                                       size_t nRowColumns, size_t maxRows, size_t & nParsedChars);
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
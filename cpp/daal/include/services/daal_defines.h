@@ -320,7 +320,8 @@ const int SERIALIZATION_QR_ONLINE_PARTIAL_RESULT_ID            = 102410;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID       = 102420;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID = 102430;
 
-const int SERIALIZATION_QUANTILES_RESULT_ID = 102500;
+const int SERIALIZATION_QUANTILES_RESULT_ID         = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID = 102600;
 
@@ -153,6 +153,22 @@ public:
      */
     void enableThreadPinning(bool enableThreadPinningFlag = true);
 
+    /**
+     *  Enables NUMA-aware memory allocation. In this mode the large zero-initialized buffers allocated by the library
+     *  are zeroed in parallel by the threads of all NUMA nodes, so that the pages of the buffer
+     *  are distributed between the nodes in contiguous parts. The buffers allocated without initialization are not affected.
+     *  Only the placement of the pages is affected: the parallel loops of the algorithms are not bound to the nodes,
+     *  so a thread may still process the part of the buffer that resides on a remote node
+     *  \param[in] enableNumaAwareAllocationFlag   Flag to NUMA-aware allocation enable
+     */
+    void enableNumaAwareAllocation(bool enableNumaAwareAllocationFlag = true);
+
+    /**
+     *  Releases the scratch memory that the threads of the library keep between the calls of the algorithms
+     *  to reuse it for the temporary buffers. The memory of the threads that are running an algorithm is not released
+     */
+    void releaseScratchMemory();
+
     /**
      *  Returns the number of used threads
      *  \return The number of used threads
@@ -227,7 +227,8 @@ enum ErrorID
     // KernelFunction errors: -6200..-6399
 
     // KMeans errors: -6400..-6599
-    ErrorKMeansNumberOfClustersIsTooLarge = -6400, /*!< Number of clusters exceeds the number of points */
+    ErrorKMeansNumberOfClustersIsTooLarge         = -6400, /*!< Number of clusters exceeds the number of points */
+    ErrorKMeansCategoricalFeaturesAreNotSupported = -6401, /*!< Categorical features are not supported by the computation method */
 
     // Linear Rergession errors: -6600..-6799
     ErrorLinearRegressionInternal   = -6600, /*!< Linear Regression internal error */
@@ -327,6 +328,20 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock      = -9022, /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+
+    ErrorLz4Internal                 = -9023, /*!< LZ4 internal error */
+    ErrorLz4DataFormat               = -9024, /*!< Input compressed stream is in wrong format or corrupted */
+    ErrorLz4DataFormatLessThenHeader = -9025, /*!< Size of input compressed stream is less then
+                                                                      *   compressed block header size */
+    ErrorLz4DataFormatNotFullBlock   = -9026, /*!< Input compressed stream contains not a whole
+                                                                      *   number of compressed blocks */
+
+    ErrorZstdInternal                 = -9027, /*!< Zstd internal error */
+    ErrorZstdDataFormat               = -9028, /*!< Input compressed stream is in wrong format or corrupted */
+    ErrorZstdDataFormatLessThenHeader = -9029, /*!< Size of input compressed stream is less then
+                                                                       *   compressed block header size */
+    ErrorZstdDataFormatNotFullBlock   = -9030, /*!< Input compressed stream contains not a whole
+                                                                       *   number of compressed blocks */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400, /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -49,6 +49,10 @@ public:
     services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
 
 protected:
+    /** Write "large" item sets and association rules discovered from them into the resulting tables */
+    services::Status storeResults(ItemSetList<cpu> * L, size_t L_size, NumericTable * r[],
+                                  const daal::algorithms::association_rules::Parameter * parameter);
+
     services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
                                        size_t & L_size);
 
@@ -0,0 +1,329 @@
+/* file: assoc_rules_fpgrowth_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of association rules FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_IMPL_I__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_impl.i"
+#include "src/algorithms/assocrules/assoc_rules_fpgrowth_kernel.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/threading/threading.h"
+
+using namespace daal::algorithms::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+template <CpuType cpu>
+int compareUniqueItemsBySupport(const void * a, const void * b)
+{
+    const assocRulesUniqueItem<cpu> * aa = (const assocRulesUniqueItem<cpu> *)a;
+    const assocRulesUniqueItem<cpu> * bb = (const assocRulesUniqueItem<cpu> *)b;
+
+    if (aa->support != bb->support)
+    {
+        return (bb->support < aa->support) ? -1 : 1;
+    }
+    if (aa->itemID != bb->itemID)
+    {
+        return (aa->itemID < bb->itemID) ? -1 : 1;
+    }
+    return 0;
+}
+
+template <CpuType cpu>
+int compareItemsetsByItems(const void * a, const void * b)
+{
+    const assocrules_itemset<cpu> * aa = *((assocrules_itemset<cpu> * const *)a);
+    const assocrules_itemset<cpu> * bb = *((assocrules_itemset<cpu> * const *)b);
+
+    if (aa->size != bb->size)
+    {
+        return (aa->size < bb->size) ? -1 : 1;
+    }
+    for (size_t i = 0; i < aa->size; i++)
+    {
+        if (aa->items[i] != bb->items[i])
+        {
+            return (aa->items[i] < bb->items[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::compute(const NumericTable * a, NumericTable * r[],
+                                                                       const daal::algorithms::Parameter * algParameter)
+{
+    NumericTable * dataTable = const_cast<NumericTable *>(a);
+    const daal::algorithms::association_rules::Parameter * parameter =
+        static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
+    const double minSupport = parameter->minSupport;
+
+    /* The first pass over the input data set: support of the items and transactions without the items that are not "large" */
+    assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
+    DAAL_CHECK_STATUS_OK(data.ok(), data.getLastStatus());
+
+    const size_t nItems = data.numOfUniqueItems;
+    DAAL_CHECK(nItems > 0, ErrorAprioriIncorrectInputData);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nItems, sizeof(ItemSetList<cpu>));
+
+    TArray<ItemSetList<cpu>, cpu> L(nItems);
+    DAAL_CHECK(L.get(), ErrorMemoryAllocationFailed);
+    for (size_t i = 0; i < nItems; ++i) L[i].setDataOwner(true);
+
+    double ceil = daal::internal::Math<double, cpu>::sCeil(minSupport * data.numOfTransactions);
+    DAAL_ASSERT(ceil >= 0)
+    const size_t iMinSupport    = (size_t)ceil;
+    const size_t maxItemsetSize = ((parameter->maxItemsetSize == 0 || parameter->maxItemsetSize > nItems) ? nItems : parameter->maxItemsetSize);
+
+    Status s;
+    DAAL_CHECK_STATUS(s, this->firstPass(iMinSupport, data, L[0]));
+    size_t L_size = 1;
+
+    if (maxItemsetSize > 1)
+    {
+        /* The second pass over the input data set builds the frequent pattern tree */
+        FPTree<cpu> tree;
+        DAAL_CHECK_STATUS(s, buildTree(data, tree));
+
+        TArray<ItemSetList<cpu>, cpu> found(nItems);
+        DAAL_CHECK(found.get(), ErrorMemoryAllocationFailed);
+        for (size_t i = 0; i < nItems; ++i) found[i].setDataOwner(true);
+
+        /* The item i gives the "large" itemsets that consist of the item i and the items with larger support,
+           so the items are mined independently of each other */
+        daal::tls<FPGrowthScratch<cpu> *> tlsScratch([=]() -> FPGrowthScratch<cpu> * { return FPGrowthScratch<cpu>::create(nItems); });
+
+        SafeStatus safeStat;
+        daal::threader_for(nItems, nItems, [&](size_t i) {
+            FPGrowthScratch<cpu> * scratch = tlsScratch.local();
+            DAAL_CHECK_MALLOC_THR(scratch);
+
+            Status localStatus = mineItem(tree, i, iMinSupport, maxItemsetSize, 0, *scratch, found[i]);
+            DAAL_CHECK_STATUS_THR(localStatus);
+        });
+
+        tlsScratch.reduce([](FPGrowthScratch<cpu> * scratch) -> void { delete scratch; });
+        DAAL_CHECK_SAFE_STATUS();
+
+        DAAL_CHECK_STATUS(s, collectItemsets(nItems, found.get(), L.get(), L_size));
+    }
+
+    return this->storeResults(L.get(), L_size, r, parameter);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildTree(const assocrules_dataset<cpu> & data, FPTree<cpu> & tree)
+{
+    const size_t nItems = data.numOfUniqueItems;
+
+    /* Items are indexed in the tree in the descending order of their support,
+       so the most frequent items are shared by the largest number of transactions */
+    TArray<assocRulesUniqueItem<cpu>, cpu> items(nItems);
+    DAAL_CHECK_MALLOC(items.get());
+    for (size_t i = 0; i < nItems; i++) items[i] = data.uniq_items[i];
+    qSort<assocRulesUniqueItem<cpu>, cpu>(nItems, items.get(), compareUniqueItemsBySupport<cpu>);
+
+    /* Unique items are sorted by identifiers */
+    const size_t maxItemID = data.uniq_items[nItems - 1].itemID;
+    TArray<size_t, cpu> itemIndices(maxItemID + 1);
+    TArray<size_t, cpu> path(nItems);
+    DAAL_CHECK_MALLOC(itemIndices.get() && path.get());
+
+    size_t nTransactionItems = 0;
+    for (size_t t = 0; t < data.numOfLargeTransactions; t++) nTransactionItems += data.large_tran[t]->size;
+
+    /* Transactions share the prefixes in the tree, hence the storage of the nodes starts smaller than the data set and grows on demand */
+    const size_t maxInitialCapacity = (size_t)1 << 20;
+    Status s;
+    DAAL_CHECK_STATUS(s, tree.init(nItems, (nTransactionItems < maxInitialCapacity ? nTransactionItems : maxInitialCapacity)));
+
+    for (size_t i = 0; i < nItems; i++)
+    {
+        itemIndices[items[i].itemID] = i;
+        tree.setItemID(i, items[i].itemID);
+    }
+
+    for (size_t t = 0; t < data.numOfLargeTransactions; t++)
+    {
+        const assocrules_transaction<cpu> * transaction = data.large_tran[t];
+        for (size_t k = 0; k < transaction->size; k++) path[k] = itemIndices[transaction->items[k]];
+        qSort<size_t, cpu>(transaction->size, path.get());
+
+        DAAL_CHECK_STATUS(s, tree.insert(path.get(), transaction->size, 1));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildConditionalTree(const FPTree<cpu> & tree, size_t item, size_t minSupport,
+                                                                                    FPGrowthScratch<cpu> & scratch, FPTree<cpu> & conditionalTree)
+{
+    size_t * const counts       = scratch.counts.get();
+    size_t * const localIndices = scratch.localIndices.get();
+    size_t * const touched      = scratch.touched.get();
+    size_t * const path         = scratch.path.get();
+
+    /* Support of the items in the prefix paths of the item, the paths consist of the items with smaller indices */
+    size_t nTouched   = 0;
+    size_t nPathNodes = 0;
+    for (size_t n = tree.firstNode(item); n != fpTreeNoNode; n = tree.node(n).nextSame)
+    {
+        const size_t count = tree.node(n).count;
+        for (size_t p = tree.node(n).parent; p != 0; p = tree.node(p).parent, nPathNodes++)
+        {
+            const size_t pathItem = tree.node(p).item;
+            if (counts[pathItem] == 0) touched[nTouched++] = pathItem;
+            counts[pathItem] += count;
+        }
+    }
+
+    /* "Large" items of the paths keep the relative order they have in the tree */
+    if (nTouched > 1) qSort<size_t, cpu>(nTouched, touched);
+    size_t nLarge = 0;
+    for (size_t i = 0; i < nTouched; i++)
+    {
+        if (counts[touched[i]] >= minSupport) localIndices[touched[i]] = nLarge++;
+        counts[touched[i]] = 0;
+    }
+
+    Status s = conditionalTree.init(nLarge, (nLarge ? nPathNodes : 0));
+    if (s && nLarge)
+    {
+        for (size_t i = 0; i < nTouched; i++)
+        {
+            if (localIndices[touched[i]] != fpTreeNoNode) conditionalTree.setItemID(localIndices[touched[i]], tree.itemID(touched[i]));
+        }
+
+        for (size_t n = tree.firstNode(item); n != fpTreeNoNode && s; n = tree.node(n).nextSame)
+        {
+            size_t pathSize = 0;
+            for (size_t p = tree.node(n).parent; p != 0; p = tree.node(p).parent)
+            {
+                const size_t localIndex = localIndices[tree.node(p).item];
+                if (localIndex != fpTreeNoNode) path[pathSize++] = localIndex;
+            }
+
+            /* The path is collected from the leaf to the root */
+            for (size_t i = 0; i < pathSize / 2; i++)
+            {
+                const size_t tmp       = path[i];
+                path[i]                = path[pathSize - 1 - i];
+                path[pathSize - 1 - i] = tmp;
+            }
+            s = conditionalTree.insert(path, pathSize, tree.node(n).count);
+        }
+    }
+
+    for (size_t i = 0; i < nTouched; i++) localIndices[touched[i]] = fpTreeNoNode;
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::mineItem(const FPTree<cpu> & tree, size_t item, size_t minSupport,
+                                                                        size_t maxItemsetSize, size_t prefixSize, FPGrowthScratch<cpu> & scratch,
+                                                                        ItemSetList<cpu> & found)
+{
+    size_t * const prefix    = scratch.prefix.get();
+    prefix[prefixSize]       = tree.itemID(item);
+    const size_t itemsetSize = prefixSize + 1;
+
+    /* "Large" itemsets of size 1 are formed from the unique items */
+    if (itemsetSize > 1)
+    {
+        assocrules_itemset<cpu> * itemset = new assocrules_itemset<cpu>(itemsetSize, prefix, prefix[prefixSize], tree.support(item));
+        DAAL_CHECK_MALLOC(itemset);
+        if (!itemset->ok())
+        {
+            Status s = itemset->getLastStatus();
+            delete itemset;
+            return s;
+        }
+        qSort<size_t, cpu>(itemsetSize, itemset->items);
+        if (!found.insert(itemset))
+        {
+            delete itemset;
+            return Status(ErrorMemoryAllocationFailed);
+        }
+    }
+    if (itemsetSize >= maxItemsetSize) return Status();
+
+    FPTree<cpu> conditionalTree;
+    Status s = buildConditionalTree(tree, item, minSupport, scratch, conditionalTree);
+    for (size_t i = 0; s && i < conditionalTree.nItems(); i++)
+    {
+        s = mineItem(conditionalTree, i, minSupport, maxItemsetSize, itemsetSize, scratch, found);
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::collectItemsets(size_t nItems, ItemSetList<cpu> * found, ItemSetList<cpu> * L,
+                                                                               size_t & L_size)
+{
+    size_t nFound = 0;
+    for (size_t i = 0; i < nItems; i++) nFound += found[i].size;
+    if (!nFound) return Status();
+
+    typedef assocrules_itemset<cpu> * ItemsetPtr;
+    TArray<ItemsetPtr, cpu> itemsets(nFound);
+    DAAL_CHECK_MALLOC(itemsets.get());
+
+    /* Ownership of the itemsets passes to the lists of "large" itemsets */
+    for (size_t i = 0, k = 0; i < nItems; i++)
+    {
+        for (auto * current = found[i].start; current != nullptr; current = current->next()) itemsets[k++] = current->itemSet();
+        found[i].setDataOwner(false);
+    }
+
+    /* Itemsets of the same size are listed in the lexicographical order of their items */
+    qSort<ItemsetPtr, cpu>(nFound, itemsets.get(), compareItemsetsByItems<cpu>);
+    for (size_t k = 0; k < nFound; k++)
+    {
+        const size_t itemsetSize = itemsets[k]->size;
+        if (!L[itemsetSize - 1].insert(itemsets[k]))
+        {
+            for (; k < nFound; k++) delete itemsets[k];
+            return Status(ErrorMemoryAllocationFailed);
+        }
+        if (itemsetSize > L_size) L_size = itemsetSize;
+    }
+    return Status();
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,74 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  using FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_kernel.h"
+#include "src/algorithms/assocrules/assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  Structure that contains kernels for FP-Growth association rules mining.
+ *  "Large" itemsets are mined from the frequent pattern tree, association rules are discovered as in Apriori method
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+public:
+    /** Find "large" item sets and build association rules */
+    services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
+
+protected:
+    /** Build the frequent pattern tree of the transactions with items ordered by descending support */
+    services::Status buildTree(const assocrules_dataset<cpu> & data, FPTree<cpu> & tree);
+
+    /** Build the tree of the prefix paths of the item with the items which support in the paths is not less than minimum support */
+    services::Status buildConditionalTree(const FPTree<cpu> & tree, size_t item, size_t minSupport, FPGrowthScratch<cpu> & scratch,
+                                          FPTree<cpu> & conditionalTree);
+
+    /** Find "large" item sets of size 2 and more that end with the item of the tree and extend the prefix */
+    services::Status mineItem(const FPTree<cpu> & tree, size_t item, size_t minSupport, size_t maxItemsetSize, size_t prefixSize,
+                              FPGrowthScratch<cpu> & scratch, ItemSetList<cpu> & found);
+
+    /** Move "large" item sets found for each item into the lists of item sets of the same size */
+    services::Status collectItemsets(size_t nItems, ItemSetList<cpu> * found, ItemSetList<cpu> * L, size_t & L_size);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,228 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of the frequent pattern tree used in FP-Growth method
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "src/services/service_arrays.h"
+
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+const size_t fpTreeNoNode = (size_t)-1;
+
+/**
+ *  \brief Frequent pattern tree - prefix tree of the transactions which items are sorted
+ *         in the ascending order of their indices in the tree.
+ *         Nodes of the same item are linked into the list that starts in the header table of the tree
+ */
+template <CpuType cpu>
+class FPTree
+{
+public:
+    struct Node
+    {
+        size_t item;        /*<! Index of the item in the tree */
+        size_t count;       /*<! Number of transactions that share the path from the root to the node */
+        size_t parent;      /*<! Index of the parent node */
+        size_t firstChild;  /*<! Index of the first child node */
+        size_t nextSibling; /*<! Index of the next child node of the parent */
+        size_t nextSame;    /*<! Index of the next node of the same item */
+    };
+
+    DAAL_NEW_DELETE();
+
+    FPTree() : _nItems(0), _nNodes(0) {}
+
+    /**
+     *  \brief Allocates the tree with the root node only
+     *
+     *  \param nItems[in]        number of items in the tree
+     *  \param nodesCapacity[in] expected number of nodes in the tree excluding the root, the storage grows when it is exceeded
+     *  \return Status object
+     */
+    services::Status init(size_t nItems, size_t nodesCapacity)
+    {
+        _nItems = nItems;
+        _nNodes = 0;
+        if (nItems)
+        {
+            _support.reset(nItems);
+            _itemIDs.reset(nItems);
+            _headers.reset(nItems);
+            _rootChildren.reset(nItems);
+            DAAL_CHECK_MALLOC(_support.get() && _itemIDs.get() && _headers.get() && _rootChildren.get());
+            for (size_t i = 0; i < nItems; i++)
+            {
+                _support[i]      = 0;
+                _itemIDs[i]      = 0;
+                _headers[i]      = fpTreeNoNode;
+                _rootChildren[i] = fpTreeNoNode;
+            }
+        }
+
+        _nodes.reset(nodesCapacity + 1);
+        DAAL_CHECK_MALLOC(_nodes.get());
+        Node & root      = _nodes[0];
+        root.item        = fpTreeNoNode;
+        root.count       = 0;
+        root.parent      = fpTreeNoNode;
+        root.firstChild  = fpTreeNoNode;
+        root.nextSibling = fpTreeNoNode;
+        root.nextSame    = fpTreeNoNode;
+        _nNodes          = 1;
+        return services::Status();
+    }
+
+    /**
+     *  \brief Adds the path of items to the tree
+     *
+     *  \param items[in]  indices of the items in the tree sorted in the ascending order
+     *  \param n[in]      number of items in the path
+     *  \param count[in]  number of transactions that contain the path
+     *  \return Status object
+     */
+    services::Status insert(const size_t * items, size_t n, size_t count)
+    {
+        size_t current = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t item = items[i];
+            size_t child      = (current == 0 ? _rootChildren[item] : findChild(current, item));
+            if (child == fpTreeNoNode)
+            {
+                services::Status s = addNode(item, current, child);
+                DAAL_CHECK_STATUS_VAR(s);
+            }
+            _nodes[child].count += count;
+            _support[item] += count;
+            current = child;
+        }
+        return services::Status();
+    }
+
+    size_t nItems() const { return _nItems; }
+    size_t support(size_t item) const { return _support[item]; }
+    size_t itemID(size_t item) const { return _itemIDs[item]; }
+    void setItemID(size_t item, size_t id) { _itemIDs[item] = id; }
+    size_t firstNode(size_t item) const { return _headers[item]; }
+    const Node & node(size_t i) const { return _nodes[i]; }
+
+protected:
+    size_t findChild(size_t parent, size_t item) const
+    {
+        size_t child = _nodes[parent].firstChild;
+        while (child != fpTreeNoNode && _nodes[child].item != item) child = _nodes[child].nextSibling;
+        return child;
+    }
+
+    services::Status addNode(size_t item, size_t parent, size_t & index)
+    {
+        if (_nNodes == _nodes.size())
+        {
+            /* Storage of the nodes grows twice when the expected number of nodes is exceeded */
+            TArray<Node, cpu> nodes(_nNodes);
+            DAAL_CHECK_MALLOC(nodes.get());
+            for (size_t i = 0; i < _nNodes; i++) nodes[i] = _nodes[i];
+            DAAL_CHECK_MALLOC(_nodes.reset(2 * _nNodes));
+            for (size_t i = 0; i < _nNodes; i++) _nodes[i] = nodes[i];
+        }
+
+        index            = _nNodes++;
+        Node & node      = _nodes[index];
+        node.item        = item;
+        node.count       = 0;
+        node.parent      = parent;
+        node.firstChild  = fpTreeNoNode;
+        node.nextSibling = _nodes[parent].firstChild;
+        node.nextSame    = _headers[item];
+
+        _nodes[parent].firstChild = index;
+        _headers[item]            = index;
+        if (parent == 0) _rootChildren[item] = index;
+        return services::Status();
+    }
+
+    size_t _nItems;                    /*<! Number of items in the tree */
+    size_t _nNodes;                    /*<! Number of nodes in the tree including the root */
+    TArray<Node, cpu> _nodes;          /*<! Nodes of the tree, the root has index 0 */
+    TArray<size_t, cpu> _support;      /*<! Support of the items in the tree */
+    TArray<size_t, cpu> _itemIDs;      /*<! Identifiers of the items in the input data set */
+    TArray<size_t, cpu> _headers;      /*<! Indices of the first nodes of the items */
+    TArray<size_t, cpu> _rootChildren; /*<! Indices of the child nodes of the root for each item */
+};
+
+/**
+ *  \brief Thread local buffers used to build conditional trees
+ */
+template <CpuType cpu>
+struct FPGrowthScratch
+{
+    DAAL_NEW_DELETE();
+
+    static FPGrowthScratch<cpu> * create(size_t nItems)
+    {
+        FPGrowthScratch<cpu> * scratch = new FPGrowthScratch<cpu>();
+        if (!scratch) return nullptr;
+        scratch->counts.reset(nItems);
+        scratch->localIndices.reset(nItems);
+        scratch->touched.reset(nItems);
+        scratch->path.reset(nItems);
+        scratch->prefix.reset(nItems);
+        if (!(scratch->counts.get() && scratch->localIndices.get() && scratch->touched.get() && scratch->path.get() && scratch->prefix.get()))
+        {
+            delete scratch;
+            return nullptr;
+        }
+        for (size_t i = 0; i < nItems; i++)
+        {
+            scratch->counts[i]       = 0;
+            scratch->localIndices[i] = fpTreeNoNode;
+        }
+        return scratch;
+    }
+
+    TArray<size_t, cpu> counts;       /*<! Support of the items in the conditional pattern base, zero between the calls */
+    TArray<size_t, cpu> localIndices; /*<! Indices of the items in the conditional tree, fpTreeNoNode between the calls */
+    TArray<size_t, cpu> touched;      /*<! Items met in the conditional pattern base */
+    TArray<size_t, cpu> path;         /*<! Items of the prefix path being added to the conditional tree */
+    TArray<size_t, cpu> prefix;       /*<! Identifiers of the items of the itemset being extended */
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -50,6 +50,7 @@ namespace internal
 #define __DBSCAN_DEFAULT_QUEUE_SIZE        8
 #define __DBSCAN_DEFAULT_VECTOR_SIZE       8
 #define __DBSCAN_DEFAULT_NEIGHBORHOOD_SIZE 8
+#define __DBSCAN_KD_TREE_LEAF_SIZE         32
 
 template <typename T, CpuType cpu>
 class Queue
@@ -575,6 +576,406 @@ private:
     FPType _p;
 };
 
+template <typename FPType>
+struct KDTreeNode
+{
+    size_t dimension;
+    FPType cutPoint;
+    size_t leftIndex;
+    size_t rightIndex;
+    size_t begin;
+    size_t end;
+};
+
+template <typename FPType, CpuType cpu>
+class NeighborhoodEngine<kdTreeDense, FPType, cpu>
+{
+    DAAL_NEW_DELETE();
+
+    static const size_t leafSize       = __DBSCAN_KD_TREE_LEAF_SIZE;
+    static const size_t queryBlockSize = 256;
+
+public:
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
+        : _inTable(inTable), _outTable(outTable), _weights(weights), _eps(eps), _p(p), _maxDepth(0), _isBuilt(false)
+    {}
+
+    ~NeighborhoodEngine() {}
+
+    NeighborhoodEngine(const NeighborhoodEngine &) = delete;
+    NeighborhoodEngine & operator=(const NeighborhoodEngine &) = delete;
+
+    services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        SafeStatus safeStat;
+        services::Status s;
+
+        const size_t inRows  = _inTable->getNumberOfRows();
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        if (outRows == 0)
+        {
+            return s;
+        }
+
+        DAAL_CHECK_STATUS(s, build());
+
+        const size_t dim      = _inTable->getNumberOfColumns();
+        const FPType epsP     = Math<FPType, cpu>::sPowx(_eps, _p);
+        const size_t nQBlocks = inRows / queryBlockSize + (inRows % queryBlockSize > 0);
+
+        daal::threader_for(nQBlocks, nQBlocks, [&](size_t iBlock) {
+            const size_t i1    = iBlock * queryBlockSize;
+            const size_t i2    = (iBlock + 1 == nQBlocks ? inRows : i1 + queryBlockSize);
+            const size_t iSize = i2 - i1;
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            TArray<size_t, cpu> stackArray(_maxDepth + 1);
+            DAAL_CHECK_MALLOC_THR(stackArray.get());
+
+            for (size_t i = 0; i < iSize; i++)
+            {
+                if (doReset)
+                {
+                    neighs[i + i1].reset();
+                }
+                DAAL_CHECK_STATUS_THR(searchTree(&inData[i * dim], dim, epsP, stackArray.get(), neighs[i + i1]));
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+    services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        SafeStatus safeStat;
+        services::Status s;
+
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        if (outRows == 0)
+        {
+            return s;
+        }
+
+        DAAL_CHECK_STATUS(s, build());
+
+        const size_t dim      = _inTable->getNumberOfColumns();
+        const FPType epsP     = Math<FPType, cpu>::sPowx(_eps, _p);
+        const size_t nQBlocks = n / queryBlockSize + (n % queryBlockSize > 0);
+
+        daal::threader_for(nQBlocks, nQBlocks, [&](size_t iBlock) {
+            const size_t i1 = iBlock * queryBlockSize;
+            const size_t i2 = (iBlock + 1 == nQBlocks ? n : i1 + queryBlockSize);
+
+            TArray<size_t, cpu> stackArray(_maxDepth + 1);
+            DAAL_CHECK_MALLOC_THR(stackArray.get());
+
+            for (size_t i = i1; i < i2; i++)
+            {
+                ReadRows<FPType, cpu> queryRows(const_cast<NumericTable *>(_inTable), indices[i], 1);
+                DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+
+                if (doReset)
+                {
+                    neighs[i].reset();
+                }
+                DAAL_CHECK_STATUS_THR(searchTree(queryRows.get(), dim, epsP, stackArray.get(), neighs[i]));
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+private:
+    /* Collects all points of the tree that lie within epsP from the query point. Subtrees on the far side of a cut
+       are skipped when the squared distance to the cutting hyperplane alone exceeds epsP */
+    services::Status searchTree(const FPType * const queryPoint, size_t dim, FPType epsP, size_t * const stack,
+                                Neighborhood<FPType, cpu> & neigh) const
+    {
+        const KDTreeNode<FPType> * const nodes = _nodes.get();
+        const FPType * const points            = _points.get();
+        const FPType * const weights           = _pointWeights.get();
+        const size_t * const pointIndices      = _indices.get();
+
+        size_t stackSize   = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const KDTreeNode<FPType> & node = nodes[stack[--stackSize]];
+
+            if (node.leftIndex == 0)
+            {
+                for (size_t k = node.begin; k < node.end; k++)
+                {
+                    const FPType dist = distancePow2<FPType, cpu>(queryPoint, &points[k * dim], dim);
+                    if (dist <= epsP)
+                    {
+                        DAAL_CHECK_STATUS_VAR(neigh.add(pointIndices[k], (weights ? weights[k] : (FPType)1.0)));
+                    }
+                }
+                continue;
+            }
+
+            const FPType diff       = queryPoint[node.dimension] - node.cutPoint;
+            const bool isCutInRange = (diff * diff <= epsP);
+            if (diff <= 0 || isCutInRange)
+            {
+                stack[stackSize++] = node.leftIndex;
+            }
+            if (diff >= 0 || isCutInRange)
+            {
+                stack[stackSize++] = node.rightIndex;
+            }
+        }
+
+        return services::Status();
+    }
+
+    /* Builds the tree over the first dim columns of the output table on the first query. Every level of the tree is
+       split in parallel, each node is cut at the median of the dimension with the largest spread */
+    services::Status build()
+    {
+        if (_isBuilt)
+        {
+            return services::Status();
+        }
+
+        SafeStatus safeStat;
+
+        const size_t nRows  = _outTable->getNumberOfRows();
+        const size_t dim    = _inTable->getNumberOfColumns();
+        const size_t outDim = _outTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= dim);
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, dim);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows * dim, sizeof(FPType));
+
+        ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(outDataRows);
+        const FPType * const outData = outDataRows.get();
+
+        _indices.reset(nRows);
+        DAAL_CHECK_MALLOC(_indices.get());
+        size_t * const indices = _indices.get();
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            indices[i] = i;
+        }
+
+        const size_t maxNodes = 4 * (nRows / leafSize) + 3;
+        _nodes.reset(maxNodes);
+        DAAL_CHECK_MALLOC(_nodes.get());
+        KDTreeNode<FPType> * const nodes = _nodes.get();
+
+        TArray<bool, cpu> isSplitArray(maxNodes);
+        DAAL_CHECK_MALLOC(isSplitArray.get());
+        bool * const isSplit = isSplitArray.get();
+
+        nodes[0].leftIndex  = 0;
+        nodes[0].rightIndex = 0;
+        nodes[0].begin      = 0;
+        nodes[0].end        = nRows;
+
+        size_t levelBegin = 0;
+        size_t levelEnd   = 1;
+        size_t depth      = 0;
+
+        while (levelBegin < levelEnd)
+        {
+            const size_t nLevelNodes = levelEnd - levelBegin;
+            daal::threader_for(nLevelNodes, nLevelNodes, [&](size_t iNode) {
+                isSplit[levelBegin + iNode] = splitNode(outData, outDim, dim, indices, nodes[levelBegin + iNode]);
+            });
+
+            size_t nNodes = levelEnd;
+            for (size_t iNode = levelBegin; iNode < levelEnd; iNode++)
+            {
+                KDTreeNode<FPType> & node = nodes[iNode];
+                if (!isSplit[iNode])
+                {
+                    node.leftIndex = node.rightIndex = 0;
+                    continue;
+                }
+                DAAL_ASSERT(nNodes + 2 <= maxNodes);
+
+                const size_t middle = node.begin + (node.end - node.begin) / 2;
+
+                KDTreeNode<FPType> & left  = nodes[nNodes];
+                KDTreeNode<FPType> & right = nodes[nNodes + 1];
+                left.begin                 = node.begin;
+                left.end                   = middle;
+                left.leftIndex             = 0;
+                left.rightIndex            = 0;
+                right.begin                = middle;
+                right.end                  = node.end;
+                right.leftIndex            = 0;
+                right.rightIndex           = 0;
+
+                node.leftIndex  = nNodes;
+                node.rightIndex = nNodes + 1;
+                nNodes += 2;
+            }
+
+            levelBegin = levelEnd;
+            levelEnd   = nNodes;
+            if (levelBegin < levelEnd)
+            {
+                depth++;
+            }
+        }
+        _maxDepth = depth;
+
+        /* Store the points in the order of the leaves so the distances inside a leaf are computed over contiguous memory */
+        _points.reset(nRows * dim);
+        DAAL_CHECK_MALLOC(_points.get());
+        FPType * const points = _points.get();
+
+        ReadRows<FPType, cpu> weightsRows;
+        if (_weights)
+        {
+            weightsRows.set(const_cast<NumericTable *>(_weights), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(weightsRows);
+
+            _pointWeights.reset(nRows);
+            DAAL_CHECK_MALLOC(_pointWeights.get());
+        }
+        const FPType * const weights = weightsRows.get();
+        FPType * const pointWeights  = _pointWeights.get();
+
+        const size_t blockSize = 1024;
+        const size_t nBlocks   = nRows / blockSize + (nRows % blockSize > 0);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i1 = iBlock * blockSize;
+            const size_t i2 = (iBlock + 1 == nBlocks ? nRows : i1 + blockSize);
+
+            for (size_t i = i1; i < i2; i++)
+            {
+                const FPType * const src = &outData[indices[i] * outDim];
+                FPType * const dst       = &points[i * dim];
+                for (size_t d = 0; d < dim; d++)
+                {
+                    dst[d] = src[d];
+                }
+                if (weights)
+                {
+                    pointWeights[i] = weights[indices[i]];
+                }
+            }
+        });
+
+        _isBuilt = true;
+        return services::Status();
+    }
+
+    /* Chooses the cut of the node and reorders its indices so the left half precedes the median.
+       Returns false if the node has to remain a leaf */
+    static bool splitNode(const FPType * const data, size_t stride, size_t dim, size_t * const indices, KDTreeNode<FPType> & node)
+    {
+        const size_t begin = node.begin;
+        const size_t end   = node.end;
+
+        if (end - begin <= leafSize)
+        {
+            return false;
+        }
+
+        size_t splitDim  = 0;
+        FPType maxSpread = 0;
+        for (size_t d = 0; d < dim; d++)
+        {
+            FPType minValue = data[indices[begin] * stride + d];
+            FPType maxValue = minValue;
+            for (size_t i = begin + 1; i < end; i++)
+            {
+                const FPType value = data[indices[i] * stride + d];
+                minValue           = (value < minValue ? value : minValue);
+                maxValue           = (value > maxValue ? value : maxValue);
+            }
+            if (maxValue - minValue > maxSpread)
+            {
+                maxSpread = maxValue - minValue;
+                splitDim  = d;
+            }
+        }
+
+        if (!(maxSpread > 0))
+        {
+            return false;
+        }
+
+        const size_t middle = begin + (end - begin) / 2;
+        selectKth(data, stride, splitDim, indices, begin, end - 1, middle);
+
+        node.dimension = splitDim;
+        node.cutPoint  = data[indices[middle] * stride + splitDim];
+        return true;
+    }
+
+    /* Three-way quickselect over indices[l..r] by the values of the given dimension: places the k-th smallest element
+       at position k, smaller or equal elements to the left of it and greater or equal elements to the right */
+    static void selectKth(const FPType * const data, size_t stride, size_t dimension, size_t * const indices, size_t l, size_t r, size_t k)
+    {
+        while (l < r)
+        {
+            const FPType pivot = data[indices[l + (r - l) / 2] * stride + dimension];
+
+            size_t lt = l;
+            size_t i  = l;
+            size_t gt = r + 1;
+            while (i < gt)
+            {
+                const FPType value = data[indices[i] * stride + dimension];
+                if (value < pivot)
+                {
+                    swap<cpu, size_t>(indices[lt++], indices[i++]);
+                }
+                else if (pivot < value)
+                {
+                    swap<cpu, size_t>(indices[i], indices[--gt]);
+                }
+                else
+                {
+                    i++;
+                }
+            }
+
+            if (k < lt)
+            {
+                r = lt - 1;
+            }
+            else if (k >= gt)
+            {
+                l = gt;
+            }
+            else
+            {
+                return;
+            }
+        }
+    }
+
+    const NumericTable * _inTable;
+    const NumericTable * _outTable;
+    const NumericTable * _weights;
+
+    FPType _eps;
+    FPType _p;
+
+    TArray<KDTreeNode<FPType>, cpu> _nodes;
+    TArray<FPType, cpu> _points;
+    TArray<FPType, cpu> _pointWeights;
+    TArray<size_t, cpu> _indices;
+    size_t _maxDepth;
+    bool _isBuilt;
+};
+
 template <typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType * values, size_t nElements, size_t k)
 {
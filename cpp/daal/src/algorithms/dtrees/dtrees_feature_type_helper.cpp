@@ -120,9 +120,10 @@ services::Status IndexedFeatures::FeatureEntry::allocBorders()
     return binBorders ? services::Status() : services::Status(services::ErrorMemoryAllocationFailed);
 }
 
-services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
+services::Status IndexedFeatures::alloc(size_t nC, size_t nR, size_t sizeOfIndex)
 {
-    const size_t newCapacity = nC * nR;
+    //the capacity is measured in bytes since the size of the index can vary
+    const size_t newCapacity = nC * nR * sizeOfIndex;
     if (_data)
     {
         if (newCapacity > _capacity)
@@ -130,17 +131,18 @@ services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
             services::daal_free(_data);
             _data     = nullptr;
             _capacity = 0;
-            _data     = (IndexType *)services::daal_calloc(sizeof(IndexType) * newCapacity);
+            _data     = (IndexType *)services::daal_calloc(newCapacity);
             DAAL_CHECK_MALLOC(_data);
             _capacity = newCapacity;
         }
     }
     else
     {
-        _data = (IndexType *)services::daal_calloc(sizeof(IndexType) * newCapacity);
+        _data = (IndexType *)services::daal_calloc(newCapacity);
         DAAL_CHECK_MALLOC(_data);
         _capacity = newCapacity;
     }
+    _sizeOfIndex = sizeOfIndex;
     if (_entries)
     {
         delete[] _entries;
@@ -81,7 +81,9 @@ struct BinParams
 //////////////////////////////////////////////////////////////////////////////////////////
 // IndexedFeatures. Creates and stores index of every feature
 // Sorts every feature and creates the mapping: features value -> index of the value
-// in the sorted array of unique values of the feature in increasing order
+// in the sorted array of unique values of the feature in increasing order.
+// Missing (NaN) values of a feature are mapped to the dedicated index missingIndex(),
+// the indices of the other values follow it
 //////////////////////////////////////////////////////////////////////////////////////////
 class IndexedFeatures
 {
@@ -93,6 +95,7 @@ public:
         DAAL_NEW_DELETE();
         IndexType numIndices     = 0;       //number of indices or bins
         ModelFPType * binBorders = nullptr; //right bin borders
+        bool hasMissing          = false;   //the feature has missing values, they are mapped to missingIndex()
 
         services::Status allocBorders();
         ~FeatureEntry();
@@ -105,12 +108,27 @@ public:
     template <typename algorithmFPType, CpuType cpu>
     services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr);
 
+    //creates the index with the indices stored in BinIndexType instead of IndexType.
+    //bFits is false and the index is not valid if the number of indices of a feature does not fit into BinIndexType
+    template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+    services::Status initNarrow(const NumericTable & nt, const FeatureTypes * featureTypes, bool & bFits);
+
     //get max number of indices for that feature
     IndexType numIndices(size_t iCol) const { return _entries[iCol].numIndices; }
 
     //get max number of indices among all features
     IndexType maxNumIndices() const { return _maxNumIndices; }
 
+    //returns true if the feature has missing values
+    bool hasMissing(size_t iCol) const
+    {
+        DAAL_ASSERT(iCol < _nCols);
+        return _entries[iCol].hasMissing;
+    }
+
+    //index of the missing values of a feature, the index is taken only if the feature has missing values
+    static IndexType missingIndex() { return 0; }
+
     //returns true if the feature is mapped to bins
     bool isBinned(size_t iCol) const
     {
@@ -126,14 +144,22 @@ public:
         return _entries[iCol].binBorders[iBin];
     }
 
+    //number of bytes taken by one index
+    size_t sizeOfIndex() const { return _sizeOfIndex; }
+
     //for low-level optimization
-    const IndexType * data(size_t iFeature) const { return (IndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex); }
+    template <typename BinIndexType = IndexType>
+    const BinIndexType * data(size_t iFeature) const
+    {
+        DAAL_ASSERT(sizeof(BinIndexType) == _sizeOfIndex);
+        return (BinIndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex);
+    }
 
     size_t nRows() const { return _nRows; }
     size_t nCols() const { return _nCols; }
 
 protected:
-    services::Status alloc(size_t nCols, size_t nRows);
+    services::Status alloc(size_t nCols, size_t nRows, size_t sizeOfIndex = sizeof(IndexType));
 
 protected:
     IndexType * _data;
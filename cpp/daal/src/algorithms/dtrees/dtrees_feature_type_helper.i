@@ -26,6 +26,8 @@
 #include "src/algorithms/service_sort.h"
 #include "src/algorithms/dtrees/service_array.h"
 #include "src/externals/service_memory.h"
+#include "src/services/service_utils.h"
+#include "services/daal_atomic_int.h"
 
 namespace daal
 {
@@ -64,19 +66,25 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                       bool bUnorderedFeature)
     {
-        Status s = this->getSorted(nt, iCol, nRows);
+        size_t nValid = 0;
+        Status s      = this->getSorted(nt, iCol, nRows, nValid);
         if (!s) return s;
         const FeatureIdx * index = _index.get();
-        if (index[0].key == index[nRows - 1].key)
+        entry.hasMissing         = (nValid < nRows);
+        for (size_t i = nValid; i < nRows; ++i) aRes[index[i].val] = IndexedFeatures::missingIndex();
+        //indices of the values follow the index of the missing values
+        const IndexType iFirst = IndexType(entry.hasMissing);
+        if (!nValid || (index[0].key == index[nValid - 1].key))
         {
-            entry.numIndices = 1;
-            for (size_t i = 0; i < nRows; ++i) aRes[i] = 0;
+            entry.numIndices = iFirst + IndexType(nValid ? 1 : 0);
+            for (size_t i = 0; i < nValid; ++i) aRes[index[i].val] = iFirst;
+            if (maxNumDiffValues < entry.numIndices) maxNumDiffValues = entry.numIndices;
             return s;
         }
-        IndexType iUnique    = 0;
+        IndexType iUnique    = iFirst;
         aRes[index[0].val]   = iUnique;
         algorithmFPType prev = index[0].key;
-        for (size_t i = 1; i < nRows; ++i)
+        for (size_t i = 1; i < nValid; ++i)
         {
             const IndexType idx = index[i].val;
             if (index[i].key == prev)
@@ -97,17 +105,22 @@ public:
     size_t maxNumDiffValues;
 
 protected:
-    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
+    //sorts the values of the feature, missing values are placed after the nValid sorted ones
+    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows, size_t & nValid)
     {
         const algorithmFPType * pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx * index = _index.get();
+        size_t iValid      = 0;
+        size_t iMissing    = nRows;
         for (size_t i = 0; i < nRows; ++i)
         {
-            index[i].key = pBlock[i];
-            index[i].val = i;
+            FeatureIdx & entry = (services::internal::isNaN<cpu>(pBlock[i]) ? index[--iMissing] : index[iValid++]);
+            entry.key          = pBlock[i];
+            entry.val          = i;
         }
-        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
+        nValid = iValid;
+        if (nValid) daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nValid, index);
         return Status();
     }
 
@@ -125,7 +138,7 @@ struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
                                        bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
 private:
-    services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nBins, size_t nRows);
+    services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nBins, size_t nValid);
 
 private:
     const BinParams _prm;
@@ -161,30 +174,30 @@ const T * upper_bound(const T * first, const T * last, const T & value)
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry,
-                                                                                               IndexType * aRes, size_t nBins, size_t nRows)
+                                                                                               IndexType * aRes, size_t nBins, size_t nValid)
 {
     const typename super::FeatureIdx * index = this->_index.get();
 
-    if (nBins == 1)
-    {
-        entry.numIndices   = 1;
-        services::Status s = entry.allocBorders();
-        DAAL_CHECK(s, s);
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
+    //bins of the values follow the bin of the missing values
+    const IndexType iFirst = IndexType(entry.hasMissing);
+    entry.numIndices       = iFirst + nBins;
+    services::Status s     = entry.allocBorders();
+    if (!s) return s;
+    if (entry.hasMissing) entry.binBorders[IndexedFeatures::missingIndex()] = index[nValid].key; //NaN
 
-        entry.binBorders[0] = index[nRows - 1].key;
-        _bins[0]            = nRows;
-        return Status();
+    if (nBins == 1 && !entry.hasMissing)
+    {
+        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nValid);
+        entry.binBorders[0] = index[nValid - 1].key;
+        _bins[0]            = nValid;
+        return s;
     }
-    entry.numIndices   = nBins;
-    services::Status s = entry.allocBorders();
-    if (!s) return s;
 
     size_t i = 0;
     for (size_t iBin = 0; iBin < nBins; ++iBin)
     {
-        for (size_t n = i + _bins[iBin]; i < n; ++i) aRes[index[i].val] = iBin;
-        entry.binBorders[iBin] = index[i - 1].key;
+        for (size_t n = i + _bins[iBin]; i < n; ++i) aRes[index[i].val] = iFirst + iBin;
+        entry.binBorders[iFirst + iBin] = index[i - 1].key;
     }
     if (this->maxNumDiffValues < entry.numIndices) this->maxNumDiffValues = entry.numIndices;
     return s;
@@ -196,26 +209,27 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
 {
     if (bUnorderedFeature || nRows <= _prm.maxBins) return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
 
-    Status s = this->getSorted(nt, iCol, nRows);
+    size_t nValid = 0;
+    Status s      = this->getSorted(nt, iCol, nRows, nValid);
     if (!s) return s;
 
     const typename super::FeatureIdx * index = this->_index.get();
-    if (index[0].key == index[nRows - 1].key)
+    entry.hasMissing                         = (nValid < nRows);
+    for (size_t i = nValid; i < nRows; ++i) aRes[index[i].val] = IndexedFeatures::missingIndex();
+    if (!nValid || (index[0].key == index[nValid - 1].key))
     {
-        _bins[0] = nRows;
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
-
-        entry.numIndices = 1;
-        s |= entry.allocBorders();
-        DAAL_CHECK(s, s);
-        entry.binBorders[0] = index[nRows - 1].key;
-        return s;
+        _bins[0] = nValid;
+        return assignIndexAccordingToBins(entry, aRes, nValid ? 1 : 0, nValid);
     }
 
+    //one of the bins is taken by the missing values
+    const size_t maxBins = ((entry.hasMissing && _prm.maxBins > 1) ? _prm.maxBins - 1 : _prm.maxBins);
+    if (nValid <= maxBins) return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
+
     size_t nBins         = 0;
-    const size_t binSize = nRows / _prm.maxBins;
+    const size_t binSize = nValid / maxBins;
     size_t i             = 0;
-    for (; (i + binSize < nRows) && (nBins < _prm.maxBins);)
+    for (; (i + binSize < nValid) && (nBins < maxBins);)
     {
         //trying to make a bin of size binSize
         size_t newBinSize                     = binSize;
@@ -228,10 +242,10 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
             ++iRight;
             size_t r = iRight + binSize;
             //at first, roughly locate the value bigger than iRight, jumping by binSize to the right
-            for (; (r < nRows) && (index[r].key == ri.key); r += binSize)
+            for (; (r < nValid) && (index[r].key == ri.key); r += binSize)
             {
             }
-            if (r > nRows) r = nRows;
+            if (r > nValid) r = nValid;
             //then locate a new border as the upper_bound between this rough value and iRight
             iRight = upper_bound<typename super::FeatureIdx>(index + iRight + 1, index + r, ri) - index;
             //this is the size of the bin
@@ -265,10 +279,10 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
         append(_bins, nBins, newBinSize);
         i += newBinSize;
     }
-    if (i < nRows)
+    if (i < nValid)
     {
-        size_t newBinSize = nRows - i;
-        if (((nBins < _prm.maxBins) && (newBinSize >= _prm.minBinSize)) || nBins == 0)
+        size_t newBinSize = nValid - i;
+        if (((nBins < maxBins) && (newBinSize >= _prm.minBinSize)) || nBins == 0)
         {
             append(_bins, nBins, newBinSize);
         }
@@ -282,7 +296,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     //run-time check for bins correctness
     size_t nTotal = 0;
     for(size_t i = 0; i < nBins; nTotal += _bins[i], ++i);
-    DAAL_ASSERT(nTotal == nRows);
+    DAAL_ASSERT(nTotal == nValid);
     size_t iBorder = 0;
     for(size_t i = 1; i < nBins; ++i)
     {
@@ -291,7 +305,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     }
     #endif
 #endif
-    return assignIndexAccordingToBins(entry, aRes, nBins, nRows);
+    return assignIndexAccordingToBins(entry, aRes, nBins, nValid);
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -339,6 +353,81 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
     return safeStat.detach();
 }
 
+template <typename BinIndexType, typename algorithmFPType, CpuType cpu>
+struct NarrowColIndexTask : public ColIndexTask<IndexedFeatures::IndexType, algorithmFPType, cpu>
+{
+    typedef ColIndexTask<IndexedFeatures::IndexType, algorithmFPType, cpu> super;
+    NarrowColIndexTask(size_t nRows) : super(nRows), _wideIndex(nRows) {}
+    bool isValid() const { return super::isValid() && _wideIndex.get(); }
+
+    //indexes the column in the buffer of the task and stores the indices in BinIndexType,
+    //bFits is false if the number of indices of the column does not fit into BinIndexType
+    services::Status makeNarrowIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, BinIndexType * aRes, size_t iCol, size_t nRows,
+                                     bool bUnorderedFeature, bool & bFits)
+    {
+        IndexedFeatures::IndexType * const wideIndex = _wideIndex.get();
+        services::Status s                           = this->makeIndex(nt, entry, wideIndex, iCol, nRows, bUnorderedFeature);
+        bFits                                        = (size_t(entry.numIndices) <= (size_t(1) << (8 * sizeof(BinIndexType))));
+        if (!s || !bFits) return s;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; ++i) aRes[i] = BinIndexType(wideIndex[i]);
+        return s;
+    }
+
+protected:
+    TVector<IndexedFeatures::IndexType, cpu, DefaultAllocator<cpu> > _wideIndex;
+};
+
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status IndexedFeatures::initNarrow(const NumericTable & nt, const FeatureTypes * featureTypes, bool & bFits)
+{
+    dtrees::internal::FeatureTypes autoFT;
+    if (!featureTypes)
+    {
+        DAAL_CHECK_MALLOC(autoFT.init(nt));
+        featureTypes = &autoFT;
+    }
+
+    _maxNumIndices     = 0;
+    services::Status s = alloc(nt.getNumberOfColumns(), nt.getNumberOfRows(), sizeof(BinIndexType));
+    if (!s) return s;
+
+    const size_t nC = nt.getNumberOfColumns();
+    typedef NarrowColIndexTask<BinIndexType, algorithmFPType, cpu> TlsTask;
+
+    daal::tls<TlsTask *> tlsData([=, &nt]() -> TlsTask * {
+        TlsTask * res = new TlsTask(nt.getNumberOfRows());
+        if (res && !res->isValid())
+        {
+            delete res;
+            res = nullptr;
+        }
+        return res;
+    });
+
+    //the columns are not indexed any more once one of them does not fit into BinIndexType
+    daal::services::AtomicInt nNotFitting(0);
+    BinIndexType * const narrowData = (BinIndexType *)_data;
+    SafeStatus safeStat;
+    daal::threader_for(nC, nC, [&](size_t iCol) {
+        if (nNotFitting.get()) return;
+        //in case of single thread no need to allocate
+        TlsTask * task = tlsData.local();
+        DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
+        bool bColFits = true;
+        safeStat |= task->makeNarrowIndex(const_cast<NumericTable &>(nt), _entries[iCol], narrowData + iCol * nRows(), iCol, nRows(),
+                                          featureTypes->isUnordered(iCol), bColFits);
+        if (!bColFits) nNotFitting.inc();
+    });
+    tlsData.reduce([&](TlsTask * task) -> void {
+        if (_maxNumIndices < task->maxNumDiffValues) _maxNumIndices = task->maxNumDiffValues;
+        delete task;
+    });
+    bFits = !nNotFitting.get();
+    return safeStat.detach();
+}
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
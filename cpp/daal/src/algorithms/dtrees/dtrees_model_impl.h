@@ -111,8 +111,9 @@ struct TreeNodeSplit : public TreeNodeBase
     TreeNodeBase * kid[2];
     int featureIdx;
     bool featureUnordered;
+    bool defaultLeft; //observations with missing value of the ordered feature go to the left kid
 
-    TreeNodeSplit() { kid[0] = kid[1] = nullptr; }
+    TreeNodeSplit() : defaultLeft(true) { kid[0] = kid[1] = nullptr; }
     const TreeNodeBase * left() const { return kid[0]; }
     const TreeNodeBase * right() const { return kid[1]; }
     TreeNodeBase * left() { return kid[0]; }
@@ -0,0 +1,179 @@
+/* file: dtrees_predict_compiled_impl.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Compact inference layout of the decision forest model. The trees are stored
+//  in the breadth-first order in the structure-of-arrays form, so that the nodes
+//  of one level are contiguous in memory and a split visit reads 2 x int32 and
+//  one algorithmFPType instead of the 24 bytes of DecisionTreeNode.
+//--
+*/
+
+#ifndef __DTREES_PREDICT_COMPILED_IMPL_I__
+#define __DTREES_PREDICT_COMPILED_IMPL_I__
+
+#include "src/algorithms/dtrees/dtrees_model_impl.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace prediction
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// Trees of the model in the breadth-first structure-of-arrays layout.
+// For a split node featureIndex >= 0 and leftChild is the index of the left kid in the tree,
+// the right kid follows the left one. For a leaf featureIndex == -1, leftChild is the class index
+// and threshold is the response. nodeIndex keeps the index of the node in the DecisionTreeTable
+// to access the per-node data of the model (e.g. class probabilities).
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class CompiledForest
+{
+public:
+    typedef int32_t IndexType; /* tree size and number of classes are fit in to 2^31 */
+
+    CompiledForest() : _nTrees(0) {}
+
+    services::Status build(const dtrees::internal::ModelImpl & model);
+
+    size_t size() const { return _nTrees; }
+    size_t getNumberOfNodes() const { return _nTrees ? _treeOffset[_nTrees] : 0; }
+    size_t getSizeInBytes() const { return getNumberOfNodes() * (3 * sizeof(IndexType) + sizeof(algorithmFPType)); }
+
+    size_t depth(size_t iTree) const { return _depth[iTree]; }
+    const IndexType * featureIndexes(size_t iTree) const { return _featureIndex.get() + _treeOffset[iTree]; }
+    const IndexType * leftChildren(size_t iTree) const { return _leftChild.get() + _treeOffset[iTree]; }
+    const algorithmFPType * thresholds(size_t iTree) const { return _threshold.get() + _treeOffset[iTree]; }
+    const IndexType * nodeIndexes(size_t iTree) const { return _nodeIndex.get() + _treeOffset[iTree]; }
+
+    /* Returns the leaf of the tree reached by one observation, unordered is nullptr if all the features are ordered */
+    IndexType findLeaf(size_t iTree, const algorithmFPType * x, const bool * unordered) const
+    {
+        const IndexType * const fi       = featureIndexes(iTree);
+        const IndexType * const lc       = leftChildren(iTree);
+        const algorithmFPType * const fv = thresholds(iTree);
+        IndexType n                      = 0;
+        for (IndexType iFeature = fi[0]; iFeature >= 0; iFeature = fi[n])
+        {
+            const algorithmFPType xValue = x[iFeature];
+            const bool sn                = (unordered && unordered[iFeature]) ? (int(xValue) != int(fv[n])) : (xValue > fv[n]);
+            n                            = lc[n] + IndexType(sn);
+        }
+        return n;
+    }
+
+protected:
+    static size_t compileTree(const dtrees::internal::DecisionTreeNode * const aNode, const size_t nNodesInTable, IndexType * const fi,
+                              IndexType * const lc, algorithmFPType * const fv, IndexType * const ni);
+
+private:
+    size_t _nTrees;
+    services::internal::TArray<size_t, cpu> _treeOffset;
+    services::internal::TArray<size_t, cpu> _depth;
+    services::internal::TArray<IndexType, cpu> _featureIndex;
+    services::internal::TArray<IndexType, cpu> _leftChild;
+    services::internal::TArray<algorithmFPType, cpu> _threshold;
+    services::internal::TArray<IndexType, cpu> _nodeIndex;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status CompiledForest<algorithmFPType, cpu>::build(const dtrees::internal::ModelImpl & model)
+{
+    const size_t nTrees = model.size();
+    _nTrees             = 0;
+    _treeOffset.reset(nTrees + 1);
+    _depth.reset(nTrees);
+    DAAL_CHECK_MALLOC(_treeOffset.get() && _depth.get());
+
+    _treeOffset[0] = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const size_t nNodesInTable = model.at(iTree)->getNumberOfRows();
+        DAAL_CHECK(nNodesInTable <= size_t(services::internal::MaxVal<IndexType>::get()), services::ErrorIncorrectSizeOfModel);
+        _treeOffset[iTree + 1] = _treeOffset[iTree] + nNodesInTable;
+    }
+
+    const size_t nNodes = _treeOffset[nTrees];
+    _featureIndex.reset(nNodes);
+    _leftChild.reset(nNodes);
+    _threshold.reset(nNodes);
+    _nodeIndex.reset(nNodes);
+    DAAL_CHECK_MALLOC(_featureIndex.get() && _leftChild.get() && _threshold.get() && _nodeIndex.get());
+
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree) {
+        const dtrees::internal::DecisionTreeTable * const pTable = model.at(iTree);
+        const size_t offset                                      = _treeOffset[iTree];
+        _depth[iTree] = compileTree((const dtrees::internal::DecisionTreeNode *)pTable->getArray(), pTable->getNumberOfRows(),
+                                    _featureIndex.get() + offset, _leftChild.get() + offset, _threshold.get() + offset, _nodeIndex.get() + offset);
+    });
+    _nTrees = nTrees;
+    return services::Status();
+}
+
+/* Writes the reachable nodes of the tree level by level and returns the number of splits on the longest path */
+template <typename algorithmFPType, CpuType cpu>
+size_t CompiledForest<algorithmFPType, cpu>::compileTree(const dtrees::internal::DecisionTreeNode * const aNode, const size_t nNodesInTable,
+                                                         IndexType * const fi, IndexType * const lc, algorithmFPType * const fv,
+                                                         IndexType * const ni)
+{
+    if (!nNodesInTable) return 0;
+    ni[0]         = 0;
+    size_t nNodes = 1;
+    size_t depth  = 0;
+    for (size_t iBegin = 0, iEnd = 1; iBegin < iEnd; iBegin = iEnd, iEnd = nNodes)
+    {
+        for (size_t i = iBegin; i < iEnd; ++i)
+        {
+            const dtrees::internal::DecisionTreeNode & node = aNode[ni[i]];
+            fv[i]                                           = algorithmFPType(node.featureValueOrResponse);
+            if (node.isSplit())
+            {
+                DAAL_ASSERT(node.leftIndexOrClass > 0);
+                DAAL_ASSERT(nNodes + 2 <= nNodesInTable);
+                fi[i]          = IndexType(node.featureIndex);
+                lc[i]          = IndexType(nNodes);
+                ni[nNodes]     = IndexType(node.leftIndexOrClass);
+                ni[nNodes + 1] = IndexType(node.leftIndexOrClass + 1);
+                nNodes += 2;
+            }
+            else
+            {
+                fi[i] = -1;
+                lc[i] = IndexType(node.leftIndexOrClass);
+            }
+        }
+        if (nNodes > iEnd) ++depth;
+    }
+    return depth;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -44,12 +44,22 @@ namespace prediction
 namespace internal
 {
 using namespace dtrees::internal;
+
+//Returns the index of the kid of the split on the ordered feature, missing value goes to the default kid
+template <typename algorithmFPType, typename SplitType, CpuType cpu>
+DAAL_FORCEINLINE int orderedSplitKid(const SplitType & split, const algorithmFPType x)
+{
+    return services::internal::isNaN<cpu>(x) ? int(!split.defaultLeft) :
+                                               daal::services::internal::SignBit<algorithmFPType, cpu>::get(split.featureValue - x);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Common service function. Finds node corresponding to the given observation
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, typename TreeType, CpuType cpu>
 const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree & t, const algorithmFPType * x)
 {
+    typedef typename TreeType::NodeType::Split SplitType;
     const TreeType & tree                           = static_cast<const TreeType &>(t);
     const typename TreeType::NodeType::Base * pNode = tree.top();
     if (tree.hasUnorderedFeatureSplits())
@@ -57,9 +67,8 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
         for (; pNode && pNode->isSplit();)
         {
             auto pSplit  = TreeType::NodeType::castSplit(pNode);
-            const int sn = (pSplit->featureUnordered ?
-                                (int(x[pSplit->featureIdx]) != int(pSplit->featureValue)) :
-                                daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]));
+            const int sn = (pSplit->featureUnordered ? (int(x[pSplit->featureIdx]) != int(pSplit->featureValue)) :
+                                                       orderedSplitKid<algorithmFPType, SplitType, cpu>(*pSplit, x[pSplit->featureIdx]));
             pNode        = pSplit->kid[sn];
         }
     }
@@ -68,7 +77,7 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
         for (; pNode && pNode->isSplit();)
         {
             auto pSplit  = TreeType::NodeType::castSplit(pNode);
-            const int sn = daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]);
+            const int sn = orderedSplitKid<algorithmFPType, SplitType, cpu>(*pSplit, x[pSplit->featureIdx]);
             pNode        = pSplit->kid[sn];
         }
     }
@@ -110,6 +119,208 @@ const DecisionTreeNode * findNode(const dtrees::internal::DecisionTreeTable & t,
     return pNode;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Finds the leaves reached by a block of observations, which move
+// through the tree in lock-step one level per step. Only ordered splits are supported.
+// On output aIdx[i] is the index of the leaf of the i-th observation in the table
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+inline void findLeaves(const DecisionTreeNode * const aNode, const algorithmFPType * const x, const size_t nRows, const size_t nCols,
+                       uint32_t * const aIdx)
+{
+    for (size_t i = 0; i < nRows; ++i) aIdx[i] = 0;
+    for (bool bSplit = aNode[0].isSplit(); bSplit;)
+    {
+        bSplit = false;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const DecisionTreeNode & node = aNode[aIdx[i]];
+            if (node.isSplit())
+            {
+                aIdx[i] = uint32_t(node.leftIndexOrClass + (x[i * nCols + node.featureIndex] > node.featureValue()));
+                bSplit  = true;
+            }
+        }
+    }
+}
+
+#if defined(__INTEL_COMPILER)
+
+/* The fields of DecisionTreeNode are gathered with scale 8 from the byte offset 3 * index, since sizeof(DecisionTreeNode) == 24.
+   The observations are compared in double precision the same way as in findNode */
+template <>
+inline void findLeaves<float, avx512>(const DecisionTreeNode * const aNode, const float * const x, const size_t nRows, const size_t nCols,
+                                      uint32_t * const aIdx)
+{
+    DAAL_ASSERT(sizeof(DecisionTreeNode) == 24);
+    const char * const pFeatureIndex = (const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureIndex);
+    const char * const pLeftIndex    = (const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, leftIndexOrClass);
+    const char * const pFeatureValue = (const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse);
+
+    const __m512i rowOffsets = _mm512_mullo_epi32(_mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi32(nCols));
+    const __m512i three      = _mm512_set1_epi32(3);
+    const __m512i one        = _mm512_set1_epi32(1);
+    const __m512i nOne       = _mm512_set1_epi32(-1);
+    const __m512i zero       = _mm512_setzero_si512();
+    const __m512d zero_pd    = _mm512_setzero_pd();
+    const __m512 zero_ps     = _mm512_setzero_ps();
+
+    for (size_t i = 0; i < nRows; i += 16)
+    {
+        const size_t nInBlock      = (nRows - i < 16 ? nRows - i : 16);
+        const __mmask16 blockMask  = __mmask16((1u << nInBlock) - 1);
+        const float * const xBlock = x + i * nCols;
+        __mmask16 isSplit          = blockMask;
+        __m512i idx                = zero;
+        while (isSplit)
+        {
+            const __m512i idx3   = _mm512_mullo_epi32(idx, three);
+            const __m512i fi     = _mm512_mask_i32gather_epi32(nOne, isSplit, idx3, pFeatureIndex, 8);
+            isSplit              = _mm512_mask_cmp_epi32_mask(isSplit, fi, nOne, _MM_CMPINT_NE);
+            const __m512i lc     = _mm512_mask_i32gather_epi32(zero, isSplit, idx3, pLeftIndex, 8);
+            const __m512d spLo   = _mm512_mask_i32gather_pd(zero_pd, __mmask8(isSplit), _mm512_castsi512_si256(idx3), pFeatureValue, 8);
+            const __m512d spHi   = _mm512_mask_i32gather_pd(zero_pd, __mmask8(isSplit >> 8), _mm512_extracti64x4_epi64(idx3, 1), pFeatureValue, 8);
+            const __m512 xv      = _mm512_mask_i32gather_ps(zero_ps, isSplit, _mm512_add_epi32(fi, rowOffsets), xBlock, 4);
+            const __m512d xLo    = _mm512_cvtps_pd(_mm512_castps512_ps256(xv));
+            const __m512d xHi    = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(xv), 1)));
+            const __mmask16 isGt = __mmask16(_mm512_cmp_pd_mask(xLo, spLo, _CMP_GT_OS) | (_mm512_cmp_pd_mask(xHi, spHi, _CMP_GT_OS) << 8));
+            idx                  = _mm512_mask_mov_epi32(idx, isSplit, _mm512_mask_add_epi32(lc, isGt, lc, one));
+        }
+        _mm512_mask_storeu_epi32(aIdx + i, blockMask, idx);
+    }
+}
+
+template <>
+inline void findLeaves<double, avx512>(const DecisionTreeNode * const aNode, const double * const x, const size_t nRows, const size_t nCols,
+                                       uint32_t * const aIdx)
+{
+    DAAL_ASSERT(sizeof(DecisionTreeNode) == 24);
+    const char * const pFeatureIndex = (const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureIndex);
+    const char * const pLeftIndex    = (const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, leftIndexOrClass);
+    const char * const pFeatureValue = (const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse);
+
+    const __m256i rowOffsets = _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0), _mm256_set1_epi32(nCols));
+    const __m256i three      = _mm256_set1_epi32(3);
+    const __m256i one        = _mm256_set1_epi32(1);
+    const __m256i nOne       = _mm256_set1_epi32(-1);
+    const __m256i zero       = _mm256_setzero_si256();
+    const __m512d zero_pd    = _mm512_setzero_pd();
+
+    for (size_t i = 0; i < nRows; i += 8)
+    {
+        const size_t nInBlock       = (nRows - i < 8 ? nRows - i : 8);
+        const __mmask8 blockMask    = __mmask8((1u << nInBlock) - 1);
+        const double * const xBlock = x + i * nCols;
+        __mmask8 isSplit            = blockMask;
+        __m256i idx                 = zero;
+        while (isSplit)
+        {
+            const __m256i idx3  = _mm256_mullo_epi32(idx, three);
+            const __m256i fi    = _mm256_mmask_i32gather_epi32(nOne, isSplit, idx3, pFeatureIndex, 8);
+            isSplit             = _mm256_mask_cmp_epi32_mask(isSplit, fi, nOne, _MM_CMPINT_NE);
+            const __m256i lc    = _mm256_mmask_i32gather_epi32(zero, isSplit, idx3, pLeftIndex, 8);
+            const __m512d sp    = _mm512_mask_i32gather_pd(zero_pd, isSplit, idx3, pFeatureValue, 8);
+            const __m512d xv    = _mm512_mask_i32gather_pd(zero_pd, isSplit, _mm256_add_epi32(fi, rowOffsets), xBlock, 8);
+            const __mmask8 isGt = _mm512_cmp_pd_mask(xv, sp, _CMP_GT_OS);
+            idx                 = _mm256_mask_mov_epi32(idx, isSplit, _mm256_mask_add_epi32(lc, isGt, lc, one));
+        }
+        _mm256_mask_storeu_epi32(aIdx + i, blockMask, idx);
+    }
+}
+
+/* AVX2 gathers take the mask as a vector, a true comparison is all ones, i.e. -1 */
+template <>
+inline void findLeaves<float, avx2>(const DecisionTreeNode * const aNode, const float * const x, const size_t nRows, const size_t nCols,
+                                    uint32_t * const aIdx)
+{
+    DAAL_ASSERT(sizeof(DecisionTreeNode) == 24);
+    const int * const pFeatureIndex = (const int *)((const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureIndex));
+    const int * const pLeftIndex    = (const int *)((const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, leftIndexOrClass));
+    const double * const pFeatureValue =
+        (const double *)((const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse));
+
+    const __m256i lanes      = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256i rowOffsets = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(nCols));
+    const __m256i evenLanes  = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    const __m256i three      = _mm256_set1_epi32(3);
+    const __m256i nOne       = _mm256_set1_epi32(-1);
+    const __m256i zero       = _mm256_setzero_si256();
+    const __m256d zero_pd    = _mm256_setzero_pd();
+    const __m256 zero_ps     = _mm256_setzero_ps();
+
+    for (size_t i = 0; i < nRows; i += 8)
+    {
+        const size_t nInBlock      = (nRows - i < 8 ? nRows - i : 8);
+        const __m256i blockMask    = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(nInBlock)), lanes);
+        const float * const xBlock = x + i * nCols;
+        __m256i isSplit            = blockMask;
+        __m256i idx                = zero;
+        while (!_mm256_testz_si256(isSplit, isSplit))
+        {
+            const __m256i idx3    = _mm256_mullo_epi32(idx, three);
+            const __m256i fi      = _mm256_mask_i32gather_epi32(nOne, pFeatureIndex, idx3, isSplit, 8);
+            isSplit               = _mm256_andnot_si256(_mm256_cmpeq_epi32(fi, nOne), isSplit);
+            const __m256i lc      = _mm256_mask_i32gather_epi32(zero, pLeftIndex, idx3, isSplit, 8);
+            const __m256d maskLo  = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(isSplit)));
+            const __m256d maskHi  = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(isSplit, 1)));
+            const __m256d spLo    = _mm256_mask_i32gather_pd(zero_pd, pFeatureValue, _mm256_castsi256_si128(idx3), maskLo, 8);
+            const __m256d spHi    = _mm256_mask_i32gather_pd(zero_pd, pFeatureValue, _mm256_extracti128_si256(idx3, 1), maskHi, 8);
+            const __m256 xv       = _mm256_mask_i32gather_ps(zero_ps, xBlock, _mm256_add_epi32(fi, rowOffsets), _mm256_castsi256_ps(isSplit), 4);
+            const __m256i isGtLo  = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(xv)), spLo, _CMP_GT_OS));
+            const __m256i isGtHi  = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(xv, 1)), spHi, _CMP_GT_OS));
+            const __m128i isGtLo4 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(isGtLo, evenLanes));
+            const __m128i isGtHi4 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(isGtHi, evenLanes));
+            const __m256i isGt    = _mm256_inserti128_si256(_mm256_castsi128_si256(isGtLo4), isGtHi4, 1);
+            idx                   = _mm256_blendv_epi8(idx, _mm256_sub_epi32(lc, isGt), isSplit);
+        }
+        _mm256_maskstore_epi32((int *)(aIdx + i), blockMask, idx);
+    }
+}
+
+template <>
+inline void findLeaves<double, avx2>(const DecisionTreeNode * const aNode, const double * const x, const size_t nRows, const size_t nCols,
+                                     uint32_t * const aIdx)
+{
+    DAAL_ASSERT(sizeof(DecisionTreeNode) == 24);
+    const int * const pFeatureIndex = (const int *)((const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureIndex));
+    const int * const pLeftIndex    = (const int *)((const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, leftIndexOrClass));
+    const double * const pFeatureValue =
+        (const double *)((const char *)aNode + DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse));
+
+    const __m128i lanes      = _mm_set_epi32(3, 2, 1, 0);
+    const __m128i rowOffsets = _mm_mullo_epi32(lanes, _mm_set1_epi32(nCols));
+    const __m256i evenLanes  = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    const __m128i three      = _mm_set1_epi32(3);
+    const __m128i nOne       = _mm_set1_epi32(-1);
+    const __m128i zero       = _mm_setzero_si128();
+    const __m256d zero_pd    = _mm256_setzero_pd();
+
+    for (size_t i = 0; i < nRows; i += 4)
+    {
+        const size_t nInBlock       = (nRows - i < 4 ? nRows - i : 4);
+        const __m128i blockMask     = _mm_cmpgt_epi32(_mm_set1_epi32(int(nInBlock)), lanes);
+        const double * const xBlock = x + i * nCols;
+        __m128i isSplit             = blockMask;
+        __m128i idx                 = zero;
+        while (!_mm_testz_si128(isSplit, isSplit))
+        {
+            const __m128i idx3   = _mm_mullo_epi32(idx, three);
+            const __m128i fi     = _mm_mask_i32gather_epi32(nOne, pFeatureIndex, idx3, isSplit, 8);
+            isSplit              = _mm_andnot_si128(_mm_cmpeq_epi32(fi, nOne), isSplit);
+            const __m128i lc     = _mm_mask_i32gather_epi32(zero, pLeftIndex, idx3, isSplit, 8);
+            const __m256d mask   = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(isSplit));
+            const __m256d sp     = _mm256_mask_i32gather_pd(zero_pd, pFeatureValue, idx3, mask, 8);
+            const __m256d xv     = _mm256_mask_i32gather_pd(zero_pd, xBlock, _mm_add_epi32(fi, rowOffsets), mask, 8);
+            const __m256i isGt64 = _mm256_castpd_si256(_mm256_cmp_pd(xv, sp, _CMP_GT_OS));
+            const __m128i isGt   = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(isGt64, evenLanes));
+            idx                  = _mm_blendv_epi8(idx, _mm_sub_epi32(lc, isGt), isSplit);
+        }
+        _mm_maskstore_epi32((int *)(aIdx + i), blockMask, idx);
+    }
+}
+
+#endif
+
 template <typename algorithmFPType>
 struct TileDimensions
 {
@@ -110,8 +110,9 @@ struct SplitData
     size_t nLeft;
     size_t iStart;
     bool featureUnordered;
-    SplitData() : impurityDecrease(-daal::services::internal::MaxVal<algorithmFPType>::get()) {}
-    SplitData(algorithmFPType impDecr, bool bFeatureUnordered) : impurityDecrease(impDecr), featureUnordered(bFeatureUnordered) {}
+    bool defaultLeft; //observations with missing value of the feature go to the left son
+    SplitData() : impurityDecrease(-daal::services::internal::MaxVal<algorithmFPType>::get()), defaultLeft(true) {}
+    SplitData(algorithmFPType impDecr, bool bFeatureUnordered) : impurityDecrease(impDecr), featureUnordered(bFeatureUnordered), defaultLeft(true) {}
     SplitData(const SplitData & o) = delete;
     void copyTo(SplitData & o) const
     {
@@ -120,6 +121,7 @@ struct SplitData
         o.iStart           = iStart;
         o.left             = left;
         o.featureUnordered = featureUnordered;
+        o.defaultLeft      = defaultLeft;
         o.impurityDecrease = impurityDecrease;
     }
 };
@@ -177,7 +179,7 @@ protected:
 // Keeps indices of the bootstrap samples and provides optimal access to columns in case
 // of homogenious numeric table
 //////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, typename TResponse, CpuType cpu>
+template <typename algorithmFPType, typename TResponse, typename BinIndexType, CpuType cpu>
 class DataHelper : public DataHelperBase<algorithmFPType, cpu>
 {
 public:
@@ -281,14 +283,14 @@ public:
     bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n) const
     {
         if (this->indexedFeatures().numIndices(iFeature) == 1) return false; //single value only
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        const auto aResponse                              = this->_aResponse.get();
-        const IndexedFeatures::IndexType idx0             = indexedFeature[aResponse[aIdx[0]].idx];
-        size_t i                                          = 1;
+        const BinIndexType * indexedFeature = this->indexedFeatures().template data<BinIndexType>(iFeature);
+        const auto aResponse                = this->_aResponse.get();
+        const BinIndexType idx0             = indexedFeature[aResponse[aIdx[0]].idx];
+        size_t i                            = 1;
         for (; i < n; ++i)
         {
-            const Response & r                   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const Response & r     = aResponse[aIdx[i]];
+            const BinIndexType idx = indexedFeature[r.idx];
             if (idx != idx0) break;
         }
         return (i != n);
@@ -0,0 +1,298 @@
+/* file: df_classification_predict_dense_compiled_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of decision forest classification predictions calculation
+//  on the compact breadth-first layout of the trees (compiledDense) method.
+//--
+*/
+
+#ifndef __DF_CLASSIFICATION_PREDICT_DENSE_COMPILED_BATCH_IMPL_I__
+#define __DF_CLASSIFICATION_PREDICT_DENSE_COMPILED_BATCH_IMPL_I__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_predict_dense_default_batch.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_predict_compiled_impl.i"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_environment.h"
+#include "src/services/service_utils.h"
+#include "src/threading/threading.h"
+#include "src/externals/service_ittnotify.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+DAAL_ITTNOTIFY_DOMAIN(decision_forest.classification.predict.dense.compiled);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+#define _COMPILED_BLOCK_SIZE 64 /* number of observations evaluated by one visit of a tree */
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// PredictClassificationCompiledTask
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class PredictClassificationCompiledTask
+{
+public:
+    typedef dtrees::prediction::internal::CompiledForest<algorithmFPType, cpu> CompiledForestType;
+    typedef typename CompiledForestType::IndexType IndexType;
+
+    PredictClassificationCompiledTask()
+        : _data(nullptr), _res(nullptr), _prob(nullptr), _model(nullptr), _cachedModel(nullptr), _nClasses(0), _votingMethod(lastResultId)
+    {}
+
+    void setParams(const NumericTable * const x, NumericTable * const y, NumericTable * const prob, const dtrees::internal::ModelImpl * const m,
+                   const size_t nClasses, const VotingMethod votingMethod)
+    {
+        _data         = x;
+        _res          = y;
+        _prob         = prob;
+        _model        = m;
+        _nClasses     = nClasses;
+        _votingMethod = votingMethod;
+    }
+
+    Status run(services::HostAppIface * pHostApp);
+
+protected:
+    void predictByTree(const size_t iTree, const algorithmFPType * const x, const size_t nRows, const size_t nCols, const bool * const unordered,
+                       IndexType * const aNode, algorithmFPType * const counts) const;
+
+protected:
+    const NumericTable * _data;
+    NumericTable * _res;
+    NumericTable * _prob;
+    const dtrees::internal::ModelImpl * _model;
+    const dtrees::internal::ModelImpl * _cachedModel;
+    size_t _nClasses;
+    VotingMethod _votingMethod;
+    CompiledForestType _forest;
+    dtrees::internal::FeatureTypes _featHelper;
+    TArray<bool, cpu> _unordered;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// PredictKernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictKernel<algorithmFPType, compiledDense, cpu>::compute(services::HostAppIface * const pHostApp, const NumericTable * const x,
+                                                                             const decision_forest::classification::Model * const m,
+                                                                             NumericTable * const r, NumericTable * const prob, const size_t nClasses,
+                                                                             const VotingMethod votingMethod)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    const daal::algorithms::decision_forest::classification::internal::ModelImpl * const pModel =
+        static_cast<const daal::algorithms::decision_forest::classification::internal::ModelImpl * const>(m);
+    if (_task == nullptr) _task = new PredictClassificationCompiledTask<algorithmFPType, cpu>();
+    DAAL_CHECK_MALLOC(_task);
+    _task->setParams(x, r, prob, pModel, nClasses, votingMethod);
+    return _task->run(pHostApp);
+}
+
+/* Moves every observation of the block from the root to a leaf level by level and adds the votes of the leaves */
+template <typename algorithmFPType, CpuType cpu>
+void PredictClassificationCompiledTask<algorithmFPType, cpu>::predictByTree(const size_t iTree, const algorithmFPType * const x, const size_t nRows,
+                                                                            const size_t nCols, const bool * const unordered, IndexType * const aNode,
+                                                                            algorithmFPType * const counts) const
+{
+    const IndexType * const fi       = _forest.featureIndexes(iTree);
+    const IndexType * const lc       = _forest.leftChildren(iTree);
+    const algorithmFPType * const fv = _forest.thresholds(iTree);
+    const size_t depth               = _forest.depth(iTree);
+
+    for (size_t i = 0; i < nRows; ++i) aNode[i] = 0;
+
+    /* the observations that reached a leaf stay in it until the deepest one reaches its leaf */
+    if (unordered)
+    {
+        for (size_t iLevel = 0; iLevel < depth; ++iLevel)
+        {
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                const IndexType n            = aNode[i];
+                const IndexType iFeature     = fi[n];
+                const bool isSplit           = (iFeature >= 0);
+                const size_t idx             = isSplit ? iFeature : 0;
+                const algorithmFPType xValue = x[i * nCols + idx];
+                const bool sn                = unordered[idx] ? (int(xValue) != int(fv[n])) : (xValue > fv[n]);
+                aNode[i]                     = isSplit ? lc[n] + IndexType(sn) : n;
+            }
+        }
+    }
+    else
+    {
+        for (size_t iLevel = 0; iLevel < depth; ++iLevel)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                const IndexType n        = aNode[i];
+                const IndexType iFeature = fi[n];
+                const bool isSplit       = (iFeature >= 0);
+                const bool sn            = x[i * nCols + (isSplit ? iFeature : 0)] > fv[n];
+                aNode[i]                 = isSplit ? lc[n] + IndexType(sn) : n;
+            }
+        }
+    }
+
+    const double * const probas = _model->getProbas(iTree);
+    if (_votingMethod == VotingMethod::unweighted || probas == nullptr)
+    {
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            ++counts[i * _nClasses + lc[aNode[i]]];
+        }
+    }
+    else
+    {
+        const IndexType * const ni = _forest.nodeIndexes(iTree);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const double * const leafProbas = probas + size_t(ni[aNode[i]]) * _nClasses;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nClasses; ++j)
+            {
+                counts[i * _nClasses + j] += leafProbas[j];
+            }
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status PredictClassificationCompiledTask<algorithmFPType, cpu>::run(services::HostAppIface * const pHostApp)
+{
+    Status s;
+    if (_cachedModel != _model || _forest.size() != _model->size())
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.compileForest);
+        _cachedModel = nullptr;
+        DAAL_CHECK_STATUS(s, _forest.build(*_model));
+        _cachedModel = _model;
+    }
+
+    const size_t nRows  = _data->getNumberOfRows();
+    const size_t nCols  = _data->getNumberOfColumns();
+    const size_t nTrees = _forest.size();
+    DAAL_CHECK(nTrees, ErrorModelNotFullInitialized);
+
+    _featHelper.clearBuf();
+    DAAL_CHECK_MALLOC(_featHelper.init(*_data));
+    const bool * unordered = nullptr;
+    if (_featHelper.hasUnorderedFeatures())
+    {
+        _unordered.reset(nCols);
+        DAAL_CHECK_MALLOC(_unordered.get());
+        for (size_t i = 0; i < nCols; ++i) _unordered[i] = _featHelper.isUnordered(i);
+        unordered = _unordered.get();
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, _nClasses);
+    WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(probBD);
+    TArrayCalloc<algorithmFPType, cpu> aCountsT;
+    algorithmFPType * aCounts = probBD.get();
+    if (aCounts)
+    {
+        service_memset<algorithmFPType, cpu>(aCounts, algorithmFPType(0), nRows * _nClasses);
+    }
+    else
+    {
+        aCountsT.reset(nRows * _nClasses);
+        DAAL_CHECK_MALLOC(aCountsT.get());
+        aCounts = aCountsT.get();
+    }
+
+    /* the trees are processed in groups that fit into the last level cache */
+    const size_t treeSize      = _forest.getSizeInBytes() / nTrees + 1;
+    const size_t nTreesInGroup = getNumElementsFitInMemory(getLLCacheSize() * 0.8, treeSize, nTrees);
+    const size_t nBlocks       = nRows / _COMPILED_BLOCK_SIZE + !!(nRows % _COMPILED_BLOCK_SIZE);
+
+    daal::SafeStatus safeStat;
+    HostAppHelper host(pHostApp, 100);
+    for (size_t iFirstTree = 0; iFirstTree < nTrees; iFirstTree += nTreesInGroup)
+    {
+        if (host.isCancelled(s, 1)) return s;
+        const size_t iLastTree = (iFirstTree + nTreesInGroup < nTrees ? iFirstTree + nTreesInGroup : nTrees);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStartRow      = iBlock * _COMPILED_BLOCK_SIZE;
+            const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iStartRow : _COMPILED_BLOCK_SIZE;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            IndexType aNode[_COMPILED_BLOCK_SIZE];
+            algorithmFPType * const counts = aCounts + iStartRow * _nClasses;
+            for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+            {
+                predictByTree(iTree, xBD.get(), nRowsToProcess, nCols, unordered, aNode, counts);
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    algorithmFPType * const res             = resBD.get();
+    const bool bScale                       = (probBD.get() != nullptr);
+    const algorithmFPType inverseTreesCount = algorithmFPType(1) / algorithmFPType(nTrees);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStartRow = iBlock * _COMPILED_BLOCK_SIZE;
+        const size_t iEndRow   = (iBlock == nBlocks - 1) ? nRows : iStartRow + _COMPILED_BLOCK_SIZE;
+        for (size_t iRow = iStartRow; iRow < iEndRow; ++iRow)
+        {
+            algorithmFPType * const counts = aCounts + iRow * _nClasses;
+            if (res)
+            {
+                res[iRow] = algorithmFPType(getMaxElementIndex<algorithmFPType, cpu>(counts, _nClasses));
+            }
+            if (bScale)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < _nClasses; ++j) counts[j] *= inverseTreesCount;
+            }
+        }
+    });
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace classification */
+} /* namespace decision_forest */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -48,6 +48,9 @@ namespace internal
 template <typename algorithmFPType, CpuType cpu>
 class PredictClassificationTask;
 
+template <typename algorithmFPType, CpuType cpu>
+class PredictClassificationCompiledTask;
+
 template <typename algorithmFpType, prediction::Method method, CpuType cpu>
 class PredictKernel : public daal::algorithms::Kernel
 {
@@ -77,6 +80,36 @@ private:
     PredictKernel & operator=(const PredictKernel &);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class PredictKernel<algorithmFpType, compiledDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    PredictKernel() : _task(nullptr) {};
+    ~PredictKernel()
+    {
+        if (_task)
+        {
+            delete _task;
+        }
+    }
+    /**
+     *  \brief Compute decision forest prediction results on the compact breadth-first layout of the trees.
+     *         The layout is built on the first call for the model and reused by the next calls with it.
+     *
+     *  \param a[in]    Matrix of input variables X
+     *  \param m[in]    decision forest model obtained on training stage
+     *  \param r[out]   Prediction results
+     *  \param par[in]  decision forest algorithm parameters
+     */
+    services::Status compute(services::HostAppIface * const pHostApp, const NumericTable * a, const decision_forest::classification::Model * const m,
+                             NumericTable * const r, NumericTable * const prob, const size_t nClasses, const VotingMethod votingMethod);
+    PredictClassificationCompiledTask<algorithmFpType, cpu> * _task;
+
+private:
+    PredictKernel(const PredictKernel &);
+    PredictKernel & operator=(const PredictKernel &);
+};
+
 } // namespace internal
 } // namespace prediction
 } // namespace classification
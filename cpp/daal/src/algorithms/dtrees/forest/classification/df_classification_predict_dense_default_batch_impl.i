@@ -36,12 +36,15 @@
 #include "src/algorithms/service_error_handling.h"
 #include "src/services/service_arrays.h"
 #include "algorithms/decision_forest/decision_forest_classification_model.h"
+#include "src/externals/service_ittnotify.h"
 
 using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 using namespace daal::algorithms::dtrees::internal;
 
+DAAL_ITTNOTIFY_DOMAIN(decision_forest.classification.predict.dense.default);
+
 namespace daal
 {
 namespace algorithms
@@ -236,6 +239,8 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::
                                                                       NumericTable * const prob, const size_t nClasses,
                                                                       const VotingMethod votingMethod)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    services::internal::ScratchArenaScope scratch;
     const daal::algorithms::decision_forest::classification::internal::ModelImpl * const pModel =
         static_cast<const daal::algorithms::decision_forest::classification::internal::ModelImpl * const>(m);
     if (_task == nullptr) _task = new PredictClassificationTask<algorithmFPType, cpu>();
@@ -324,9 +329,10 @@ void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algo
                                                                       const size_t blockSize, const size_t residualSize, algorithmFPType * const prob,
                                                                       const size_t iTree)
 {
-    services::internal::TArray<featureIndexType, cpu> tFI(treeSize);
-    services::internal::TArray<leftOrClassType, cpu> tLC(treeSize);
-    services::internal::TArray<algorithmFPType, cpu> tFV(treeSize);
+    services::internal::ScratchArenaScope scratch;
+    services::internal::TArrayScratch<featureIndexType, cpu> tFI(treeSize);
+    services::internal::TArrayScratch<leftOrClassType, cpu> tLC(treeSize);
+    services::internal::TArrayScratch<algorithmFPType, cpu> tFV(treeSize);
 
     featureIndexType * const fi = tFI.get();
     leftOrClassType * const lc  = tLC.get();
@@ -370,8 +376,9 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTreeCommon(const
     }
     else
     {
-        services::internal::TArray<uint32_t, cpu> currentNodesT(sizeOfBlock);
-        services::internal::TArray<bool, cpu> isSplitsT(sizeOfBlock);
+        services::internal::ScratchArenaScope scratch;
+        services::internal::TArrayScratch<uint32_t, cpu> currentNodesT(sizeOfBlock);
+        services::internal::TArrayScratch<bool, cpu> isSplitsT(sizeOfBlock);
         uint32_t * const currentNodes = currentNodesT.get();
         bool * isSplits               = isSplitsT.get();
         if (isSplits && currentNodes)
@@ -505,6 +512,99 @@ void PredictClassificationTask<double, avx512>::predictByTree(const double * con
         predictByTreeCommon(x, sizeOfBlock, nCols, feat_idx, left_son, split_point, resPtr, iTree);
     }
 }
+
+/* AVX2 gathers take the mask as a vector, a true comparison is all ones, i.e. -1. Blocks of any size up to _DEFAULT_BLOCK_SIZE are supported */
+template <>
+void PredictClassificationTask<float, avx2>::predictByTree(const float * const x, const size_t sizeOfBlock, const size_t nCols,
+                                                           const featureIndexType * const feat_idx, const leftOrClassType * const left_son,
+                                                           const float * const split_point, float * const resPtr, const size_t iTree)
+{
+    if (sizeOfBlock <= _DEFAULT_BLOCK_SIZE)
+    {
+        uint32_t idx[_DEFAULT_BLOCK_SIZE];
+
+        const __m256i lanes   = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        const __m256i offset  = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(nCols));
+        const __m256i nOne    = _mm256_set1_epi32(-1);
+        const __m256i zero    = _mm256_setzero_si256();
+        const __m256 zero_ps  = _mm256_setzero_ps();
+        const bool isRootLeaf = (feat_idx[0] == -1);
+
+        for (size_t i = 0; i < sizeOfBlock; i += 8)
+        {
+            const size_t nInBlock   = (sizeOfBlock - i < 8 ? sizeOfBlock - i : 8);
+            const __m256i blockMask = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(nInBlock)), lanes);
+            __m256i isSplit         = isRootLeaf ? zero : blockMask;
+            __m256i idxr            = zero;
+            while (!_mm256_testz_si256(isSplit, isSplit))
+            {
+                const __m256i fi = _mm256_mask_i32gather_epi32(nOne, feat_idx, idxr, isSplit, 4);
+                isSplit          = _mm256_andnot_si256(_mm256_cmpeq_epi32(fi, nOne), isSplit);
+                const __m256i lc = _mm256_mask_i32gather_epi32(zero, left_son, idxr, isSplit, 4);
+                const __m256 sp  = _mm256_mask_i32gather_ps(zero_ps, split_point, idxr, _mm256_castsi256_ps(isSplit), 4);
+                const __m256 X   = _mm256_mask_i32gather_ps(zero_ps, x + i * nCols, _mm256_add_epi32(offset, fi), _mm256_castsi256_ps(isSplit), 4);
+                const __m256i gt = _mm256_castps_si256(_mm256_cmp_ps(X, sp, _CMP_GT_OS));
+                idxr             = _mm256_blendv_epi8(idxr, _mm256_sub_epi32(lc, gt), isSplit);
+            }
+            _mm256_maskstore_epi32((int *)(idx + i), blockMask, idxr);
+        }
+
+        const double * probas = _model->getProbas(iTree);
+
+        fillResults<float, avx2>(_nClasses, _votingMethod, sizeOfBlock, probas, left_son, idx, resPtr);
+    }
+    else
+    {
+        predictByTreeCommon(x, sizeOfBlock, nCols, feat_idx, left_son, split_point, resPtr, iTree);
+    }
+}
+
+template <>
+void PredictClassificationTask<double, avx2>::predictByTree(const double * const x, const size_t sizeOfBlock, const size_t nCols,
+                                                            const featureIndexType * const feat_idx, const leftOrClassType * const left_son,
+                                                            const double * const split_point, double * const resPtr, const size_t iTree)
+{
+    if (sizeOfBlock <= _DEFAULT_BLOCK_SIZE)
+    {
+        uint32_t idx[_DEFAULT_BLOCK_SIZE];
+
+        const __m128i lanes     = _mm_set_epi32(3, 2, 1, 0);
+        const __m128i offset    = _mm_mullo_epi32(lanes, _mm_set1_epi32(nCols));
+        const __m256i evenLanes = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        const __m128i nOne      = _mm_set1_epi32(-1);
+        const __m128i zero      = _mm_setzero_si128();
+        const __m256d zero_pd   = _mm256_setzero_pd();
+        const bool isRootLeaf   = (feat_idx[0] == -1);
+
+        for (size_t i = 0; i < sizeOfBlock; i += 4)
+        {
+            const size_t nInBlock   = (sizeOfBlock - i < 4 ? sizeOfBlock - i : 4);
+            const __m128i blockMask = _mm_cmpgt_epi32(_mm_set1_epi32(int(nInBlock)), lanes);
+            __m128i isSplit         = isRootLeaf ? zero : blockMask;
+            __m128i idxr            = zero;
+            while (!_mm_testz_si128(isSplit, isSplit))
+            {
+                const __m128i fi   = _mm_mask_i32gather_epi32(nOne, feat_idx, idxr, isSplit, 4);
+                isSplit            = _mm_andnot_si128(_mm_cmpeq_epi32(fi, nOne), isSplit);
+                const __m128i lc   = _mm_mask_i32gather_epi32(zero, left_son, idxr, isSplit, 4);
+                const __m256d mask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(isSplit));
+                const __m256d sp   = _mm256_mask_i32gather_pd(zero_pd, split_point, idxr, mask, 8);
+                const __m256d X    = _mm256_mask_i32gather_pd(zero_pd, x + i * nCols, _mm_add_epi32(offset, fi), mask, 8);
+                const __m256i gt   = _mm256_castpd_si256(_mm256_cmp_pd(X, sp, _CMP_GT_OS));
+                idxr = _mm_blendv_epi8(idxr, _mm_sub_epi32(lc, _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(gt, evenLanes))), isSplit);
+            }
+            _mm_maskstore_epi32((int *)(idx + i), blockMask, idxr);
+        }
+
+        const double * probas = _model->getProbas(iTree);
+
+        fillResults<double, avx2>(_nClasses, _votingMethod, sizeOfBlock, probas, left_son, idx, resPtr);
+    }
+    else
+    {
+        predictByTreeCommon(x, sizeOfBlock, nCols, feat_idx, left_son, split_point, resPtr, iTree);
+    }
+}
 #endif
 
 template <typename algorithmFPType, CpuType cpu>
@@ -903,7 +1003,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
     const size_t nBlocks           = nRowsOfRes / blockSize;
     const size_t residualSize      = nRowsOfRes - nBlocks * blockSize;
     algorithmFPType * commonBufVal = nullptr;
-    services::internal::TArray<algorithmFPType, cpu> commonBufValT;
+    services::internal::TArrayScratch<algorithmFPType, cpu> commonBufValT;
     if (prob == nullptr)
     {
         commonBufValT.reset(_nClasses * nRowsOfRes);
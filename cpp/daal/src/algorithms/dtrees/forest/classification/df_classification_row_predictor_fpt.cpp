@@ -0,0 +1,175 @@
+/* file: df_classification_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of decision forest classification prediction of a single observation.
+//  The trees are traversed on the compiled layout of the model in the calling thread.
+//--
+*/
+
+#include "algorithms/decision_forest/decision_forest_classification_row_predictor.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_predict_compiled_impl.i"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/services/service_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface3
+{
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::Impl
+{
+public:
+    typedef dtrees::prediction::internal::CompiledForest<algorithmFPType, sse2> CompiledForestType;
+    typedef typename CompiledForestType::IndexType IndexType;
+
+    Impl() : _pModel(nullptr), _nFeatures(0), _nClasses(0), _votingMethod(weighted) {}
+
+    services::Status prepare(const decision_forest::classification::ModelPtr & model, const Parameter & parameter,
+                             const data_management::NumericTablePtr & data)
+    {
+        DAAL_CHECK(model, services::ErrorNullModel);
+        DAAL_CHECK(parameter.nClasses > 1, services::ErrorIncorrectNumberOfClasses);
+
+        services::Status s;
+        _model  = model;
+        _pModel = static_cast<const decision_forest::classification::internal::ModelImpl *>(_model.get());
+        DAAL_CHECK_STATUS(s, _forest.build(*_pModel));
+        DAAL_CHECK(_forest.size(), services::ErrorModelNotFullInitialized);
+
+        const size_t nFeatures = _pModel->getNumberOfFeatures();
+        if (data)
+        {
+            dtrees::internal::FeatureTypes featTypes;
+            DAAL_CHECK_MALLOC(featTypes.init(*data));
+            if (featTypes.hasUnorderedFeatures())
+            {
+                _unordered.reset(nFeatures);
+                DAAL_CHECK_MALLOC(_unordered.get());
+                for (size_t i = 0; i < nFeatures; ++i) _unordered[i] = featTypes.isUnordered(i);
+            }
+        }
+        _counts.reset(parameter.nClasses);
+        DAAL_CHECK_MALLOC(_counts.get());
+
+        _nClasses     = parameter.nClasses;
+        _votingMethod = parameter.votingMethod;
+        _nFeatures    = nFeatures;
+        return s;
+    }
+
+    services::Status predict(const algorithmFPType * const x, algorithmFPType * const label, algorithmFPType * const probabilities)
+    {
+        algorithmFPType * const counts = probabilities ? probabilities : _counts.get();
+        for (size_t j = 0; j < _nClasses; ++j) counts[j] = algorithmFPType(0);
+
+        const bool * const unordered = _unordered.get();
+        const size_t nTrees          = _forest.size();
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            const IndexType leaf        = _forest.findLeaf(iTree, x, unordered);
+            const double * const probas = _pModel->getProbas(iTree);
+            if (_votingMethod == VotingMethod::unweighted || probas == nullptr)
+            {
+                ++counts[_forest.leftChildren(iTree)[leaf]];
+            }
+            else
+            {
+                const double * const leafProbas = probas + size_t(_forest.nodeIndexes(iTree)[leaf]) * _nClasses;
+                for (size_t j = 0; j < _nClasses; ++j) counts[j] += leafProbas[j];
+            }
+        }
+
+        if (label) *label = algorithmFPType(services::internal::getMaxElementIndex<algorithmFPType, sse2>(counts, _nClasses));
+        if (probabilities)
+        {
+            const algorithmFPType inverseTreesCount = algorithmFPType(1) / algorithmFPType(nTrees);
+            for (size_t j = 0; j < _nClasses; ++j) probabilities[j] *= inverseTreesCount;
+        }
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    decision_forest::classification::ModelPtr _model; /* keeps the class probabilities of the leaves */
+    const decision_forest::classification::internal::ModelImpl * _pModel;
+    CompiledForestType _forest;
+    services::internal::TArray<bool, sse2> _unordered;
+    services::internal::TArray<algorithmFPType, sse2> _counts;
+    size_t _nFeatures;
+    size_t _nClasses;
+    VotingMethod _votingMethod;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor() : _impl(nullptr)
+{}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::prepare(const decision_forest::classification::ModelPtr & model, const Parameter & parameter,
+                                                        const data_management::NumericTablePtr & data)
+{
+    delete _impl;
+    _impl = new Impl();
+    DAAL_CHECK_MALLOC(_impl);
+    const services::Status s = _impl->prepare(model, parameter, data);
+    if (!s)
+    {
+        delete _impl;
+        _impl = nullptr;
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::predict(const algorithmFPType * x, algorithmFPType * label, algorithmFPType * probabilities)
+{
+    DAAL_CHECK(_impl, services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, label, probabilities);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface3
+} // namespace prediction
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
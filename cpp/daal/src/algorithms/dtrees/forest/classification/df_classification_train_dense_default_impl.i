@@ -55,12 +55,12 @@ namespace internal
 //////////////////////////////////////////////////////////////////////////////////////////
 // UnorderedRespHelper
 //////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, CpuType cpu>
-class UnorderedRespHelper : public DataHelper<algorithmFPType, ClassIndexType, cpu>
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+class UnorderedRespHelper : public DataHelper<algorithmFPType, ClassIndexType, BinIndexType, cpu>
 {
 public:
     typedef ClassIndexType TResponse;
-    typedef DataHelper<algorithmFPType, ClassIndexType, cpu> super;
+    typedef DataHelper<algorithmFPType, ClassIndexType, BinIndexType, cpu> super;
     typedef typename dtrees::internal::TreeImpClassification<> TreeType;
     typedef typename TreeType::NodeType NodeType;
     typedef typename dtrees::internal::TVector<float, cpu, dtrees::internal::ScalableAllocator<cpu> > Histogramm;
@@ -232,8 +232,8 @@ private:
 };
 
 #ifdef DEBUG_CHECK_IMPURITY
-template <typename algorithmFPType, CpuType cpu>
-void UnorderedRespHelper<algorithmFPType, cpu>::checkImpurity(const IndexType * ptrIdx, size_t n, const ImpurityData & expected) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::checkImpurity(const IndexType * ptrIdx, size_t n, const ImpurityData & expected) const
 {
     Histogramm hist;
     hist.resize(_nClasses, 0);
@@ -250,8 +250,8 @@ void UnorderedRespHelper<algorithmFPType, cpu>::checkImpurity(const IndexType *
 }
 #endif
 
-template <typename algorithmFPType, CpuType cpu>
-bool UnorderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample)
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+bool UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample)
 {
     DAAL_CHECK_STATUS_VAR(super::init(data, resp, aSample));
     if (this->_indexedFeatures)
@@ -265,8 +265,8 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data,
     return true;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void UnorderedRespHelper<algorithmFPType, cpu>::calcImpurity(const IndexType * aIdx, size_t n, ImpurityData & imp) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::calcImpurity(const IndexType * aIdx, size_t n, ImpurityData & imp) const
 {
     imp.init(_nClasses);
     for (size_t i = 0; i < n; ++i)
@@ -277,8 +277,9 @@ void UnorderedRespHelper<algorithmFPType, cpu>::calcImpurity(const IndexType * a
     calcGini(n, imp);
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void UnorderedRespHelper<algorithmFPType, cpu>::simpleSplit(const algorithmFPType * featureVal, const IndexType * aIdx, TSplitData & split) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::simpleSplit(const algorithmFPType * featureVal, const IndexType * aIdx,
+                                                                          TSplitData & split) const
 {
     split.featureValue = featureVal[0];
     split.left.init(_nClasses);
@@ -288,11 +289,12 @@ void UnorderedRespHelper<algorithmFPType, cpu>::simpleSplit(const algorithmFPTyp
     split.iStart             = 0;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(const algorithmFPType * featureVal, const IndexType * aIdx, size_t n,
-                                                                            size_t nMinSplitPart, const algorithmFPType accuracy,
-                                                                            const ImpurityData & curImpurity, TSplitData & split,
-                                                                            double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+bool UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitOrderedFeature(const algorithmFPType * featureVal, const IndexType * aIdx,
+                                                                                          size_t n, size_t nMinSplitPart,
+                                                                                          const algorithmFPType accuracy,
+                                                                                          const ImpurityData & curImpurity, TSplitData & split,
+                                                                                          double minWeightLeaf) const
 {
     ClassIndexType xi = this->_aResponse[aIdx[0]].val;
     _impLeft.init(_nClasses);
@@ -388,11 +390,12 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
     return bFound;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(const algorithmFPType * featureVal, const IndexType * aIdx, size_t n,
-                                                                                size_t nMinSplitPart, const algorithmFPType accuracy,
-                                                                                const ImpurityData & curImpurity, TSplitData & split,
-                                                                                double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+bool UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitCategoricalFeature(const algorithmFPType * featureVal,
+                                                                                              const IndexType * aIdx, size_t n, size_t nMinSplitPart,
+                                                                                              const algorithmFPType accuracy,
+                                                                                              const ImpurityData & curImpurity, TSplitData & split,
+                                                                                              double minWeightLeaf) const
 {
     DAAL_ASSERT(n >= 2 * nMinSplitPart);
     _impRight.init(_nClasses);
@@ -458,29 +461,32 @@ void countResponses(SizeType nClasses, SizeType n, const IndexType * aIdx, const
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < n; ++i)
     {
-        const IndexType iSample              = aIdx[i];
-        const auto & r                       = aResponse[iSample];
-        const IndexType iRow                 = r.idx;
-        const IndexedFeatures::IndexType idx = indexedFeature[iRow];
+        const IndexType iSample    = aIdx[i];
+        const auto & r             = aResponse[iSample];
+        const IndexType iRow       = r.idx;
+        const FeatureIndexType idx = indexedFeature[iRow];
         ++nFeatIdx[idx];
         const ClassIndexType iClass = r.val;
         ++nSamplesPerClass[idx * nClasses + iClass];
     }
 }
 
-template <typename algorithmFPType, CpuType cpu>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx,
-                                                                             size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
-                                                                             TSplitData & split, double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+int UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature,
+                                                                                           const IndexType * aIdx, size_t n, size_t nMinSplitPart,
+                                                                                           const ImpurityData & curImpurity, TSplitData & split,
+                                                                                           double minWeightLeaf) const
 {
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
+    //ordered: missing values go to the left son with the smallest values, unordered: missing values go to the right son
+    const bool hasMissing = this->indexedFeatures().hasMissing(iFeature);
     _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
     _samplesPerClassBuf.setValues(nClasses() * nDiffFeatMax, 0);
     auto nFeatIdx         = _idxFeatureBuf.get();
     auto nSamplesPerClass = _samplesPerClassBuf.get();
 
-    countResponses<typename super::Response, IndexType, typename IndexedFeatures::IndexType, size_t, cpu>(
-        _nClasses, n, aIdx, this->_aResponse.get(), this->indexedFeatures().data(iFeature), nFeatIdx, nSamplesPerClass);
+    countResponses<typename super::Response, IndexType, BinIndexType, size_t, cpu>(
+        _nClasses, n, aIdx, this->_aResponse.get(), this->indexedFeatures().template data<BinIndexType>(iFeature), nFeatIdx, nSamplesPerClass);
 
     algorithmFPType bestImpDecrease =
         split.impurityDecrease < 0 ? split.impurityDecrease : algorithmFPType(n) * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
@@ -505,6 +511,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
             for (size_t iClass = 0; iClass < _nClasses; ++iClass) histLeft[iClass] += nSamplesPerClass[i * _nClasses + iClass];
         }
         if ((nLeft < nMinSplitPart) || (nLeft < minWeightLeaf)) continue;
+        if (hasMissing && (i == dtrees::internal::IndexedFeatures::missingIndex())) continue; //missing values only can't be split off
 
         if (split.featureUnordered)
         {
@@ -541,30 +548,33 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
     return idxFeatureBestSplit;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature,
-                                                                  size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
-                                                                  IndexType * bestSplitIdx) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature,
+                                                                                size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
+                                                                                IndexType * bestSplitIdx) const
 {
     DAAL_ASSERT(bestSplit.nLeft > 0);
     const algorithmFPType divL    = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
     bestSplit.left.var            = 1. - bestSplit.left.var * divL * divL;
     IndexType * bestSplitIdxRight = bestSplitIdx + bestSplit.nLeft;
-    const int iRowSplitVal        = doPartition<typename super::Response, IndexType, typename IndexedFeatures::IndexType, size_t, cpu>(
-        n, aIdx, this->_aResponse.get(), this->indexedFeatures().data(iFeature), bestSplit.featureUnordered, idxFeatureValueBestSplit,
-        bestSplitIdxRight, bestSplitIdx, bestSplit.nLeft);
+    const int iRowSplitVal        = doPartition<typename super::Response, IndexType, BinIndexType, size_t, cpu>(
+        n, aIdx, this->_aResponse.get(), this->indexedFeatures().template data<BinIndexType>(iFeature), bestSplit.featureUnordered,
+        idxFeatureValueBestSplit, bestSplitIdxRight, bestSplitIdx, bestSplit.nLeft);
 
     DAAL_ASSERT(iRowSplitVal >= 0);
     bestSplit.iStart       = 0;
     bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
 }
 #else
-template <typename algorithmFPType, CpuType cpu>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx,
-                                                                             size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
-                                                                             TSplitData & split, double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+int UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature,
+                                                                                           const IndexType * aIdx, size_t n, size_t nMinSplitPart,
+                                                                                           const ImpurityData & curImpurity, TSplitData & split,
+                                                                                           double minWeightLeaf) const
 {
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
+    //ordered: missing values go to the left son with the smallest values, unordered: missing values go to the right son
+    const bool hasMissing = this->indexedFeatures().hasMissing(iFeature);
     _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
     _samplesPerClassBuf.setValues(nClasses() * nDiffFeatMax, 0);
     auto nFeatIdx         = _idxFeatureBuf.get();
@@ -574,14 +584,14 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         split.impurityDecrease < 0 ? split.impurityDecrease : algorithmFPType(n) * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
     {
         //direct access to sorted features data in order to facilitate vectorization
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        const auto aResponse                              = this->_aResponse.get();
+        const BinIndexType * indexedFeature = this->indexedFeatures().template data<BinIndexType>(iFeature);
+        const auto aResponse                = this->_aResponse.get();
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample              = aIdx[i];
-            const auto & r                       = aResponse[iSample];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const IndexType iSample = aIdx[i];
+            const auto & r          = aResponse[iSample];
+            const BinIndexType idx  = indexedFeature[r.idx];
             ++nFeatIdx[idx];
             const ClassIndexType iClass = r.val;
             ++nSamplesPerClass[idx * _nClasses + iClass];
@@ -607,6 +617,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
             for (size_t iClass = 0; iClass < _nClasses; ++iClass) histLeft[iClass] += nSamplesPerClass[i * _nClasses + iClass];
         }
         if ((nLeft < nMinSplitPart) || nLeft < minWeightLeaf) continue;
+        if (hasMissing && (i == dtrees::internal::IndexedFeatures::missingIndex())) continue; //missing values only can't be split off
 
         if (split.featureUnordered)
         {
@@ -644,24 +655,24 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
     return idxFeatureBestSplit;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature,
-                                                                  size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
-                                                                  IndexType * bestSplitIdx) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature,
+                                                                                size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
+                                                                                IndexType * bestSplitIdx) const
 {
     DAAL_ASSERT(bestSplit.nLeft > 0);
-    const algorithmFPType divL                        = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
-    bestSplit.left.var                                = 1. - bestSplit.left.var * divL * divL;
-    IndexType * bestSplitIdxRight                     = bestSplitIdx + bestSplit.nLeft;
-    size_t iLeft                                      = 0;
-    size_t iRight                                     = 0;
-    int iRowSplitVal                                  = -1;
-    const auto aResponse                              = this->_aResponse.get();
-    const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
+    const algorithmFPType divL          = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
+    bestSplit.left.var                  = 1. - bestSplit.left.var * divL * divL;
+    IndexType * bestSplitIdxRight       = bestSplitIdx + bestSplit.nLeft;
+    size_t iLeft                        = 0;
+    size_t iRight                       = 0;
+    int iRowSplitVal                    = -1;
+    const auto aResponse                = this->_aResponse.get();
+    const BinIndexType * indexedFeature = this->indexedFeatures().template data<BinIndexType>(iFeature);
     for (size_t i = 0; i < n; ++i)
     {
-        const IndexType iSample              = aIdx[i];
-        const IndexedFeatures::IndexType idx = indexedFeature[aResponse[iSample].idx];
+        const IndexType iSample = aIdx[i];
+        const BinIndexType idx  = indexedFeature[aResponse[iSample].idx];
         if ((bestSplit.featureUnordered && (idx != idxFeatureValueBestSplit)) || ((!bestSplit.featureUnordered) && (idx > idxFeatureValueBestSplit)))
         {
             DAAL_ASSERT(iRight < n - bestSplit.nLeft);
@@ -765,10 +776,10 @@ Status TreeThreadCtx<algorithmFPType, cpu>::finalizeOOBError(const NumericTable
 //////////////////////////////////////////////////////////////////////////////////////////
 // TrainBatchTask for classification
 //////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, decision_forest::classification::training::Method method, CpuType cpu>
-class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, UnorderedRespHelper<algorithmFPType, cpu>, cpu>
+template <typename algorithmFPType, typename BinIndexType, decision_forest::classification::training::Method method, CpuType cpu>
+class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>, cpu>
 {
-    typedef TrainBatchTaskBase<algorithmFPType, UnorderedRespHelper<algorithmFPType, cpu>, cpu> super;
+    typedef TrainBatchTaskBase<algorithmFPType, UnorderedRespHelper<algorithmFPType, BinIndexType, cpu>, cpu> super;
 
 public:
     typedef TreeThreadCtx<algorithmFPType, cpu> ThreadCtxType;
@@ -793,10 +804,25 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, defaultDense, c
     HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, decision_forest::classification::Model & m, Result & res,
     const decision_forest::classification::training::Parameter & par)
 {
+    dtrees::internal::FeatureTypes featTypes;
+    DAAL_CHECK(featTypes.init(*x), ErrorMemoryAllocationFailed);
+    dtrees::internal::IndexedFeatures indexedFeatures;
+    services::Status s = initIndexedFeatures<algorithmFPType, cpu>(x, par, featTypes, indexedFeatures);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    typedef daal::algorithms::decision_forest::classification::internal::ModelImpl ModelImplType;
+    ModelImplType & md = *static_cast<ModelImplType *>(&m);
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
-    services::Status s = computeImpl<algorithmFPType, cpu, daal::algorithms::decision_forest::classification::internal::ModelImpl,
-                                     TrainBatchTask<algorithmFPType, defaultDense, cpu> >(
-        pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl *>(&m), rd, par, par.nClasses);
+    typedef dtrees::internal::IndexedFeatures::IndexType DefaultBinIndexType;
+    if (indexedFeatures.sizeOfIndex() == sizeof(uint8_t))
+        s = computeImpl<algorithmFPType, cpu, ModelImplType, TrainBatchTask<algorithmFPType, uint8_t, defaultDense, cpu> >(
+            pHostApp, x, y, md, rd, par, par.nClasses, featTypes, indexedFeatures);
+    else if (indexedFeatures.sizeOfIndex() == sizeof(uint16_t))
+        s = computeImpl<algorithmFPType, cpu, ModelImplType, TrainBatchTask<algorithmFPType, uint16_t, defaultDense, cpu> >(
+            pHostApp, x, y, md, rd, par, par.nClasses, featTypes, indexedFeatures);
+    else
+        s = computeImpl<algorithmFPType, cpu, ModelImplType, TrainBatchTask<algorithmFPType, DefaultBinIndexType, defaultDense, cpu> >(
+            pHostApp, x, y, md, rd, par, par.nClasses, featTypes, indexedFeatures);
     if (s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
@@ -31,9 +31,12 @@
 #include "src/algorithms/engines/engine_types_internal.h"
 #include "src/services/service_defines.h"
 #include "src/algorithms/distributions/uniform/uniform_kernel.h"
+#include "src/externals/service_ittnotify.h"
 
 using namespace daal::algorithms::dtrees::training::internal;
 
+DAAL_ITTNOTIFY_DOMAIN(decision_forest.train.dense.default);
+
 namespace daal
 {
 namespace algorithms
@@ -233,20 +236,34 @@ services::Status selectParallelizationTechnique(const Parameter & par, engines::
 //////////////////////////////////////////////////////////////////////////////////////////
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////
+// Creates the indexed features and stores them in the narrowest type that fits the number
+// of indices
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status initIndexedFeatures(const NumericTable * x, const Parameter & par, const dtrees::internal::FeatureTypes & featTypes,
+                                     dtrees::internal::IndexedFeatures & indexedFeatures)
+{
+    if (par.memorySavingMode) return services::Status();
+
+    DAAL_ITTNOTIFY_SCOPED_TASK(initIndexedFeatures);
+    //the narrowest type is tried first, the indexing stops at the first feature that does not fit into it
+    services::Status s;
+    bool bFits = false;
+    DAAL_CHECK_STATUS(s, (indexedFeatures.initNarrow<algorithmFPType, uint8_t, cpu>(*x, &featTypes, bFits)));
+    if (!bFits) DAAL_CHECK_STATUS(s, (indexedFeatures.initNarrow<algorithmFPType, uint16_t, cpu>(*x, &featTypes, bFits)));
+    if (!bFits) DAAL_CHECK_STATUS(s, (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes)));
+    return s;
+}
+
 template <typename algorithmFPType, CpuType cpu, typename ModelType, typename TaskType>
 services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, ModelType & md, ResultData & res,
-                             const Parameter & par, size_t nClasses)
+                             const Parameter & par, size_t nClasses, const dtrees::internal::FeatureTypes & featTypes,
+                             const dtrees::internal::IndexedFeatures & indexedFeatures)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
     DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
-    dtrees::internal::FeatureTypes featTypes;
-    DAAL_CHECK(featTypes.init(*x), ErrorMemoryAllocationFailed);
-    dtrees::internal::IndexedFeatures indexedFeatures;
     services::Status s;
-    if (!par.memorySavingMode)
-    {
-        s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes);
-        DAAL_CHECK_STATUS_VAR(s);
-    }
 
     const auto nFeatures = x->getNumberOfColumns();
     WriteOnlyRows<algorithmFPType, cpu> varImpBD(res.varImp, 0, 1);
@@ -288,21 +305,24 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
     services::internal::TArray<size_t, cpu> numElems(par.nTrees);
 
     daal::SafeStatus safeStat;
-    daal::threader_for(par.nTrees, par.nTrees, [&](size_t i) {
-        if (!safeStat.ok()) return;
-        TaskType * task = tlsTask.local();
-        DAAL_CHECK_MALLOC_THR(task);
-        dtrees::internal::Tree * pTree = nullptr;
-        numElems[i]                    = 0;
-        auto engineImpl                = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[i].get());
-        DAAL_CHECK_THR(engineImpl, ErrorEngineNotSupported);
-        services::Status s = task->run(engineImpl, pTree, numElems[i]);
-        DAAL_CHECK_STATUS_THR(s);
-        if (pTree)
-        {
-            md.add((typename ModelType::TreeType &)*pTree, nClasses);
-        }
-    });
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildTrees);
+        daal::threader_for(par.nTrees, par.nTrees, [&](size_t i) {
+            if (!safeStat.ok()) return;
+            TaskType * task = tlsTask.local();
+            DAAL_CHECK_MALLOC_THR(task);
+            dtrees::internal::Tree * pTree = nullptr;
+            numElems[i]                    = 0;
+            auto engineImpl                = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[i].get());
+            DAAL_CHECK_THR(engineImpl, ErrorEngineNotSupported);
+            services::Status s = task->run(engineImpl, pTree, numElems[i]);
+            DAAL_CHECK_STATUS_THR(s);
+            if (pTree)
+            {
+                md.add((typename ModelType::TreeType &)*pTree, nClasses);
+            }
+        });
+    }
     s                = safeStat.detach();
     const auto nRows = x->getNumberOfRows();
     tlsCtx.reduce([&](Ctx * ctx) -> void {
@@ -329,6 +349,7 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
     //OOB error
     if (par.resultsToCompute & (computeOutOfBagError | computeOutOfBagErrorPerObservation))
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.finalizeOOBError);
         WriteOnlyRows<algorithmFPType, cpu> oobErr(res.oobError, 0, 1);
         if (par.resultsToCompute & computeOutOfBagError) DAAL_CHECK_BLOCK_STATUS(oobErr);
 
@@ -506,6 +527,7 @@ template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engines::internal::BatchBaseImpl * engineImpl,
                                                                            dtrees::internal::Tree *& pTree, size_t & numElems)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(buildTree);
     _numElems   = &numElems;
     _engineImpl = engineImpl;
     pTree       = nullptr;
@@ -652,6 +674,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::simpleSplit(size_t iS
         *_numElems += 1;
         rng.uniform(1, &iFeature, _engineImpl->getState(), 0, _data->getNumberOfColumns());
         featureValuesToBuf(iFeature, featBuf, aIdx, 2);
+        if (services::internal::isNaN<cpu>(featBuf[0]) || services::internal::isNaN<cpu>(featBuf[1])) continue; //missing value
         if (featBuf[1] - featBuf[0] <= _accuracy) //all values of the feature are the same
             continue;
         _helper.simpleSplit(featBuf, aIdx, split);
@@ -668,6 +691,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplit(size_t
                                                                          const typename DataHelper::ImpurityData & curImpurity,
                                                                          IndexType & iFeatureBest, typename DataHelper::TSplitData & split)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(findBestSplit);
     if (n == 2)
     {
         DAAL_ASSERT(_par.minObservationsInLeafNode == 1);
@@ -697,7 +721,10 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
     for (size_t i = 0; i < _nFeaturesPerNode; ++i)
     {
         const auto iFeature            = _aFeatureIdx[i];
-        const bool bUseIndexedFeatures = (!_par.memorySavingMode) && (fact > qMax * float(_helper.indexedFeatures().numIndices(iFeature)));
+        //missing values are handled by the indexed features only
+        const bool bUseIndexedFeatures = (!_par.memorySavingMode)
+                                         && ((fact > qMax * float(_helper.indexedFeatures().numIndices(iFeature)))
+                                             || _helper.indexedFeatures().hasMissing(iFeature));
 
         if (bUseIndexedFeatures)
         {
@@ -789,6 +816,7 @@ void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::addImpurityDecrease(I
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeResults(const dtrees::internal::Tree & t)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeResults);
     const size_t nOOB = _helper.getNumOOBIndices();
     if (!nOOB) return services::Status();
     TArray<IndexType, cpu> oobIndices(nOOB);
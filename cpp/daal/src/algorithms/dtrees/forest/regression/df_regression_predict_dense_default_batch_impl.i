@@ -35,10 +35,13 @@
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/services/service_algo_utils.h"
+#include "src/externals/service_ittnotify.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
 
+DAAL_ITTNOTIFY_DOMAIN(decision_forest.regression.predict.dense.default);
+
 namespace daal
 {
 namespace algorithms
@@ -71,6 +74,8 @@ template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
                                                                       const regression::Model * m, NumericTable * r)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    ScratchArenaScope scratch;
     const daal::algorithms::decision_forest::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::decision_forest::regression::internal::ModelImpl *>(m);
     PredictRegressionTask<algorithmFPType, cpu> task(x, r);
@@ -0,0 +1,144 @@
+/* file: df_regression_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of decision forest regression prediction of a single observation.
+//  The trees are traversed on the compiled layout of the model in the calling thread.
+//--
+*/
+
+#include "algorithms/decision_forest/decision_forest_regression_row_predictor.h"
+#include "src/algorithms/dtrees/forest/regression/df_regression_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_predict_compiled_impl.i"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace regression
+{
+namespace prediction
+{
+namespace interface1
+{
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::Impl
+{
+public:
+    typedef dtrees::prediction::internal::CompiledForest<algorithmFPType, sse2> CompiledForestType;
+    typedef typename CompiledForestType::IndexType IndexType;
+
+    Impl() : _nFeatures(0) {}
+
+    services::Status prepare(const decision_forest::regression::ModelPtr & model, const data_management::NumericTablePtr & data)
+    {
+        DAAL_CHECK(model, services::ErrorNullModel);
+
+        services::Status s;
+        const decision_forest::regression::internal::ModelImpl * const pModel =
+            static_cast<const decision_forest::regression::internal::ModelImpl *>(model.get());
+        DAAL_CHECK_STATUS(s, _forest.build(*pModel));
+        DAAL_CHECK(_forest.size(), services::ErrorModelNotFullInitialized);
+
+        const size_t nFeatures = pModel->getNumberOfFeatures();
+        if (data)
+        {
+            dtrees::internal::FeatureTypes featTypes;
+            DAAL_CHECK_MALLOC(featTypes.init(*data));
+            if (featTypes.hasUnorderedFeatures())
+            {
+                _unordered.reset(nFeatures);
+                DAAL_CHECK_MALLOC(_unordered.get());
+                for (size_t i = 0; i < nFeatures; ++i) _unordered[i] = featTypes.isUnordered(i);
+            }
+        }
+        _nFeatures = nFeatures;
+        return s;
+    }
+
+    services::Status predict(const algorithmFPType * const x, algorithmFPType * const response) const
+    {
+        const bool * const unordered = _unordered.get();
+        const size_t nTrees          = _forest.size();
+        algorithmFPType sum          = algorithmFPType(0);
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            sum += _forest.thresholds(iTree)[_forest.findLeaf(iTree, x, unordered)];
+        }
+        *response = sum / algorithmFPType(nTrees);
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    CompiledForestType _forest;
+    services::internal::TArray<bool, sse2> _unordered;
+    size_t _nFeatures;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor() : _impl(nullptr)
+{}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::prepare(const decision_forest::regression::ModelPtr & model,
+                                                        const data_management::NumericTablePtr & data)
+{
+    delete _impl;
+    _impl = new Impl();
+    DAAL_CHECK_MALLOC(_impl);
+    const services::Status s = _impl->prepare(model, data);
+    if (!s)
+    {
+        delete _impl;
+        _impl = nullptr;
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::predict(const algorithmFPType * x, algorithmFPType * response)
+{
+    DAAL_CHECK(_impl, services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, response);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface1
+} // namespace prediction
+} // namespace regression
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
@@ -79,12 +79,12 @@ struct RegErr
 //////////////////////////////////////////////////////////////////////////////////////////
 // OrderedRespHelper
 //////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, CpuType cpu>
-class OrderedRespHelper : public DataHelper<algorithmFPType, algorithmFPType, cpu>
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+class OrderedRespHelper : public DataHelper<algorithmFPType, algorithmFPType, BinIndexType, cpu>
 {
 public:
     typedef algorithmFPType TResponse;
-    typedef DataHelper<algorithmFPType, algorithmFPType, cpu> super;
+    typedef DataHelper<algorithmFPType, algorithmFPType, BinIndexType, cpu> super;
     typedef dtrees::internal::TreeImpRegression<> TreeType;
     typedef typename TreeType::NodeType NodeType;
 
@@ -175,9 +175,9 @@ private:
 };
 
 #ifdef DEBUG_CHECK_IMPURITY
-template <typename algorithmFPType, CpuType cpu>
-void OrderedRespHelper<algorithmFPType, cpu>::checkImpurityInternal(const IndexType * ptrIdx, size_t n, const ImpurityData & expected,
-                                                                    bool bInternal) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::checkImpurityInternal(const IndexType * ptrIdx, size_t n, const ImpurityData & expected,
+                                                                                  bool bInternal) const
 {
     algorithmFPType div = 1. / algorithmFPType(n);
     TResponse cMean     = this->_aResponse[ptrIdx[0]].val * div;
@@ -190,8 +190,8 @@ void OrderedRespHelper<algorithmFPType, cpu>::checkImpurityInternal(const IndexT
 }
 #endif
 
-template <typename algorithmFPType, CpuType cpu>
-bool OrderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample)
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+bool OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample)
 {
     DAAL_CHECK_STATUS_VAR(super::init(data, resp, aSample));
     if (this->_indexedFeatures)
@@ -204,8 +204,8 @@ bool OrderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data, co
     return true;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void OrderedRespHelper<algorithmFPType, cpu>::calcImpurity(const IndexType * aIdx, size_t n, ImpurityData & imp) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::calcImpurity(const IndexType * aIdx, size_t n, ImpurityData & imp) const
 {
     imp.var  = 0;
     imp.mean = this->_aResponse[aIdx[0]].val;
@@ -229,8 +229,8 @@ void OrderedRespHelper<algorithmFPType, cpu>::calcImpurity(const IndexType * aId
 }
 
 #ifdef DEBUG_CHECK_IMPURITY
-template <typename algorithmFPType, CpuType cpu>
-algorithmFPType OrderedRespHelper<algorithmFPType, cpu>::calcResponse(algorithmFPType & res, const IndexType * idx, size_t n) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+algorithmFPType OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::calcResponse(algorithmFPType & res, const IndexType * idx, size_t n) const
 {
     const algorithmFPType cDiv = 1. / algorithmFPType(n);
     res                        = this->_aResponse[idx[0]].val * cDiv;
@@ -251,8 +251,9 @@ void calcPrevImpurity(algorithmFPType var, algorithmFPType mean, algorithmFPType
     if (varPrev < 0) varPrev = 0;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void OrderedRespHelper<algorithmFPType, cpu>::simpleSplit(const algorithmFPType * featureVal, const IndexType * aIdx, TSplitData & split) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::simpleSplit(const algorithmFPType * featureVal, const IndexType * aIdx,
+                                                                        TSplitData & split) const
 {
     split.featureValue = featureVal[0];
     split.left.var     = 0;
@@ -261,30 +262,31 @@ void OrderedRespHelper<algorithmFPType, cpu>::simpleSplit(const algorithmFPType
     split.iStart       = 0;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-bool OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeature(const algorithmFPType * featureVal, const IndexType * aIdx, size_t n,
-                                                                      size_t nMinSplitPart, const algorithmFPType accuracy,
-                                                                      const ImpurityData & curImpurity, TSplitData & split,
-                                                                      double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+bool OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitForFeature(const algorithmFPType * featureVal, const IndexType * aIdx,
+                                                                                    size_t n, size_t nMinSplitPart, const algorithmFPType accuracy,
+                                                                                    const ImpurityData & curImpurity, TSplitData & split,
+                                                                                    double minWeightLeaf) const
 {
     return split.featureUnordered ? findBestSplitCategoricalFeature(featureVal, aIdx, n, nMinSplitPart, accuracy, curImpurity, split, minWeightLeaf) :
                                     findBestSplitOrderedFeature(featureVal, aIdx, n, nMinSplitPart, accuracy, curImpurity, split, minWeightLeaf);
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit,
-                                                                TSplitData & bestSplit, IndexType * bestSplitIdx) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature,
+                                                                              size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
+                                                                              IndexType * bestSplitIdx) const
 {
     DAAL_ASSERT(bestSplit.nLeft > 0);
     const algorithmFPType divL = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
     bestSplit.left.mean *= divL;
-    bestSplit.left.var                                = 0;
-    IndexType * bestSplitIdxRight                     = bestSplitIdx + bestSplit.nLeft;
-    size_t iLeft                                      = 0;
-    size_t iRight                                     = 0;
-    int iRowSplitVal                                  = -1;
-    const auto aResponse                              = this->_aResponse.get();
-    const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
+    bestSplit.left.var                  = 0;
+    IndexType * bestSplitIdxRight       = bestSplitIdx + bestSplit.nLeft;
+    size_t iLeft                        = 0;
+    size_t iRight                       = 0;
+    int iRowSplitVal                    = -1;
+    const auto aResponse                = this->_aResponse.get();
+    const BinIndexType * indexedFeature = this->indexedFeatures().template data<BinIndexType>(iFeature);
     for (size_t i = 0; i < n; ++i)
     {
         const auto iSample = aIdx[i];
@@ -311,12 +313,15 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType
     bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
 }
 
-template <typename algorithmFPType, CpuType cpu>
-int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx,
-                                                                           size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
-                                                                           TSplitData & split, double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+int OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * buf, IndexType iFeature,
+                                                                                         const IndexType * aIdx, size_t n, size_t nMinSplitPart,
+                                                                                         const ImpurityData & curImpurity, TSplitData & split,
+                                                                                         double minWeightLeaf) const
 {
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
+    //ordered: missing values go to the left son with the smallest values, unordered: missing values go to the right son
+    const bool hasMissing = this->indexedFeatures().hasMissing(iFeature);
     _idxFeatureBuf.setValues(nDiffFeatMax, 0);
 
     //the buffer keeps sums of responses for each of unique feature values
@@ -330,14 +335,14 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
     auto nFeatIdx             = _idxFeatureBuf.get(); //number of indexed feature values, array
     intermSummFPType sumTotal = 0;                    //total sum of responses in the set being split
     {
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        auto aResponse                                    = this->_aResponse.get();
+        const BinIndexType * indexedFeature = this->indexedFeatures().template data<BinIndexType>(iFeature);
+        auto aResponse                      = this->_aResponse.get();
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample              = aIdx[i];
-            const typename super::Response & r   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const IndexType iSample            = aIdx[i];
+            const typename super::Response & r = aResponse[aIdx[i]];
+            const BinIndexType idx             = indexedFeature[r.idx];
             ++nFeatIdx[idx];
             buf[idx] += aResponse[iSample].val;
             sumTotal += aResponse[iSample].val;
@@ -355,6 +360,7 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
             break;
         sumLeft = (split.featureUnordered ? buf[i] : sumLeft + buf[i]);
         if ((nLeft < minWeightLeaf) || (nLeft < minWeightLeaf)) continue;
+        if (hasMissing && (i == dtrees::internal::IndexedFeatures::missingIndex())) continue; //missing values only can't be split off
         intermSummFPType sumRight = sumTotal - sumLeft;
         //the part of the impurity decrease dependent on split itself
         const intermSummFPType impDecreasePart = sumLeft * sumLeft / intermSummFPType(nLeft) + sumRight * sumRight / intermSummFPType(n - nLeft);
@@ -374,11 +380,12 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
     return idxFeatureBestSplit;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-bool OrderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(const algorithmFPType * featureVal, const IndexType * aIdx, size_t n,
-                                                                          size_t nMinSplitPart, const algorithmFPType accuracy,
-                                                                          const ImpurityData & curImpurity, TSplitData & split,
-                                                                          double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+bool OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitOrderedFeature(const algorithmFPType * featureVal, const IndexType * aIdx,
+                                                                                        size_t n, size_t nMinSplitPart,
+                                                                                        const algorithmFPType accuracy,
+                                                                                        const ImpurityData & curImpurity, TSplitData & split,
+                                                                                        double minWeightLeaf) const
 {
     algorithmFPType xi = this->_aResponse[aIdx[0]].val;
     ImpurityData left;
@@ -433,11 +440,12 @@ bool OrderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(const
     return true;
 }
 
-template <typename algorithmFPType, CpuType cpu>
-bool OrderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(const algorithmFPType * featureVal, const IndexType * aIdx, size_t n,
-                                                                              size_t nMinSplitPart, const algorithmFPType accuracy,
-                                                                              const ImpurityData & curImpurity, TSplitData & split,
-                                                                              double minWeightLeaf) const
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+bool OrderedRespHelper<algorithmFPType, BinIndexType, cpu>::findBestSplitCategoricalFeature(const algorithmFPType * featureVal,
+                                                                                            const IndexType * aIdx, size_t n, size_t nMinSplitPart,
+                                                                                            const algorithmFPType accuracy,
+                                                                                            const ImpurityData & curImpurity, TSplitData & split,
+                                                                                            double minWeightLeaf) const
 {
     DAAL_ASSERT(n >= 2 * nMinSplitPart);
     ImpurityData left;
@@ -550,10 +558,10 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 // TrainBatchTask for regression
 //////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, decision_forest::regression::training::Method method, CpuType cpu>
-class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, OrderedRespHelper<algorithmFPType, cpu>, cpu>
+template <typename algorithmFPType, typename BinIndexType, decision_forest::regression::training::Method method, CpuType cpu>
+class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, OrderedRespHelper<algorithmFPType, BinIndexType, cpu>, cpu>
 {
-    typedef TrainBatchTaskBase<algorithmFPType, OrderedRespHelper<algorithmFPType, cpu>, cpu> super;
+    typedef TrainBatchTaskBase<algorithmFPType, OrderedRespHelper<algorithmFPType, BinIndexType, cpu>, cpu> super;
 
 public:
     typedef TreeThreadCtx<algorithmFPType, cpu> ThreadCtxType;
@@ -579,10 +587,25 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, defaultDense, cpu>:
                                                                                          decision_forest::regression::Model & m, Result & res,
                                                                                          const Parameter & par)
 {
+    dtrees::internal::FeatureTypes featTypes;
+    DAAL_CHECK(featTypes.init(*x), ErrorMemoryAllocationFailed);
+    dtrees::internal::IndexedFeatures indexedFeatures;
+    services::Status s = initIndexedFeatures<algorithmFPType, cpu>(x, par, featTypes, indexedFeatures);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    typedef daal::algorithms::decision_forest::regression::internal::ModelImpl ModelImplType;
+    ModelImplType & md = *static_cast<ModelImplType *>(&m);
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
-    services::Status s = computeImpl<algorithmFPType, cpu, daal::algorithms::decision_forest::regression::internal::ModelImpl,
-                                     TrainBatchTask<algorithmFPType, defaultDense, cpu> >(
-        pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0);
+    typedef dtrees::internal::IndexedFeatures::IndexType DefaultBinIndexType;
+    if (indexedFeatures.sizeOfIndex() == sizeof(uint8_t))
+        s = computeImpl<algorithmFPType, cpu, ModelImplType, TrainBatchTask<algorithmFPType, uint8_t, defaultDense, cpu> >(
+            pHostApp, x, y, md, rd, par, 0, featTypes, indexedFeatures);
+    else if (indexedFeatures.sizeOfIndex() == sizeof(uint16_t))
+        s = computeImpl<algorithmFPType, cpu, ModelImplType, TrainBatchTask<algorithmFPType, uint16_t, defaultDense, cpu> >(
+            pHostApp, x, y, md, rd, par, 0, featTypes, indexedFeatures);
+    else
+        s = computeImpl<algorithmFPType, cpu, ModelImplType, TrainBatchTask<algorithmFPType, DefaultBinIndexType, defaultDense, cpu> >(
+            pHostApp, x, y, md, rd, par, 0, featTypes, indexedFeatures);
     if (s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
@@ -70,8 +70,19 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                                result->get(classifier::prediction::probabilities).get() :
                                nullptr);
 
+    NumericTable * contributions = nullptr;
+    NumericTable * interactions  = nullptr;
+    if (par->resultsToEvaluate & (computeShapContributions | computeShapInteractions))
+    {
+        /* SHAP values are stored only in the result of the gradient boosted trees */
+        const Result * shapResult = dynamic_cast<const Result *>(result);
+        DAAL_CHECK(shapResult, services::ErrorNullResult);
+        if (par->resultsToEvaluate & computeShapContributions) contributions = shapResult->get(predictionContributions).get();
+        if (par->resultsToEvaluate & computeShapInteractions) interactions = shapResult->get(predictionInteractions).get();
+    }
+
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations, contributions, interactions);
 }
 
 } // namespace interface2
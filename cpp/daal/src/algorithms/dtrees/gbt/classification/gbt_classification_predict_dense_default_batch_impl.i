@@ -36,6 +36,7 @@
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/regression/gbt_regression_predict_dense_default_batch_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_tree_shap_impl.i"
 #include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
 #include "src/services/service_algo_utils.h"
 
@@ -55,6 +56,7 @@ namespace prediction
 namespace internal
 {
 using gbt::prediction::internal::VECTOR_BLOCK_SIZE;
+using gbt::prediction::internal::threaderForCancellable;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictBinaryClassificationTask
@@ -86,7 +88,7 @@ public:
             WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, 1);
             DAAL_CHECK_BLOCK_STATUS(probBD);
             algorithmFPType * prob_pred = probBD.get();
-            TArray<algorithmFPType, cpu> expValPtr(nRows);
+            TArrayScratch<algorithmFPType, cpu> expValPtr(nRows);
             algorithmFPType * expVal = expValPtr.get();
             DAAL_CHECK_MALLOC(expVal);
             s = super::runInternal(pHostApp, this->_res);
@@ -117,7 +119,7 @@ public:
             WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, 1);
             DAAL_CHECK_BLOCK_STATUS(probBD);
             algorithmFPType * prob_pred = probBD.get();
-            TArray<algorithmFPType, cpu> expValPtr(nRows);
+            TArrayScratch<algorithmFPType, cpu> expValPtr(nRows);
             algorithmFPType * expVal = expValPtr.get();
             NumericTablePtr expNT    = HomogenNumericTableCPU<algorithmFPType, cpu>::create(expVal, 1, nRows, &s);
             DAAL_CHECK_MALLOC(expVal);
@@ -174,13 +176,18 @@ public:
 
     PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : _data(x), _res(y), _prob(prob) {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nClasses, size_t nIterations, services::HostAppIface * pHostApp);
+    services::Status runShap(const gbt::classification::internal::ModelImpl * m, size_t nClasses, services::HostAppIface * pHostApp,
+                             NumericTable * contributions, NumericTable * interactions);
 
 protected:
-    services::Status predictByAllTrees(size_t nTreesTotal, size_t nClasses, const DimType & dim);
+    services::Status predictByAllTrees(services::HostAppIface * pHostApp, size_t nTreesTotal, size_t nClasses, const DimType & dim);
 
     void predictByTrees(algorithmFPType * res, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
     void predictByTreesVector(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
+    void predictByTreesBlock(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x, size_t nRows,
+                             size_t nCols);
     void softmax(algorithmFPType * Input, algorithmFPType * Output, size_t nRows, size_t nCols);
+    services::Status copyToClassColumns(const NumericTable * classValues, NumericTable * values, size_t iClass) const;
 
     size_t getMaxClass(const algorithmFPType * val, size_t nClasses) const
     {
@@ -192,7 +199,7 @@ protected:
     NumericTable * _res;
     NumericTable * _prob;
     dtrees::internal::FeatureTypes _featHelper;
-    TArray<const TreeType *, cpu> _aTree;
+    TArrayScratch<const TreeType *, cpu> _aTree;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -201,17 +208,33 @@ protected:
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
                                                                       const classification::Model * m, NumericTable * r, NumericTable * prob,
-                                                                      size_t nClasses, size_t nIterations)
+                                                                      size_t nClasses, size_t nIterations, NumericTable * contributions,
+                                                                      NumericTable * interactions)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(classification.compute);
+    ScratchArenaScope scratch;
     const daal::algorithms::gbt::classification::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
+    services::Status s;
     if (nClasses == 2)
     {
         PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
-        return task.run(pModel, nIterations, pHostApp);
+        DAAL_CHECK_STATUS(s, task.run(pModel, nIterations, pHostApp));
+        if (contributions || interactions)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(classification.compute.shap);
+            s = task.runShap(pModel, pHostApp, contributions, interactions);
+        }
+        return s;
     }
     PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
-    return task.run(pModel, nClasses, nIterations, pHostApp);
+    DAAL_CHECK_STATUS(s, task.run(pModel, nClasses, nIterations, pHostApp));
+    if (contributions || interactions)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(classification.compute.shap);
+        s = task.runShap(pModel, nClasses, pHostApp, contributions, interactions);
+    }
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -225,9 +248,90 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
 
-    DimType dim(*_data, nTreesTotal);
+    /* nothing to predict if only SHAP values are requested */
+    if (!_res && !_prob) return services::Status();
 
-    return predictByAllTrees(nTreesTotal, nClasses, dim);
+    const size_t treeSize = gbt::prediction::internal::getAverageTreeSize(this->_aTree.get(), nTreesTotal);
+    DimType dim(*_data, nTreesTotal, treeSize, nClasses);
+
+    return predictByAllTrees(pHostApp, nTreesTotal, nClasses, dim);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictMulticlassTask<algorithmFPType, cpu>::runShap(const gbt::classification::internal::ModelImpl * m, size_t nClasses,
+                                                                      services::HostAppIface * pHostApp, NumericTable * contributions,
+                                                                      NumericTable * interactions)
+{
+    const size_t nTreesTotal   = this->_aTree.size();
+    const size_t nTreesInClass = nTreesTotal / nClasses;
+    const size_t nRows         = _data->getNumberOfRows();
+    const size_t nPhi          = _data->getNumberOfColumns() + 1;
+
+    TArrayScratch<const TreeType *, cpu> aTree(nTreesInClass);
+    TArrayScratch<const int *, cpu> aCover(nTreesInClass);
+    DAAL_CHECK_MALLOC(aTree.get() && aCover.get());
+
+    /* SHAP values of the raw boosted value of one class, they are copied to the columns of the class afterwards */
+    services::Status s;
+    NumericTablePtr classContribs;
+    NumericTablePtr classInters;
+    if (contributions)
+    {
+        classContribs = HomogenNumericTableCPU<algorithmFPType, cpu>::create(nPhi, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if (interactions)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nPhi, nPhi);
+        classInters = HomogenNumericTableCPU<algorithmFPType, cpu>::create(nPhi * nPhi, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    /* trees of the classes alternate in the model */
+    for (size_t iClass = 0; iClass < nClasses; ++iClass)
+    {
+        for (size_t i = 0; i < nTreesInClass; ++i)
+        {
+            aTree[i]  = this->_aTree[i * nClasses + iClass];
+            aCover[i] = m->getNodeSampleCount(i * nClasses + iClass);
+        }
+        gbt::prediction::internal::TreeShapTask<algorithmFPType, cpu> task(_data, aTree.get(), aCover.get(), nTreesInClass, _featHelper);
+        DAAL_CHECK_STATUS(s, task.run(pHostApp, classContribs.get(), classInters.get()));
+        if (contributions) DAAL_CHECK_STATUS(s, copyToClassColumns(classContribs.get(), contributions, iClass));
+        if (interactions) DAAL_CHECK_STATUS(s, copyToClassColumns(classInters.get(), interactions, iClass));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictMulticlassTask<algorithmFPType, cpu>::copyToClassColumns(const NumericTable * classValues, NumericTable * values,
+                                                                                 size_t iClass) const
+{
+    const size_t nRows        = classValues->getNumberOfRows();
+    const size_t nClassValues = classValues->getNumberOfColumns();
+    const size_t nValues      = values->getNumberOfColumns();
+    const size_t nRowsInBlock = 256;
+    const size_t nBlocks      = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStartRow      = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock + 1 == nBlocks) ? nRows - iStartRow : nRowsInBlock;
+        ReadRows<algorithmFPType, cpu> srcBD(const_cast<NumericTable *>(classValues), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(srcBD);
+        /* the columns of other classes are kept, so the rows are read as well */
+        WriteRows<algorithmFPType, cpu> dstBD(values, iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(dstBD);
+        const algorithmFPType * src = srcBD.get();
+        algorithmFPType * dst       = dstBD.get() + iClass * nClassValues;
+        for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nClassValues; ++j) dst[iRow * nValues + j] = src[iRow * nClassValues + j];
+        }
+    });
+    return safeStat.detach();
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -257,93 +361,119 @@ void PredictMulticlassTask<algorithmFPType, cpu>::predictByTreesVector(algorithm
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(size_t nTreesTotal, size_t nClasses, const DimType & dim)
+void PredictMulticlassTask<algorithmFPType, cpu>::predictByTreesBlock(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses,
+                                                                      const algorithmFPType * x, size_t nRows, size_t nCols)
+{
+    size_t iRow = 0;
+    for (; iRow + VECTOR_BLOCK_SIZE <= nRows; iRow += VECTOR_BLOCK_SIZE)
+    {
+        predictByTreesVector(val + iRow * nClasses, iFirstTree, nTrees, nClasses, x + iRow * nCols);
+    }
+    for (; iRow < nRows; ++iRow)
+    {
+        predictByTrees(val + iRow * nClasses, iFirstTree, nTrees, nClasses, x + iRow * nCols);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(services::HostAppIface * pHostApp, size_t nTreesTotal,
+                                                                                size_t nClasses, const DimType & dim)
 {
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
+    algorithmFPType * const res = resBD.get();
 
     const size_t nCols(_data->getNumberOfColumns());
     const size_t nRows(_data->getNumberOfRows());
-    daal::SafeStatus safeStat;
-    if (_prob)
+    services::Status s;
+
+    /* Raw boosted values of all rows are kept only if they are needed for probabilities
+       or if partial sums of different tree blocks are accumulated by different threads */
+    TArrayScratch<algorithmFPType, cpu> valPtr;
+    algorithmFPType * valFull = nullptr;
+    if (_prob || dim.bTreeBlocksInParallel)
     {
-        WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(probBD);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nClasses);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows * nClasses, sizeof(algorithmFPType));
-        TArray<algorithmFPType, cpu> valPtr(nRows * nClasses);
-        algorithmFPType * valFull = valPtr.get();
+        valFull = valPtr.reset(nRows * nClasses);
+        DAAL_CHECK_MALLOC(valFull);
         services::internal::service_memset<algorithmFPType, cpu>(valFull, algorithmFPType(0), nRows * nClasses);
+    }
 
-        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+    if (!dim.bTreeBlocksInParallel)
+    {
+        ClassesRawBoostedTls lsData(nClasses * dim.nRowsInBlock);
+        s = threaderForCancellable(pHostApp, dim.nDataBlocks, dim.getNumberOfDataBlocksBetweenChecks(), [&](size_t iBlock, SafeStatus & safeStat) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
-            const size_t nRowsToProcess = (iBlock == (dim.nDataBlocks - 1)) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
-            algorithmFPType * valL      = valFull + iStartRow * nClasses;
-            algorithmFPType * val       = valL;
+            const size_t nRowsToProcess = dim.getNumberOfRowsInBlock(iBlock);
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() ? resBD.get() + iStartRow : nullptr;
 
-            size_t iRow = 0;
-            for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
+            algorithmFPType * val = valFull ? valFull + iStartRow * nClasses : lsData.local();
+            DAAL_CHECK_MALLOC_THR(val);
+            if (!valFull)
             {
-                val = valL + iRow * nClasses;
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
-                if (res)
-                {
-                    for (size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
-                    {
-                        res[iRow + i] = getMaxClass(val + i * nClasses, nClasses);
-                    }
-                }
+                services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nRowsToProcess * nClasses);
             }
-            for (; iRow < nRowsToProcess; ++iRow)
+
+            for (size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
+            {
+                predictByTreesBlock(val, iTree, dim.getNumberOfTreesInBlock(iTree), nClasses, xBD.get(), nRowsToProcess, nCols);
+            }
+
+            if (res)
             {
-                val = valL + iRow * nClasses;
-                predictByTrees(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
-                if (res)
+                for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
                 {
-                    res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+                    res[iStartRow + iRow] = algorithmFPType(getMaxClass(val + iRow * nClasses, nClasses));
                 }
             }
         });
-        algorithmFPType * prob_pred = probBD.get();
-        daal::algorithms::optimization_solver::cross_entropy_loss::internal::CrossEntropyLossKernel<
-            algorithmFPType, daal::algorithms::optimization_solver::cross_entropy_loss::defaultDense, cpu>::softmaxThreaded(valFull, prob_pred, nRows,
-                                                                                                                            nClasses);
     }
-    else if (!_prob && this->_res)
+    else
     {
-        ClassesRawBoostedTls lsData(nClasses * VECTOR_BLOCK_SIZE);
-        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
-            algorithmFPType * const val = lsData.local();
+        daal::TlsSum<algorithmFPType, cpu> partialVal(nRows * nClasses);
+        const size_t nTiles = dim.nDataBlocks * dim.nTreeBlocks;
+
+        s = threaderForCancellable(pHostApp, nTiles, dim.nTilesBetweenChecks, [&](size_t iTile, SafeStatus & safeStat) {
+            const size_t iBlock         = iTile / dim.nTreeBlocks;
+            const size_t iTree          = (iTile % dim.nTreeBlocks) * dim.nTreesInBlock;
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
-            const size_t nRowsToProcess = (iBlock == (dim.nDataBlocks - 1)) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
+            const size_t nRowsToProcess = dim.getNumberOfRowsInBlock(iBlock);
+
+            algorithmFPType * const localVal = partialVal.local();
+            DAAL_CHECK_MALLOC_THR(localVal);
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
 
-            size_t iRow = 0;
-            for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
-            {
-                services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses * VECTOR_BLOCK_SIZE);
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+            predictByTreesBlock(localVal + iStartRow * nClasses, iTree, dim.getNumberOfTreesInBlock(iTree), nClasses, xBD.get(), nRowsToProcess,
+                                nCols);
+        });
+        if (!s) return s;
 
-                for (size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
-                {
-                    res[iRow + i] = getMaxClass(val + i * nClasses, nClasses);
-                }
-            }
-            for (; iRow < nRowsToProcess; ++iRow)
+        partialVal.reduceTo(valFull, nRows * nClasses);
+
+        if (res)
+        {
+            for (size_t iRow = 0; iRow < nRows; ++iRow)
             {
-                services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses);
-                predictByTrees(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
-                res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+                res[iRow] = algorithmFPType(getMaxClass(valFull + iRow * nClasses, nClasses));
             }
-        });
+        }
     }
+    if (!s) return s;
 
-    return safeStat.detach();
+    if (_prob)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(probBD);
+        algorithmFPType * prob_pred = probBD.get();
+        daal::algorithms::optimization_solver::cross_entropy_loss::internal::CrossEntropyLossKernel<
+            algorithmFPType, daal::algorithms::optimization_solver::cross_entropy_loss::defaultDense, cpu>::softmaxThreaded(valFull, prob_pred, nRows,
+                                                                                                                            nClasses);
+    }
+
+    return services::Status();
 }
 
 } /* namespace internal */
@@ -44,6 +44,12 @@ namespace prediction
 {
 namespace internal
 {
+/* Number of sets of SHAP values per observation, two classes share the raw boosted value */
+inline size_t getNumberOfShapTables(size_t nClasses)
+{
+    return nClasses == 2 ? 1 : nClasses;
+}
+
 template <typename algorithmFpType, gbt::classification::prediction::Method method, CpuType cpu>
 class PredictKernel : public daal::algorithms::Kernel
 {
@@ -56,9 +62,11 @@ public:
      *  \param r[out]   Prediction results
      *  \param nClasses[in]     Number of classes in gradient boosted trees algorithm parameter
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param contributions[out]  SHAP feature contributions, not computed if null
+     *  \param interactions[out]   SHAP feature interaction values, not computed if null
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const classification::Model * m, NumericTable * r,
-                             NumericTable * prob, size_t nClasses, size_t nIterations);
+                             NumericTable * prob, size_t nClasses, size_t nIterations, NumericTable * contributions, NumericTable * interactions);
 };
 
 } // namespace internal
@@ -0,0 +1,79 @@
+/* file: gbt_classification_predict_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees classification algorithm interface
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_predict_types.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "src/algorithms/dtrees/gbt/classification/gbt_classification_predict_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface2
+{
+using namespace daal::services;
+
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, classifier::prediction::Result::allocate<algorithmFPType>(input, par, method));
+
+    const classifier::Parameter * pPrm = static_cast<const classifier::Parameter *>(par);
+    if (pPrm->resultsToEvaluate & (computeShapContributions | computeShapInteractions))
+    {
+        const data_management::NumericTablePtr dataTable =
+            static_cast<const classifier::prediction::Input *>(input)->get(classifier::prediction::data);
+        const size_t nRows       = dataTable->getNumberOfRows();
+        const size_t nPhi        = dataTable->getNumberOfColumns() + 1;
+        const size_t nShapTables = internal::getNumberOfShapTables(pPrm->nClasses);
+        if (pPrm->resultsToEvaluate & computeShapContributions)
+        {
+            Argument::set(predictionContributions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                                       nShapTables * nPhi, nRows, data_management::NumericTableIface::doAllocate, &s));
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        if (pPrm->resultsToEvaluate & computeShapInteractions)
+        {
+            Argument::set(predictionInteractions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                                      nShapTables * nPhi * nPhi, nRows, data_management::NumericTableIface::doAllocate, &s));
+        }
+    }
+    return s;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
+                                                                    const int method);
+
+} // namespace interface2
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
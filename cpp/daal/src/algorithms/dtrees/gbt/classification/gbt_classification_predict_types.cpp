@@ -25,6 +25,7 @@
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
 #include "src/algorithms/dtrees/gbt/classification/gbt_classification_model_impl.h"
+#include "src/algorithms/dtrees/gbt/classification/gbt_classification_predict_kernel.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -123,6 +124,66 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_GBT_CLASSIFICATION_PREDICTION_RESULT_ID);
+
+Result::Result() : classifier::prediction::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of gradient boosted trees model-based prediction
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of gradient boosted trees model-based prediction
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the result of gradient boosted trees model-based prediction
+ * \param[in] input   %Input object
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::prediction::Result::check(input, par, method));
+
+    const classifier::Parameter * pPrm = static_cast<const classifier::Parameter *>(par);
+    if (pPrm->resultsToEvaluate & (computeShapContributions | computeShapInteractions))
+    {
+        const NumericTablePtr dataTable = static_cast<const classifier::prediction::Input *>(input)->get(classifier::prediction::data);
+        const size_t nRows              = dataTable->getNumberOfRows();
+        const size_t nPhi               = dataTable->getNumberOfColumns() + 1;
+        const size_t nShapTables        = internal::getNumberOfShapTables(pPrm->nClasses);
+        if (pPrm->resultsToEvaluate & computeShapContributions)
+        {
+            DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(predictionContributions).get(), predictionContributionsStr(), 0, 0,
+                                                                    nShapTables * nPhi, nRows));
+        }
+        if (pPrm->resultsToEvaluate & computeShapInteractions)
+        {
+            DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(predictionInteractions).get(), predictionInteractionsStr(), 0, 0,
+                                                                    nShapTables * nPhi * nPhi, nRows));
+        }
+    }
+    return s;
+}
+
+} // namespace interface2
 } // namespace prediction
 } // namespace classification
 } // namespace gbt
@@ -0,0 +1,169 @@
+/* file: gbt_classification_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees classification prediction of a single observation.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_row_predictor.h"
+#include "src/algorithms/dtrees/gbt/classification/gbt_classification_model_impl.h"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
+#include "src/algorithms/objective_function/logistic_loss/logistic_loss_dense_default_batch_kernel.h"
+#include "src/services/service_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface2
+{
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::Impl
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+
+    Impl() : _nFeatures(0), _nClasses(0) {}
+
+    services::Status prepare(const gbt::classification::ModelPtr & model, const Parameter & parameter, const data_management::NumericTablePtr & data)
+    {
+        DAAL_CHECK(model, services::ErrorNullModel);
+        DAAL_CHECK(parameter.nClasses > 1, services::ErrorIncorrectNumberOfClasses);
+
+        const gbt::classification::internal::ModelImpl * const pModel = static_cast<const gbt::classification::internal::ModelImpl *>(model.get());
+        const size_t nTreesInIteration                                = (parameter.nClasses == 2 ? 1 : parameter.nClasses);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter.nIterations, nTreesInIteration);
+        const size_t nTrees = (parameter.nIterations ? parameter.nIterations * nTreesInIteration : pModel->size());
+        DAAL_CHECK(nTrees && nTrees <= pModel->size(), services::ErrorIncorrectParameter);
+
+        _aTree.reset(nTrees);
+        _values.reset(parameter.nClasses);
+        DAAL_CHECK_MALLOC(_aTree.get() && _values.get());
+        for (size_t i = 0; i < nTrees; ++i) _aTree[i] = pModel->at(i);
+        if (data) DAAL_CHECK_MALLOC(_featHelper.init(*data));
+
+        _model     = model;
+        _nClasses  = parameter.nClasses;
+        _nFeatures = pModel->getNumberOfFeatures();
+        return services::Status();
+    }
+
+    services::Status predict(const algorithmFPType * const x, algorithmFPType * const label, algorithmFPType * const probabilities)
+    {
+        const size_t nTrees = _aTree.size();
+        if (_nClasses == 2)
+        {
+            algorithmFPType f = algorithmFPType(0);
+            for (size_t iTree = 0; iTree < nTrees; ++iTree) f += predictForTree(iTree, x);
+
+            /* probability of the class 1 is sigmoid(f), hence sign(f) defines the label */
+            const algorithmFPType labels[2] = { algorithmFPType(1), algorithmFPType(0) };
+            if (label) *label = labels[services::internal::SignBit<algorithmFPType, sse2>::get(f)];
+            if (probabilities)
+            {
+                optimization_solver::logistic_loss::internal::LogLossKernel<algorithmFPType, optimization_solver::logistic_loss::defaultDense,
+                                                                            sse2>::sigmoid(&f, probabilities + 1, 1);
+                probabilities[0] = algorithmFPType(1) - probabilities[1];
+            }
+            return services::Status();
+        }
+
+        algorithmFPType * const val = _values.get();
+        for (size_t j = 0; j < _nClasses; ++j) val[j] = algorithmFPType(0);
+        for (size_t iTree = 0; iTree < nTrees; ++iTree) val[iTree % _nClasses] += predictForTree(iTree, x);
+
+        if (label) *label = algorithmFPType(services::internal::getMaxElementIndex<algorithmFPType, sse2>(val, _nClasses));
+        if (probabilities)
+        {
+            optimization_solver::cross_entropy_loss::internal::CrossEntropyLossKernel<
+                algorithmFPType, optimization_solver::cross_entropy_loss::defaultDense, sse2>::softmax(val, probabilities, 1, _nClasses);
+        }
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    algorithmFPType predictForTree(size_t iTree, const algorithmFPType * x) const
+    {
+        return gbt::prediction::internal::predictForTree<algorithmFPType, TreeType, sse2>(*_aTree[iTree], _featHelper, x);
+    }
+
+    gbt::classification::ModelPtr _model; /* owns the trees */
+    services::internal::TArray<const TreeType *, sse2> _aTree;
+    services::internal::TArray<algorithmFPType, sse2> _values;
+    dtrees::internal::FeatureTypes _featHelper;
+    size_t _nFeatures;
+    size_t _nClasses;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor() : _impl(nullptr)
+{}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::prepare(const gbt::classification::ModelPtr & model, const Parameter & parameter,
+                                                        const data_management::NumericTablePtr & data)
+{
+    delete _impl;
+    _impl = new Impl();
+    DAAL_CHECK_MALLOC(_impl);
+    const services::Status s = _impl->prepare(model, parameter, data);
+    if (!s)
+    {
+        delete _impl;
+        _impl = nullptr;
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::predict(const algorithmFPType * x, algorithmFPType * label, algorithmFPType * probabilities)
+{
+    DAAL_CHECK(_impl, services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, label, probabilities);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface2
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -65,7 +65,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const gbt::classification::prediction::interface1::Parameter * par = static_cast<gbt::classification::prediction::interface1::Parameter *>(_par);
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, nullptr, par->nClasses, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, nullptr, par->nClasses, par->nIterations, nullptr, nullptr);
 }
 
 } // namespace interface1
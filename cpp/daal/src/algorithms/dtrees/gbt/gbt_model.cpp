@@ -52,6 +52,17 @@ static data_management::SerializationIface * creatorGbtDecisionTree()
 }
 data_management::SerializationDesc GbtDecisionTree::_desc(creatorGbtDecisionTree, SERIALIZATION_GBT_DECISION_TREE_ID);
 
+services::Status GbtDecisionTree::serializeImpl(data_management::InputDataArchive * arch)
+{
+    return serialImpl<data_management::InputDataArchive, false>(arch);
+}
+
+services::Status GbtDecisionTree::deserializeImpl(const data_management::OutputDataArchive * arch)
+{
+    return serialImpl<const data_management::OutputDataArchive, true>(
+        arch, COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion()));
+}
+
 size_t ModelImpl::numberOfTrees() const
 {
     return ImplType::size();
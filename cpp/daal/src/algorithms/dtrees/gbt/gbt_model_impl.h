@@ -59,10 +59,14 @@ void swap(T & t1, T & t2)
 
 class GbtDecisionTree : public SerializationIface
 {
+private:
+    static data_management::SerializationDesc _desc;
+
 public:
-    DECLARE_SERIALIZABLE();
+    DECLARE_SERIALIZABLE_TAG();
     using SplitPointType             = HomogenNumericTable<gbt::prediction::internal::ModelFPType>;
     using FeatureIndexesForSplitType = HomogenNumericTable<gbt::prediction::internal::FeatureIndexType>;
+    using DefaultLeftForSplitType    = HomogenNumericTable<int>;
 
     GbtDecisionTree(const size_t nNodes, const size_t maxLvl, const size_t sourceNumOfNodes)
         : _nNodes(nNodes),
@@ -83,6 +87,13 @@ public:
 
     const gbt::prediction::internal::FeatureIndexType * getFeatureIndexesForSplit() const { return _featureIndexes->getArray(); }
 
+    // Non-zero if the observations with missing value of the split feature go to the left son.
+    // nullptr if they go to the left son in every split of the tree
+    const int * getDefaultLeftForSplit() const { return _defaultLeft ? _defaultLeft->getArray() : nullptr; }
+
+    services::Status serializeImpl(data_management::InputDataArchive * arch) DAAL_C11_OVERRIDE;
+    services::Status deserializeImpl(const data_management::OutputDataArchive * arch) DAAL_C11_OVERRIDE;
+
     size_t getNumberOfNodes() const { return _nNodes; }
 
     size_t * getArrayNumSplitFeature() { return nNodeSplitFeature.data(); }
@@ -110,6 +121,11 @@ public:
         gbt::prediction::internal::ModelFPType * const spitPoints          = tree->getSplitPoints();
         gbt::prediction::internal::FeatureIndexType * const featureIndexes = tree->getFeatureIndexesForSplit();
 
+        tree->_defaultLeft = DefaultLeftForSplitType::create(1, nNodes, NumericTableIface::doAllocate);
+        DAAL_CHECK_MALLOC(tree->_defaultLeft && tree->_defaultLeft->getArray());
+        int * const defaultLeft = tree->_defaultLeft->getArray();
+        bool bDefaultRight      = false;
+
         for (size_t i = 0; i < nNodes; ++i)
         {
             sons[i]    = nullptr;
@@ -147,12 +163,15 @@ public:
                     sons[nSons++]              = NodeType::castSplit(p->left());
                     sons[nSons++]              = NodeType::castSplit(p->right());
                     featureIndexes[idxInTable] = p->featureIdx;
+                    defaultLeft[idxInTable]    = int(p->defaultLeft);
+                    bDefaultRight |= !p->defaultLeft;
                 }
                 else
                 {
                     sons[nSons++]              = p;
                     sons[nSons++]              = p;
                     featureIndexes[idxInTable] = 0;
+                    defaultLeft[idxInTable]    = 1;
                 }
                 DAAL_ASSERT(featureIndexes[idxInTable] >= 0);
                 nNodeSamplesVals[idxInTable] = (int)p->count;
@@ -167,13 +186,14 @@ public:
 
             nParents = nSons;
         }
+        if (!bDefaultRight) tree->_defaultLeft.reset();
 
         return (!result) ? services::Status() : services::Status(services::ErrorMemoryCopyFailedInternal);
     }
 
 protected:
     template <typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->set(_nNodes);
         arch->set(_maxLvl);
@@ -182,6 +202,12 @@ protected:
         arch->setSharedPtrObj(_splitPoints);
         arch->setSharedPtrObj(_featureIndexes);
 
+        /* Default directions of the splits are stored since 2021.1.9, the version in makefile.ver that ships the missing values support */
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 1, 9))
+        {
+            arch->setSharedPtrObj(_defaultLeft);
+        }
+
         return services::Status();
     }
 
@@ -191,6 +217,7 @@ protected:
     size_t _sourceNumOfNodes;
     services::SharedPtr<SplitPointType> _splitPoints;
     services::SharedPtr<FeatureIndexesForSplitType> _featureIndexes;
+    services::SharedPtr<DefaultLeftForSplitType> _defaultLeft;
     services::Collection<size_t> nNodeSplitFeature;
     services::Collection<size_t> CoverFeature;
     services::Collection<double> GainFeature;
@@ -270,6 +297,8 @@ public:
     void clear();
 
     const GbtDecisionTree * at(const size_t idx) const;
+    // Number of training samples reached each node of the tree, nullptr if the model was not trained by the library
+    const int * getNodeSampleCount(const size_t idx) const { return super::getNodeSampleCount(idx); }
 
     static void decisionTreeToGbtTree(const DecisionTreeTable & tree, GbtDecisionTree & gbtTree);
     static services::Status convertDecisionTreesToGbtTrees(data_management::DataCollectionPtr & serializationData);
@@ -30,6 +30,8 @@
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
 #include "src/algorithms/dtrees/gbt/gbt_internal.h"
+#include "src/algorithms/service_threading.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -45,19 +47,159 @@ typedef float ModelFPType;
 typedef uint32_t FeatureIndexType;
 const FeatureIndexType VECTOR_BLOCK_SIZE = 64;
 
+/* Moves VECTOR_BLOCK_SIZE observations through the tree with ordered splits only in lock-step.
+   On input i[k] is 1 (the root), on output it is the index of the leaf reached by the k-th observation */
+template <typename algorithmFPType, CpuType cpu>
+inline void traverseTreeVector(const ModelFPType * const values, const FeatureIndexType * const fIndexes, const FeatureIndexType maxLvl,
+                               const FeatureIndexType nFeat, const algorithmFPType * const x, FeatureIndexType * const i)
+{
+    for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
+        {
+            const FeatureIndexType idx = i[k];
+            i[k]                       = idx * 2 + (x[fIndexes[idx] + k * nFeat] > values[idx]);
+        }
+    }
+}
+
+#if defined(__INTEL_COMPILER)
+
+/* 16 (8 for double) observations per register, the node data and the features are loaded by gathers */
+template <>
+inline void traverseTreeVector<float, avx512>(const ModelFPType * const values, const FeatureIndexType * const fIndexes,
+                                              const FeatureIndexType maxLvl, const FeatureIndexType nFeat, const float * const x,
+                                              FeatureIndexType * const i)
+{
+    const __m512i rowOffsets = _mm512_mullo_epi32(_mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi32(nFeat));
+    const __m512i one        = _mm512_set1_epi32(1);
+    for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k += 16)
+    {
+        const float * const xk = x + k * nFeat;
+        __m512i idx            = _mm512_loadu_si512((const void *)(i + k));
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            const __m512i fi   = _mm512_i32gather_epi32(idx, (const int *)fIndexes, 4);
+            const __m512 sp    = _mm512_i32gather_ps(idx, values, 4);
+            const __m512 xv    = _mm512_i32gather_ps(_mm512_add_epi32(fi, rowOffsets), xk, 4);
+            const __mmask16 gt = _mm512_cmp_ps_mask(xv, sp, _CMP_GT_OS);
+            idx                = _mm512_slli_epi32(idx, 1);
+            idx                = _mm512_mask_add_epi32(idx, gt, idx, one);
+        }
+        _mm512_storeu_si512((void *)(i + k), idx);
+    }
+}
+
+template <>
+inline void traverseTreeVector<double, avx512>(const ModelFPType * const values, const FeatureIndexType * const fIndexes,
+                                               const FeatureIndexType maxLvl, const FeatureIndexType nFeat, const double * const x,
+                                               FeatureIndexType * const i)
+{
+    const __m256i rowOffsets = _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0), _mm256_set1_epi32(nFeat));
+    const __m256i one        = _mm256_set1_epi32(1);
+    for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k += 8)
+    {
+        const double * const xk = x + k * nFeat;
+        __m256i idx             = _mm256_loadu_si256((const __m256i *)(i + k));
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            const __m256i fi  = _mm256_i32gather_epi32((const int *)fIndexes, idx, 4);
+            const __m512d sp  = _mm512_cvtps_pd(_mm256_i32gather_ps(values, idx, 4));
+            const __m512d xv  = _mm512_i32gather_pd(_mm256_add_epi32(fi, rowOffsets), xk, 8);
+            const __mmask8 gt = _mm512_cmp_pd_mask(xv, sp, _CMP_GT_OS);
+            idx               = _mm256_slli_epi32(idx, 1);
+            idx               = _mm256_mask_add_epi32(idx, gt, idx, one);
+        }
+        _mm256_storeu_si256((__m256i *)(i + k), idx);
+    }
+}
+
+/* 8 (4 for double) observations per register, a true comparison is all ones, i.e. -1 */
+template <>
+inline void traverseTreeVector<float, avx2>(const ModelFPType * const values, const FeatureIndexType * const fIndexes, const FeatureIndexType maxLvl,
+                                            const FeatureIndexType nFeat, const float * const x, FeatureIndexType * const i)
+{
+    const __m256i rowOffsets = _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0), _mm256_set1_epi32(nFeat));
+    for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k += 8)
+    {
+        const float * const xk = x + k * nFeat;
+        __m256i idx            = _mm256_loadu_si256((const __m256i *)(i + k));
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            const __m256i fi = _mm256_i32gather_epi32((const int *)fIndexes, idx, 4);
+            const __m256 sp  = _mm256_i32gather_ps(values, idx, 4);
+            const __m256 xv  = _mm256_i32gather_ps(xk, _mm256_add_epi32(fi, rowOffsets), 4);
+            const __m256i gt = _mm256_castps_si256(_mm256_cmp_ps(xv, sp, _CMP_GT_OS));
+            idx              = _mm256_sub_epi32(_mm256_slli_epi32(idx, 1), gt);
+        }
+        _mm256_storeu_si256((__m256i *)(i + k), idx);
+    }
+}
+
+template <>
+inline void traverseTreeVector<double, avx2>(const ModelFPType * const values, const FeatureIndexType * const fIndexes,
+                                             const FeatureIndexType maxLvl, const FeatureIndexType nFeat, const double * const x,
+                                             FeatureIndexType * const i)
+{
+    const __m128i rowOffsets = _mm_mullo_epi32(_mm_set_epi32(3, 2, 1, 0), _mm_set1_epi32(nFeat));
+    const __m256i evenLanes  = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k += 4)
+    {
+        const double * const xk = x + k * nFeat;
+        __m128i idx             = _mm_loadu_si128((const __m128i *)(i + k));
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            const __m128i fi = _mm_i32gather_epi32((const int *)fIndexes, idx, 4);
+            const __m256d sp = _mm256_cvtps_pd(_mm_i32gather_ps(values, idx, 4));
+            const __m256d xv = _mm256_i32gather_pd(xk, _mm_add_epi32(fi, rowOffsets), 8);
+            const __m256i gt = _mm256_castpd_si256(_mm256_cmp_pd(xv, sp, _CMP_GT_OS));
+            idx              = _mm_sub_epi32(_mm_slli_epi32(idx, 1), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(gt, evenLanes)));
+        }
+        _mm_storeu_si128((__m128i *)(i + k), idx);
+    }
+}
+
+#endif
+
+/* Returns 1 if the observation goes to the right son of the ordered split. The missing value goes to the default son */
+template <typename algorithmFPType, CpuType cpu>
+inline FeatureIndexType goRightWithMissing(const algorithmFPType x, const ModelFPType splitPoint, const int defaultLeft)
+{
+    return services::internal::isNaN<cpu>(x) ? FeatureIndexType(!defaultLeft) : FeatureIndexType(x > splitPoint);
+}
+
 template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
 inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType v[])
 {
     const ModelFPType * const values        = t.getSplitPoints() - 1;
     const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
     const FeatureIndexType nFeat            = featTypes.getNumberOfFeatures();
+    const int * const defaultLeft           = t.getDefaultLeftForSplit() ? t.getDefaultLeftForSplit() - 1 : nullptr;
 
     FeatureIndexType i[VECTOR_BLOCK_SIZE];
     services::internal::service_memset_seq<FeatureIndexType, cpu>(i, FeatureIndexType(1), VECTOR_BLOCK_SIZE);
 
     const FeatureIndexType maxLvl = t.getMaxLvl();
 
-    if (featTypes.hasUnorderedFeatures())
+    if (defaultLeft)
+    {
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
+            {
+                const FeatureIndexType idx             = i[k];
+                const FeatureIndexType splitFeature    = fIndexes[idx];
+                const algorithmFPType valueFromDataSet = x[splitFeature + k * nFeat];
+                const FeatureIndexType goRight =
+                    (featTypes.isUnordered(splitFeature) ? int(valueFromDataSet) != int(values[idx]) :
+                                                           goRightWithMissing<algorithmFPType, cpu>(valueFromDataSet, values[idx], defaultLeft[idx]));
+                i[k] = idx * 2 + goRight;
+            }
+        }
+    }
+    else if (featTypes.hasUnorderedFeatures())
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
         {
@@ -76,16 +218,7 @@ inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes
     }
     else
     {
-        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
-        {
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
-            {
-                const FeatureIndexType idx = i[k];
-                i[k]                       = idx * 2 + (x[fIndexes[idx] + k * nFeat] > values[idx]);
-            }
-        }
+        traverseTreeVector<algorithmFPType, cpu>(values, fIndexes, maxLvl, nFeat, x, i);
     }
 
     PRAGMA_IVDEP
@@ -101,12 +234,23 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
 {
     const ModelFPType * const values        = (const ModelFPType *)t.getSplitPoints() - 1;
     const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
+    const int * const defaultLeft           = t.getDefaultLeftForSplit() ? t.getDefaultLeftForSplit() - 1 : nullptr;
 
     const FeatureIndexType maxLvl = t.getMaxLvl();
 
     FeatureIndexType i = 1;
 
-    if (featTypes.hasUnorderedFeatures())
+    if (defaultLeft)
+    {
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            const algorithmFPType xi = x[fIndexes[i]];
+            i = i * 2
+                + (featTypes.isUnordered(fIndexes[i]) ? int(xi) != int(values[i]) :
+                                                        goRightWithMissing<algorithmFPType, cpu>(xi, values[i], defaultLeft[i]));
+        }
+    }
+    else if (featTypes.hasUnorderedFeatures())
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
         {
@@ -124,38 +268,97 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
     return values[i];
 }
 
+/* Returns the average number of bytes taken by the nodes of a tree during the prediction */
+template <typename DecisionTreeType>
+inline size_t getAverageTreeSize(const DecisionTreeType * const * trees, size_t nTrees)
+{
+    size_t nNodes = 0;
+    for (size_t i = 0; i < nTrees; ++i) nNodes += trees[i]->getNumberOfNodes();
+    const size_t nAverageNodes = (nTrees ? (nNodes + nTrees - 1) / nTrees : 0);
+    return (nAverageNodes ? nAverageNodes : 1) * (sizeof(ModelFPType) + sizeof(FeatureIndexType));
+}
+
+/* Splits the prediction into tiles of (block of rows) x (block of trees).
+   The rows and the trees of a tile share L2 cache, so the nodes of a tree block are loaded once
+   and applied to every row of the data block */
 template <typename algorithmFPType>
 struct TileDimensions
 {
-    size_t nRowsTotal    = 0;
-    size_t nTreesTotal   = 0;
-    size_t nCols         = 0;
-    size_t nRowsInBlock  = 0;
-    size_t nTreesInBlock = 0;
-    size_t nDataBlocks   = 0;
-    size_t nTreeBlocks   = 0;
+    size_t nRowsTotal          = 0;
+    size_t nTreesTotal         = 0;
+    size_t nCols               = 0;
+    size_t nRowsInBlock        = 0;
+    size_t nTreesInBlock       = 0;
+    size_t nDataBlocks         = 0;
+    size_t nTreeBlocks         = 0;
+    size_t nTilesBetweenChecks = 0; /* number of tiles processed between the checks of the cancellation */
+    bool bTreeBlocksInParallel = false;
 
-    TileDimensions(const NumericTable & data, size_t nTrees)
+    TileDimensions(const NumericTable & data, size_t nTrees, size_t treeSize, size_t nYPerRow = 1)
         : nTreesTotal(nTrees), nRowsTotal(data.getNumberOfRows()), nCols(data.getNumberOfColumns())
     {
-        nRowsInBlock = nRowsTotal;
+        const size_t tileCacheSize = services::internal::getL2CacheSize() * 0.4;
+        const size_t nThreads      = daal::threader_get_threads_number();
 
-        if (nRowsTotal > 2 * VECTOR_BLOCK_SIZE)
+        nRowsInBlock =
+            services::internal::getNumElementsFitInMemory(tileCacheSize, (nCols + nYPerRow) * sizeof(algorithmFPType), nRowsInBlockDefault);
+        if (nRowsInBlock * nThreads > nRowsTotal)
         {
-            nRowsInBlock = 2 * VECTOR_BLOCK_SIZE;
+            nRowsInBlock = nRowsTotal / nThreads;
+        }
+        nRowsInBlock = (nRowsInBlock / VECTOR_BLOCK_SIZE) * VECTOR_BLOCK_SIZE;
+        if (nRowsInBlock < VECTOR_BLOCK_SIZE)
+        {
+            nRowsInBlock = VECTOR_BLOCK_SIZE;
+        }
+        nDataBlocks = nRowsTotal / nRowsInBlock + !!(nRowsTotal % nRowsInBlock);
 
-            if (daal::threader_get_threads_number() > nRowsTotal / nRowsInBlock)
-            {
-                nRowsInBlock = VECTOR_BLOCK_SIZE;
-            }
+        nTreesInBlock = services::internal::getNumElementsFitInMemory(tileCacheSize, treeSize, nTreesTotal);
+        if (nTreesInBlock > nTreesTotal)
+        {
+            nTreesInBlock = nTreesTotal;
         }
-        nDataBlocks = nRowsTotal / nRowsInBlock;
+        nTreeBlocks = (nTreesInBlock ? nTreesTotal / nTreesInBlock + !!(nTreesTotal % nTreesInBlock) : 0);
 
-        nTreesInBlock = nTreesTotal;
-        nTreeBlocks   = 1;
+        /* Too few data blocks to load all threads: tree blocks are also spread between threads
+           and every thread accumulates partial sums of its own */
+        bTreeBlocksInParallel = (nDataBlocks < nThreads) && (nTreeBlocks > 1);
+
+        nTilesBetweenChecks = nThreads * nTilesPerThreadBetweenChecks;
     }
+
+    size_t getNumberOfRowsInBlock(size_t iBlock) const { return (iBlock + 1 == nDataBlocks) ? nRowsTotal - iBlock * nRowsInBlock : nRowsInBlock; }
+
+    size_t getNumberOfTreesInBlock(size_t iTree) const { return (iTree + nTreesInBlock < nTreesTotal) ? nTreesInBlock : nTreesTotal - iTree; }
+
+    /* Number of data blocks processed between the checks of the cancellation when every thread walks all the tree blocks */
+    size_t getNumberOfDataBlocksBetweenChecks() const
+    {
+        return (nTreeBlocks > 1) ? (nTilesBetweenChecks + nTreeBlocks - 1) / nTreeBlocks : nTilesBetweenChecks;
+    }
+
+    static const size_t nRowsInBlockDefault          = 2 * VECTOR_BLOCK_SIZE;
+    static const size_t nTilesPerThreadBetweenChecks = 8;
 };
 
+/* Calls lambda(i) for i in [0, n) in parallel. The range is processed in parts of nInPart iterations,
+   before every part the host application is asked whether the computation is cancelled */
+template <typename F>
+services::Status threaderForCancellable(services::HostAppIface * pHostApp, size_t n, size_t nInPart, const F & lambda)
+{
+    services::internal::HostAppHelper host(pHostApp, 1);
+    daal::SafeStatus safeStat;
+    services::Status s;
+    for (size_t iFirst = 0; iFirst < n; iFirst += nInPart)
+    {
+        if (host.isCancelled(s, 1)) return s;
+        const size_t nPart = (iFirst + nInPart < n) ? nInPart : n - iFirst;
+        daal::threader_for(nPart, nPart, [&](size_t i) { lambda(iFirst + i, safeStat); });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    return s;
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace gbt */
@@ -0,0 +1,525 @@
+/* file: gbt_predict_tree_shap_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of SHAP values computation for gradient boosted trees
+//  (TreeSHAP algorithm by Lundberg et al., "Consistent Individualized
+//  Feature Attribution for Tree Ensembles")
+//--
+*/
+
+#ifndef __GBT_PREDICT_TREE_SHAP_IMPL_I__
+#define __GBT_PREDICT_TREE_SHAP_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/externals/service_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::internal;
+
+/* Element of the path of unique features from the root of the tree to the current node */
+template <typename algorithmFPType>
+struct ShapPathElement
+{
+    int featureIndex;             /* Index of the feature split on, -1 for the root */
+    algorithmFPType zeroFraction; /* Fraction of the training samples passing the path when the feature is absent */
+    algorithmFPType oneFraction;  /* 1 if the observation passes the path when the feature is present, 0 otherwise */
+    algorithmFPType pWeight;      /* Proportion of the feature subsets of a given cardinality passing the path */
+};
+
+/* Number of path elements needed to process a tree of the given depth */
+inline size_t getShapPathSize(size_t maxLvl)
+{
+    const size_t maxDepth = maxLvl + 2;
+    return maxDepth * (maxDepth + 1) / 2;
+}
+
+/* SHAP values of a single tree. The fractions of the training samples that reached every node
+   (node covers) define the expected tree response when a subset of the features is unknown */
+template <typename algorithmFPType, CpuType cpu>
+class TreeShap
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+    typedef ShapPathElement<algorithmFPType> PathElement;
+
+    TreeShap(const TreeType & t, const int * nodeCovers, const FeatureTypes & featTypes)
+        : _splitPoints(t.getSplitPoints()),
+          _fIndexes(t.getFeatureIndexesForSplit()),
+          _defaultLeft(t.getDefaultLeftForSplit()),
+          _covers(nodeCovers),
+          _featTypes(featTypes),
+          _maxLvl(t.getMaxLvl())
+    {}
+
+    /* Cover-weighted mean response of the tree, i.e. the bias term of its SHAP values */
+    algorithmFPType getExpectedValue() const { return getMeanValue(0, 0); }
+
+    /* Adds SHAP values of the observation x to phi[0..nFeatures). condition == 0 gives the feature contributions,
+       condition > 0 (< 0) gives them when the feature conditionFeature is known to be present (absent) */
+    void compute(const algorithmFPType * x, algorithmFPType * phi, PathElement * path, int condition = 0, FeatureIndexType conditionFeature = 0) const
+    {
+        path[0].featureIndex = -1;
+        path[0].zeroFraction = path[0].oneFraction = path[0].pWeight = 1;
+        computeRecursive(x, phi, 0, 0, 0, path, 1, 1, -1, condition, conditionFeature, 1);
+    }
+
+    /* Collects unique indices of the features the tree splits on, returns their number */
+    size_t getSplitFeatures(FeatureIndexType * features) const
+    {
+        size_t nFeatures = 0;
+        collectSplitFeatures(0, 0, features, nFeatures);
+        return nFeatures;
+    }
+
+protected:
+    bool isLeaf(size_t idx, size_t lvl) const
+    {
+        if (lvl == _maxLvl) return true;
+        /* Sons of a leaf are its dummy copies with the same number of training samples,
+           while every son of a split node gets at least one sample and so fewer samples than its parent */
+        return _covers[2 * idx + 1] == _covers[idx];
+    }
+
+    algorithmFPType getCoverFraction(size_t idx, algorithmFPType parentCover) const
+    {
+        return parentCover > 0 ? algorithmFPType(_covers[idx]) / parentCover : algorithmFPType(0.5);
+    }
+
+    bool goRight(size_t idx, const algorithmFPType * x) const
+    {
+        const FeatureIndexType iFeature = _fIndexes[idx];
+        if (_featTypes.isUnordered(iFeature)) return int(x[iFeature]) != int(_splitPoints[idx]);
+        if (_defaultLeft && services::internal::isNaN<cpu>(x[iFeature])) return !_defaultLeft[idx];
+        return x[iFeature] > _splitPoints[idx];
+    }
+
+    algorithmFPType getMeanValue(size_t idx, size_t lvl) const
+    {
+        if (isLeaf(idx, lvl)) return _splitPoints[idx];
+        const algorithmFPType cover = _covers[idx];
+        const size_t left           = 2 * idx + 1;
+        return getCoverFraction(left, cover) * getMeanValue(left, lvl + 1) + getCoverFraction(left + 1, cover) * getMeanValue(left + 1, lvl + 1);
+    }
+
+    void collectSplitFeatures(size_t idx, size_t lvl, FeatureIndexType * features, size_t & nFeatures) const
+    {
+        if (isLeaf(idx, lvl)) return;
+        size_t i = 0;
+        for (; (i < nFeatures) && (features[i] != _fIndexes[idx]); ++i)
+            ;
+        if (i == nFeatures) features[nFeatures++] = _fIndexes[idx];
+        collectSplitFeatures(2 * idx + 1, lvl + 1, features, nFeatures);
+        collectSplitFeatures(2 * idx + 2, lvl + 1, features, nFeatures);
+    }
+
+    static void extendPath(PathElement * path, int depth, algorithmFPType zeroFraction, algorithmFPType oneFraction, int featureIndex)
+    {
+        path[depth].featureIndex = featureIndex;
+        path[depth].zeroFraction = zeroFraction;
+        path[depth].oneFraction  = oneFraction;
+        path[depth].pWeight      = (depth == 0 ? 1 : 0);
+        const algorithmFPType invDepth = algorithmFPType(1) / algorithmFPType(depth + 1);
+        for (int i = depth - 1; i >= 0; --i)
+        {
+            path[i + 1].pWeight += oneFraction * path[i].pWeight * (i + 1) * invDepth;
+            path[i].pWeight = zeroFraction * path[i].pWeight * (depth - i) * invDepth;
+        }
+    }
+
+    static void unwindPath(PathElement * path, int depth, int pathIndex)
+    {
+        const algorithmFPType oneFraction  = path[pathIndex].oneFraction;
+        const algorithmFPType zeroFraction = path[pathIndex].zeroFraction;
+        algorithmFPType nextOnePortion     = path[depth].pWeight;
+        for (int i = depth - 1; i >= 0; --i)
+        {
+            if (oneFraction != 0)
+            {
+                const algorithmFPType tmp = path[i].pWeight;
+                path[i].pWeight           = nextOnePortion * (depth + 1) / ((i + 1) * oneFraction);
+                nextOnePortion            = tmp - path[i].pWeight * zeroFraction * (depth - i) / algorithmFPType(depth + 1);
+            }
+            else
+            {
+                path[i].pWeight = path[i].pWeight * (depth + 1) / (zeroFraction * (depth - i));
+            }
+        }
+        for (int i = pathIndex; i < depth; ++i)
+        {
+            path[i].featureIndex = path[i + 1].featureIndex;
+            path[i].zeroFraction = path[i + 1].zeroFraction;
+            path[i].oneFraction  = path[i + 1].oneFraction;
+        }
+    }
+
+    /* Sum of the path weights as if the element pathIndex was unwound from the path */
+    static algorithmFPType unwoundPathSum(const PathElement * path, int depth, int pathIndex)
+    {
+        const algorithmFPType oneFraction  = path[pathIndex].oneFraction;
+        const algorithmFPType zeroFraction = path[pathIndex].zeroFraction;
+        algorithmFPType nextOnePortion     = path[depth].pWeight;
+        algorithmFPType total              = 0;
+        for (int i = depth - 1; i >= 0; --i)
+        {
+            if (oneFraction != 0)
+            {
+                const algorithmFPType tmp = nextOnePortion * (depth + 1) / ((i + 1) * oneFraction);
+                total += tmp;
+                nextOnePortion = path[i].pWeight - tmp * zeroFraction * (depth - i) / algorithmFPType(depth + 1);
+            }
+            else if (zeroFraction != 0)
+            {
+                total += path[i].pWeight * (depth + 1) / (zeroFraction * (depth - i));
+            }
+        }
+        return total;
+    }
+
+    void computeRecursive(const algorithmFPType * x, algorithmFPType * phi, size_t idx, size_t lvl, int depth, PathElement * parentPath,
+                          algorithmFPType parentZeroFraction, algorithmFPType parentOneFraction, int parentFeature, int condition,
+                          FeatureIndexType conditionFeature, algorithmFPType conditionFraction) const
+    {
+        if (conditionFraction == 0) return;
+
+        /* every node extends its own copy of the path */
+        PathElement * path = parentPath + depth + 1;
+        for (int i = 0; i <= depth; ++i) path[i] = parentPath[i];
+        if (condition == 0 || int(conditionFeature) != parentFeature)
+        {
+            extendPath(path, depth, parentZeroFraction, parentOneFraction, parentFeature);
+        }
+
+        if (isLeaf(idx, lvl))
+        {
+            const algorithmFPType value = _splitPoints[idx] * conditionFraction;
+            for (int i = 1; i <= depth; ++i)
+            {
+                const algorithmFPType w = unwoundPathSum(path, depth, i);
+                phi[path[i].featureIndex] += w * (path[i].oneFraction - path[i].zeroFraction) * value;
+            }
+            return;
+        }
+
+        /* the observation follows the hot branch */
+        const size_t hotIdx                    = 2 * idx + 1 + goRight(idx, x);
+        const size_t coldIdx                   = 4 * idx + 3 - hotIdx;
+        const algorithmFPType cover            = _covers[idx];
+        const algorithmFPType hotZeroFraction  = getCoverFraction(hotIdx, cover);
+        const algorithmFPType coldZeroFraction = getCoverFraction(coldIdx, cover);
+        const FeatureIndexType splitFeature    = _fIndexes[idx];
+
+        /* undo the previous split on the same feature to redo it at this node */
+        algorithmFPType incomingZeroFraction = 1;
+        algorithmFPType incomingOneFraction  = 1;
+        int pathIndex                        = 0;
+        for (; (pathIndex <= depth) && (path[pathIndex].featureIndex != int(splitFeature)); ++pathIndex)
+            ;
+        if (pathIndex <= depth)
+        {
+            incomingZeroFraction = path[pathIndex].zeroFraction;
+            incomingOneFraction  = path[pathIndex].oneFraction;
+            unwindPath(path, depth, pathIndex);
+            --depth;
+        }
+
+        algorithmFPType hotConditionFraction  = conditionFraction;
+        algorithmFPType coldConditionFraction = conditionFraction;
+        if (condition != 0 && splitFeature == conditionFeature)
+        {
+            if (condition > 0)
+            {
+                coldConditionFraction = 0;
+            }
+            else
+            {
+                hotConditionFraction *= hotZeroFraction;
+                coldConditionFraction *= coldZeroFraction;
+            }
+            --depth;
+        }
+
+        computeRecursive(x, phi, hotIdx, lvl + 1, depth + 1, path, hotZeroFraction * incomingZeroFraction, incomingOneFraction, int(splitFeature),
+                         condition, conditionFeature, hotConditionFraction);
+        computeRecursive(x, phi, coldIdx, lvl + 1, depth + 1, path, coldZeroFraction * incomingZeroFraction, 0, int(splitFeature), condition,
+                         conditionFeature, coldConditionFraction);
+    }
+
+protected:
+    const ModelFPType * _splitPoints;
+    const FeatureIndexType * _fIndexes;
+    const int * _defaultLeft;
+    const int * _covers;
+    const FeatureTypes & _featTypes;
+    const size_t _maxLvl;
+};
+
+/* Computes SHAP feature contributions and/or SHAP interaction values of the ensemble of trees.
+   Rows and trees are split into tiles the same way as in the prediction */
+template <typename algorithmFPType, CpuType cpu>
+class TreeShapTask
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+    typedef ShapPathElement<algorithmFPType> PathElement;
+
+    TreeShapTask(const NumericTable * x, const TreeType * const * trees, const int * const * covers, size_t nTrees, const FeatureTypes & featTypes)
+        : _data(x), _aTree(trees), _aCover(covers), _nTrees(nTrees), _featHelper(featTypes), _nPhi(x->getNumberOfColumns() + 1)
+    {}
+
+    /* Computes contributions (n x (p + 1), bias in the last column) and interactions (n x (p + 1)^2), either of them can be null */
+    services::Status run(services::HostAppIface * pHostApp, NumericTable * contributions, NumericTable * interactions);
+
+protected:
+    services::Status init(bool bInteractions);
+    void computeBlock(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nRows, algorithmFPType * contribs,
+                      algorithmFPType * inters, algorithmFPType * phi, PathElement * path) const;
+    void computeInteractions(const TreeShap<algorithmFPType, cpu> & tree, size_t iTree, const algorithmFPType * x, algorithmFPType * phi,
+                             algorithmFPType * inters, algorithmFPType * phiOn, algorithmFPType * phiOff, PathElement * path) const;
+
+protected:
+    const NumericTable * _data;
+    const TreeType * const * _aTree;
+    const int * const * _aCover;
+    const size_t _nTrees;
+    const FeatureTypes & _featHelper;
+    const size_t _nPhi;
+    size_t _pathSize = 0;
+    TArray<algorithmFPType, cpu> _aExpectedValue;
+    TArray<size_t, cpu> _aSplitFeaturesOffset;
+    TArray<FeatureIndexType, cpu> _aSplitFeatures;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status TreeShapTask<algorithmFPType, cpu>::init(bool bInteractions)
+{
+    _aExpectedValue.reset(_nTrees);
+    DAAL_CHECK_MALLOC(_aExpectedValue.get());
+
+    size_t maxLvl = 0;
+    size_t nNodes = 0;
+    for (size_t iTree = 0; iTree < _nTrees; ++iTree)
+    {
+        DAAL_CHECK(_aCover[iTree], services::ErrorModelNotFullInitialized);
+        _aExpectedValue[iTree] = TreeShap<algorithmFPType, cpu>(*_aTree[iTree], _aCover[iTree], _featHelper).getExpectedValue();
+        if (_aTree[iTree]->getMaxLvl() > maxLvl) maxLvl = _aTree[iTree]->getMaxLvl();
+        nNodes += _aTree[iTree]->getNumberOfNodes();
+    }
+    _pathSize = getShapPathSize(maxLvl);
+
+    if (bInteractions)
+    {
+        /* interactions are only computed for the features a tree splits on, other ones have zero contribution to it */
+        _aSplitFeaturesOffset.reset(_nTrees + 1);
+        _aSplitFeatures.reset(nNodes ? nNodes : 1);
+        DAAL_CHECK_MALLOC(_aSplitFeaturesOffset.get() && _aSplitFeatures.get());
+        _aSplitFeaturesOffset[0] = 0;
+        for (size_t iTree = 0; iTree < _nTrees; ++iTree)
+        {
+            const TreeShap<algorithmFPType, cpu> tree(*_aTree[iTree], _aCover[iTree], _featHelper);
+            const size_t offset              = _aSplitFeaturesOffset[iTree];
+            _aSplitFeaturesOffset[iTree + 1] = offset + tree.getSplitFeatures(_aSplitFeatures.get() + offset);
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status TreeShapTask<algorithmFPType, cpu>::run(services::HostAppIface * pHostApp, NumericTable * contributions, NumericTable * interactions)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, init(interactions != nullptr));
+
+    const size_t nContribs = (contributions ? _nPhi : 0);
+    const size_t nInters   = (interactions ? _nPhi * _nPhi : 0);
+    const size_t treeSize  = getAverageTreeSize(_aTree, _nTrees);
+    TileDimensions<algorithmFPType> dim(*_data, _nTrees, treeSize, nContribs + nInters);
+
+    HostAppHelper host(pHostApp, 100);
+    if (host.isCancelled(s, 1)) return s;
+
+    /* per thread buffers: SHAP values of one tree and the ones conditioned on a feature being present or absent */
+    daal::TlsMem<algorithmFPType, cpu> tlsPhi(3 * _nPhi);
+    daal::TlsMem<PathElement, cpu> tlsPath(_pathSize);
+    SafeStatus safeStat;
+
+    if (!dim.bTreeBlocksInParallel)
+    {
+        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+            const size_t iStartRow      = iBlock * dim.nRowsInBlock;
+            const size_t nRowsToProcess = dim.getNumberOfRowsInBlock(iBlock);
+            algorithmFPType * const phi = tlsPhi.local();
+            PathElement * const path    = tlsPath.local();
+            DAAL_CHECK_MALLOC_THR(phi && path);
+
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            WriteOnlyRows<algorithmFPType, cpu> contribBD;
+            WriteOnlyRows<algorithmFPType, cpu> interBD;
+            if (contributions)
+            {
+                contribBD.set(contributions, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(contribBD);
+                services::internal::service_memset_seq<algorithmFPType, cpu>(contribBD.get(), 0, nRowsToProcess * nContribs);
+            }
+            if (interactions)
+            {
+                interBD.set(interactions, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(interBD);
+                services::internal::service_memset_seq<algorithmFPType, cpu>(interBD.get(), 0, nRowsToProcess * nInters);
+            }
+
+            for (size_t iTree = 0; iTree < _nTrees; iTree += dim.nTreesInBlock)
+            {
+                computeBlock(iTree, dim.getNumberOfTreesInBlock(iTree), xBD.get(), nRowsToProcess, contribBD.get(), interBD.get(), phi, path);
+            }
+        });
+        return safeStat.detach();
+    }
+
+    /* every thread accumulates partial sums over its own tiles */
+    daal::TlsSum<algorithmFPType, cpu> partialContribs(dim.nRowsTotal * nContribs);
+    daal::TlsSum<algorithmFPType, cpu> partialInters(dim.nRowsTotal * nInters);
+    const size_t nTiles = dim.nDataBlocks * dim.nTreeBlocks;
+
+    daal::threader_for(nTiles, nTiles, [&](size_t iTile) {
+        const size_t iBlock         = iTile / dim.nTreeBlocks;
+        const size_t iTree          = (iTile % dim.nTreeBlocks) * dim.nTreesInBlock;
+        const size_t iStartRow      = iBlock * dim.nRowsInBlock;
+        const size_t nRowsToProcess = dim.getNumberOfRowsInBlock(iBlock);
+        algorithmFPType * const phi = tlsPhi.local();
+        PathElement * const path    = tlsPath.local();
+        DAAL_CHECK_MALLOC_THR(phi && path);
+
+        algorithmFPType * localContribs = nullptr;
+        algorithmFPType * localInters   = nullptr;
+        if (contributions)
+        {
+            localContribs = partialContribs.local();
+            DAAL_CHECK_MALLOC_THR(localContribs);
+            localContribs += iStartRow * nContribs;
+        }
+        if (interactions)
+        {
+            localInters = partialInters.local();
+            DAAL_CHECK_MALLOC_THR(localInters);
+            localInters += iStartRow * nInters;
+        }
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+
+        computeBlock(iTree, dim.getNumberOfTreesInBlock(iTree), xBD.get(), nRowsToProcess, localContribs, localInters, phi, path);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    if (contributions)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> contribBD(contributions, 0, dim.nRowsTotal);
+        DAAL_CHECK_BLOCK_STATUS(contribBD);
+        services::internal::service_memset<algorithmFPType, cpu>(contribBD.get(), 0, dim.nRowsTotal * nContribs);
+        partialContribs.reduceTo(contribBD.get(), dim.nRowsTotal * nContribs);
+    }
+    if (interactions)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> interBD(interactions, 0, dim.nRowsTotal);
+        DAAL_CHECK_BLOCK_STATUS(interBD);
+        services::internal::service_memset<algorithmFPType, cpu>(interBD.get(), 0, dim.nRowsTotal * nInters);
+        partialInters.reduceTo(interBD.get(), dim.nRowsTotal * nInters);
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void TreeShapTask<algorithmFPType, cpu>::computeBlock(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nRows,
+                                                      algorithmFPType * contribs, algorithmFPType * inters, algorithmFPType * phi,
+                                                      PathElement * path) const
+{
+    const size_t nCols = _nPhi - 1;
+    for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+    {
+        const TreeShap<algorithmFPType, cpu> tree(*_aTree[iTree], _aCover[iTree], _featHelper);
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            const algorithmFPType * const xRow = x + iRow * nCols;
+            services::internal::service_memset_seq<algorithmFPType, cpu>(phi, 0, _nPhi);
+            tree.compute(xRow, phi, path);
+            phi[nCols] = _aExpectedValue[iTree];
+
+            if (contribs)
+            {
+                algorithmFPType * const contribsRow = contribs + iRow * _nPhi;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < _nPhi; ++j) contribsRow[j] += phi[j];
+            }
+            if (inters)
+            {
+                computeInteractions(tree, iTree, xRow, phi, inters + iRow * _nPhi * _nPhi, phi + _nPhi, phi + 2 * _nPhi, path);
+            }
+        }
+    }
+}
+
+/* Interaction of the features i and j is the half difference of the contributions of j with i present and absent.
+   The main effect of i is its contribution less its interactions with all other features */
+template <typename algorithmFPType, CpuType cpu>
+void TreeShapTask<algorithmFPType, cpu>::computeInteractions(const TreeShap<algorithmFPType, cpu> & tree, size_t iTree, const algorithmFPType * x,
+                                                             algorithmFPType * phi, algorithmFPType * inters, algorithmFPType * phiOn,
+                                                             algorithmFPType * phiOff, PathElement * path) const
+{
+    const FeatureIndexType * const features = _aSplitFeatures.get() + _aSplitFeaturesOffset[iTree];
+    const size_t nFeatures                  = _aSplitFeaturesOffset[iTree + 1] - _aSplitFeaturesOffset[iTree];
+    for (size_t k = 0; k < nFeatures; ++k)
+    {
+        const FeatureIndexType i = features[k];
+        services::internal::service_memset_seq<algorithmFPType, cpu>(phiOn, 0, 2 * _nPhi);
+        tree.compute(x, phiOn, path, 1, i);
+        tree.compute(x, phiOff, path, -1, i);
+
+        algorithmFPType * const intersRow = inters + i * _nPhi;
+        for (size_t j = 0; j < _nPhi; ++j)
+        {
+            if (j == i) continue;
+            const algorithmFPType value = (phiOn[j] - phiOff[j]) / 2;
+            intersRow[j] += value;
+            phi[i] -= value;
+        }
+    }
+    for (size_t j = 0; j < _nPhi; ++j) inters[j * _nPhi + j] += phi[j];
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
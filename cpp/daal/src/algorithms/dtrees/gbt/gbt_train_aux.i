@@ -32,6 +32,9 @@
 #include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
 #include "services/daal_atomic_int.h"
 #include "src/externals/service_service.h"
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(gbt.train.dense.default);
 
 namespace daal
 {
@@ -70,6 +73,17 @@ size_t getNBlocksForOpt(size_t nThreads, size_t n)
     return nBlocks;
 }
 
+/* Checks if the row-wise histogram kernel can be used, i.e. if the row-major bins of the features are needed.
+   The kernel is used on the binned data only: in the exact mode every unique value is a bin and the per-thread
+   histograms of all the features are as large as the data set itself. With the feature sampling a pass over the bins
+   of a row pays off only if a few features of the row are sampled */
+template <CpuType cpu>
+bool isRowWiseHistKernelAvailable(bool memorySavingMode, gbt::training::SplitMethod splitMethod, size_t nFeatures, size_t nFeaturesPerNode)
+{
+    if (memorySavingMode || splitMethod != gbt::training::inexact) return false;
+    return (nFeaturesPerNode == nFeatures) || (nFeatures >= 4 && nFeaturesPerNode >= 2);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Data helper class for regression
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -733,7 +747,7 @@ struct GlobalStorages
     using TlsType   = TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu>;
 
     GlobalStorages(size_t nFeatures, size_t nStor, size_t nUniq, size_t nGlobal)
-        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures)
+        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures), newFI(nullptr)
     {}
 
     GroupOfStorages<GHSumType, cpu> singleGHSums;
@@ -741,7 +755,7 @@ struct GlobalStorages
     TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr;
     size_t nDiffFeatMax;
 
-    BinIndexType * newFI;
+    BinIndexType * newFI; // bins of the features in row-major layout, null if not built
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
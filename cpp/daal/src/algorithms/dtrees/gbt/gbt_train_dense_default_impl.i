@@ -269,6 +269,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
                                                                              HomogenNumericTable<int> ** aTblSmplCnt, size_t iIteration,
                                                                              GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(iteration);
     for (size_t i = 0; i < _nTrees; ++i)
     {
         aTbl[i]        = nullptr;
@@ -299,7 +300,10 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
         }
         daal::algorithms::internal::qSort<RowIndexType, cpu>(nSamples(), aSampleToF);
     }
-    step(this->_dataHelper.y());
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(iteration.step);
+        step(this->_dataHelper.y());
+    }
     _nParallelNodes.set(0);
     return buildTrees(aTbl, aTblImp, aTblSmplCnt, GH_SUMS_BUF);
 }
@@ -368,6 +372,7 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
                                  algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                                  algorithmFPType * ptrTotalGain)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
     services::Status s;
 
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
@@ -441,8 +446,10 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 
     TVector<BinIndexType, cpu, ScalableAllocator<cpu> > newFIArr;
 
-    if (inexactWithHistMethod)
+    /* Row-major bins are used by the row-wise histogram kernel: for all the nodes without the feature sampling, for the small nodes otherwise */
+    if (isRowWiseHistKernelAvailable<cpu>(par.memorySavingMode, par.splitMethod, x->getNumberOfColumns(), nFeaturesPerNode))
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.transposeBins);
         size_t nThreads    = threader_get_threads_number();
         size_t nRows       = x->getNumberOfRows();
         size_t nCols       = x->getNumberOfColumns();
@@ -73,8 +73,11 @@ public:
                      DAAL_INT & idxFeatureBestSplit, bool featureUnordered,
                      SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> & data, size_t iFeature)
     {
+        const bool hasMissing = data.ctx.dataHelper().indexedFeatures().hasMissing(iFeature);
         if (featureUnordered)
-            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit);
+            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, hasMissing);
+        else if (hasMissing)
+            findOrderedWithMissing(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit);
         else
             findOrdered(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, data, iFeature);
     }
@@ -114,8 +117,64 @@ public:
         split.impurityDecrease = bestImpDecrease;
     }
 
+    /* Missing values are tried in both sons of every split, the best son becomes the default one for the missing values */
+    static void findOrderedWithMissing(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
+                                       DAAL_INT & idxFeatureBestSplit)
+    {
+        const size_t nUnique         = res.nUnique;
+        auto * aGHSum                = res.ghSums;
+        const size_t iMissing        = dtrees::internal::IndexedFeatures::missingIndex();
+        const ImpurityType & missing = aGHSum[iMissing];
+        const size_t nMissing        = size_t(aGHSum[iMissing].n);
+        size_t nLeft                 = 0;
+
+        ImpurityType imp(res.gTotal, res.hTotal);
+
+        ImpurityType left;
+        algorithmFPType bestImpDecrease = -services::internal::MaxVal<algorithmFPType>::get();
+
+        for (size_t i = iMissing + 1; i < nUnique; ++i)
+        {
+            if (!aGHSum[i].n) continue;
+            nLeft += aGHSum[i].n;
+            if ((n - nLeft) < minObservationsInLeafNode) break;
+            left.add(aGHSum[i]);
+            if (nLeft >= minObservationsInLeafNode)
+            {
+                //missing values go to the right son
+                ImpurityType right(imp, left);
+                const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
+                if (impDecrease > bestImpDecrease)
+                {
+                    split.left          = left;
+                    split.nLeft         = nLeft;
+                    split.defaultLeft   = !nMissing; //nothing is learnt if there are no missing values in the node
+                    idxFeatureBestSplit = i;
+                    bestImpDecrease     = impDecrease;
+                }
+            }
+            if (nMissing && (nLeft + nMissing >= minObservationsInLeafNode) && (n - nLeft - nMissing >= minObservationsInLeafNode))
+            {
+                //missing values go to the left son
+                ImpurityType leftWithMissing(left);
+                leftWithMissing.add(missing);
+                ImpurityType right(imp, leftWithMissing);
+                const algorithmFPType impDecrease = leftWithMissing.value(lambda) + right.value(lambda);
+                if (impDecrease > bestImpDecrease)
+                {
+                    split.left          = leftWithMissing;
+                    split.nLeft         = nLeft + nMissing;
+                    split.defaultLeft   = true;
+                    idxFeatureBestSplit = i;
+                    bestImpDecrease     = impDecrease;
+                }
+            }
+        }
+        split.impurityDecrease = bestImpDecrease;
+    }
+
     static void findCategorical(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
-                                DAAL_INT & idxFeatureBestSplit)
+                                DAAL_INT & idxFeatureBestSplit, bool hasMissing)
     {
         const size_t nUnique = res.nUnique;
         auto * aGHSum        = res.ghSums;
@@ -126,6 +185,8 @@ public:
 
         for (size_t i = 0; i < nUnique; ++i)
         {
+            //missing values are not a category, they always go to the right son
+            if (hasMissing && (i == dtrees::internal::IndexedFeatures::missingIndex())) continue;
             if ((aGHSum[i].n < minObservationsInLeafNode) || ((n - aGHSum[i].n) < minObservationsInLeafNode)) continue;
             const ImpurityType & left = aGHSum[i];
             ImpurityType right(imp, left);
@@ -273,6 +334,59 @@ struct ComputeGHSumByRows
     }
 };
 
+/* Same as ComputeGHSumByRows but updates the histograms of the sampled features only.
+   The bins of the row are contiguous, so the sampled features of one row are read from a few cache lines */
+template <typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu>
+struct ComputeGHSumByRowsForFeatures
+{
+    static void run(algorithmFPType * aGHSumFP, const BinIndexType * indexedFeature, const RowIndexType * aIdx, algorithmFPType * pgh,
+                    size_t nFeatures, const RowIndexType * featureSample, size_t nSampledFeatures, size_t iStart, size_t iEnd, size_t nRows,
+                    size_t * UniquesArr)
+    {
+        const size_t prefetchOffset = 10; // heuristic, prefetch on 10 rows ahead
+        const size_t iEndWithPrefetch =
+            services::internal::min<cpu, size_t>((nRows > prefetchOffset ? nRows - prefetchOffset : 0), iEnd);
+
+        RowIndexType i = iStart;
+        for (; i < iEndWithPrefetch; ++i)
+        {
+            DAAL_PREFETCH_READ_T0(pgh + 2 * aIdx[i + prefetchOffset]);
+            DAAL_PREFETCH_READ_T0(indexedFeature + aIdx[i + prefetchOffset] * nFeatures);
+
+            const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            const algorithmFPType g      = pgh[2 * aIdx[i]];
+            const algorithmFPType h      = pgh[2 * aIdx[i] + 1];
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < nSampledFeatures; j++)
+            {
+                const RowIndexType iFeature = featureSample[j];
+                const size_t idx            = 4 * (UniquesArr[iFeature] + (size_t)featIdx[iFeature]);
+                aGHSumFP[idx + 0] += g;
+                aGHSumFP[idx + 1] += h;
+                aGHSumFP[idx + 2] += algorithmFPType(1);
+            }
+        }
+
+        for (; i < iEnd; ++i)
+        {
+            const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            const algorithmFPType g      = pgh[2 * aIdx[i]];
+            const algorithmFPType h      = pgh[2 * aIdx[i] + 1];
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < nSampledFeatures; j++)
+            {
+                const RowIndexType iFeature = featureSample[j];
+                const size_t idx            = 4 * (UniquesArr[iFeature] + (size_t)featIdx[iFeature]);
+                aGHSumFP[idx + 0] += g;
+                aGHSumFP[idx + 1] += h;
+                aGHSumFP[idx + 2] += algorithmFPType(1);
+            }
+        }
+    }
+};
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MergeGHSums
 {
@@ -64,6 +64,7 @@ public:
         if (iFeature >= 0)
         {
             typename NodeType::Split * res = makeSplit(iFeature, _split.featureValue, _split.featureUnordered);
+            res->defaultLeft               = _split.defaultLeft;
             _node.res                      = res;
             res->kid[0]                    = buildLeaf(_node.iStart, _split.nLeft, _node.level + 1, _split.left);
 
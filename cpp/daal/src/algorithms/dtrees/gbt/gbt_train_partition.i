@@ -61,6 +61,7 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(buildTree.partition);
         int * bestSplitIdx = _sharedData.bestSplitIdxBuf + _nodeInfo.iStart;
         int * aIdx         = _sharedData.aIdx + _nodeInfo.iStart;
 
@@ -151,12 +152,16 @@ protected:
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType & split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature), split.featureUnordered,
-                              idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _sharedData.ctx.dataHelper().indexedFeatures();
+        //index of the missing values if they go to the right son, -1 otherwise
+        const RowIndexType idxMissingRight =
+            (!split.featureUnordered && !split.defaultLeft && indexedFeatures.hasMissing(iFeature)) ? indexedFeatures.missingIndex() : -1;
+        return doPartitionIdx(n, _sharedData.aIdx + iStart, indexedFeatures.data(iFeature), split.featureUnordered, idxFeatureValueBestSplit,
+                              idxMissingRight, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
     }
 
     DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const RowIndexType * indexedFeature, bool featureUnordered,
-                            RowIndexType idxFeatureValueBestSplit, RowIndexType * buffer, RowIndexType nLeft)
+                            RowIndexType idxFeatureValueBestSplit, RowIndexType idxMissingRight, RowIndexType * buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
 
@@ -201,7 +206,8 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] > idxFeatureValueBestSplit)
+                    const RowIndexType idx = indexedFeature[aIdx[i]];
+                    if ((idx > idxFeatureValueBestSplit) || (idx == idxMissingRight))
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
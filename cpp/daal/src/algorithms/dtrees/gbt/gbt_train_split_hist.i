@@ -54,6 +54,8 @@ template <typename algorithmFPType, typename RowIndexType, typename BinIndexType
 class MaxImpurityDecreaseHelper;
 template <typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu>
 struct ComputeGHSumByRows;
+template <typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu>
+struct ComputeGHSumByRowsForFeatures;
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MergeGHSums;
 
@@ -78,6 +80,7 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(buildTree.splitByColumns);
         _res.ghSums   = nullptr;
         _res.isFailed = true;
         computeGHSums();
@@ -170,6 +173,7 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(buildTree.findBestSplit);
         const size_t nUnique = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
 
         _res1.isFailed = true;
@@ -290,6 +294,7 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(buildTree.findBestSplit);
         const size_t nUnique = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
 
         _res1.isFailed = true;
@@ -348,12 +353,20 @@ public:
     using GHSums         = GHSumsHelper<algorithmFPType, RowIndexType, BinIndexType, GHSumType, cpu>;
     using TlsType        = TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu>;
 
-    ComputeGHSumsByRowsTask(size_t iBlock, size_t blockSize, SharedDataType & data, const NodeInfoType & nodeInfo, TlsType * res)
-        : _iBlock(iBlock), _blockSize(blockSize), _data(data), _node(nodeInfo), _res(res)
+    ComputeGHSumsByRowsTask(size_t iBlock, size_t blockSize, SharedDataType & data, const NodeInfoType & nodeInfo, TlsType * res,
+                            const RowIndexType * featureSample = nullptr, size_t nSampledFeatures = 0)
+        : _iBlock(iBlock),
+          _blockSize(blockSize),
+          _data(data),
+          _node(nodeInfo),
+          _res(res),
+          _featureSample(featureSample),
+          _nSampledFeatures(nSampledFeatures)
     {}
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(buildTree.computeGHSumsByRows);
         const BinIndexType * indexedFeature = _data.GH_SUMS_BUF->newFI;
         int * aIdx                          = _data.aIdx;
         const RowIndexType nFeatures        = _data.ctx.nFeatures();
@@ -367,13 +380,31 @@ public:
 
         if (!local->isInitilized)
         {
-            GHSums::fillByZero(_data.GH_SUMS_BUF->nDiffFeatMax, aGHSum);
+            if (_featureSample)
+            {
+                /* Only the histograms of the sampled features are computed and merged */
+                const auto & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+                for (size_t j = 0; j < _nSampledFeatures; ++j)
+                {
+                    const RowIndexType iFeature = _featureSample[j];
+                    GHSums::fillByZero(indexedFeatures.numIndices(iFeature), aGHSum + _data.GH_SUMS_BUF->nUniquesArr[iFeature]);
+                }
+            }
+            else
+            {
+                GHSums::fillByZero(_data.GH_SUMS_BUF->nDiffFeatMax, aGHSum);
+            }
             local->isInitilized = true;
         }
 
         algorithmFPType * pgh = (algorithmFPType *)_data.ctx.grad(_data.iTree);
-        ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd,
-                                                                                  _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
+        if (_featureSample)
+            ComputeGHSumByRowsForFeatures<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(
+                aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, _featureSample, _nSampledFeatures, iStart, iEnd, _node.iStart + _node.n,
+                _data.GH_SUMS_BUF->nUniquesArr.get());
+        else
+            ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd,
+                                                                                      _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
         return nullptr;
     }
 
@@ -383,6 +414,8 @@ protected:
     SharedDataType & _data;
     const NodeInfoType & _node;
     TlsType * _res;
+    const RowIndexType * _featureSample;
+    const size_t _nSampledFeatures;
 };
 
 } /* namespace hist */
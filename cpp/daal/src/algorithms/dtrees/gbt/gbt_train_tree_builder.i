@@ -237,7 +237,7 @@ protected:
         else if (_ctx.par().splitMethod == gbt::training::exact || _ctx.nFeatures() != _ctx.nFeaturesPerNode())
         {
             using Mode    = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
-            using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
+            using Updater = UpdaterByColumnsOrRows<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
             buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
         else
@@ -374,6 +374,7 @@ services::Status TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::
                                                                                     HomogenNumericTable<int> *& pTblSmplCnt, size_t iTree,
                                                                                     GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(buildTree);
     _tree.destroy();
     typename NodeType::Base * nd = buildRoot(iTree, GH_SUMS_BUF);
     DAAL_CHECK_MALLOC(nd);
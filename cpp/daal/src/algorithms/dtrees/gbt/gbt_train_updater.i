@@ -40,6 +40,8 @@ class UpdaterByColumns;
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
 class UpdaterByRows;
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
+class UpdaterByColumnsOrRows;
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
 class MergedUpdaterByRows;
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
@@ -61,12 +63,15 @@ struct ExactSplitMode
 {
 protected:
     using ThisType    = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
-    using UpdaterType = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+    using UpdaterType = UpdaterByColumnsOrRows<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
 
 public:
-    using TaskType         = hist::SplitTaskByColumns<algorithmFPType, RowIndexType, BinIndexType, cpu>;
-    using ResultType       = hist::Result<algorithmFPType, cpu>;
-    using PartitionType    = DefaultPartitionTask<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using TaskType   = hist::SplitTaskByColumns<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using ResultType = hist::Result<algorithmFPType, cpu>;
+    using FindBestSplitTask =
+        hist::FindMaxImpurityDecreaseWithGHSumsReduceTask<algorithmFPType, RowIndexType, BinIndexType, MergedResult<ResultType, cpu>, cpu>;
+    using ComputeGHSumsTask = hist::ComputeGHSumsByRowsTask<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using PartitionType     = DefaultPartitionTask<algorithmFPType, RowIndexType, BinIndexType, cpu>;
     using NodesCreatorType = DefaultNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, cpu>;
 };
 
@@ -206,15 +211,15 @@ public:
 protected:
     virtual void findSplit(const RowIndexType * featureSample, typename super::BestSplitType & bestSplit) DAAL_C11_OVERRIDE
     {
-        const size_t nRows       = this->_node.n;
-        const size_t sizeOfBlock = 2048;
-        size_t nBlocks           = nRows / sizeOfBlock;
+        const size_t nRows = this->_node.n;
+        size_t nBlocks     = nRows / sizeOfBlock;
         nBlocks += !!(nRows - nBlocks * sizeOfBlock);
 
         TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu> * tls = this->_data.GH_SUMS_BUF->GHForCols.getBlockFromStorage();
 
+        const size_t nSampledFeatures = featureSample ? this->_data.ctx.nFeaturesPerNode() : 0;
         LoopHelper<cpu>::run(true, nBlocks, [&](size_t i) {
-            DAAL_TYPENAME SplitMode::ComputeGHSumsTask task(i, sizeOfBlock, this->_data, this->_node, tls);
+            DAAL_TYPENAME SplitMode::ComputeGHSumsTask task(i, sizeOfBlock, this->_data, this->_node, tls, featureSample, nSampledFeatures);
             task.execute();
         });
 
@@ -233,6 +238,60 @@ protected:
         this->_data.GH_SUMS_BUF->GHForCols.returnBlockToStorage(tls);
         services::internal::service_scalable_free<algorithmFPType *, cpu>(ptrs);
     }
+
+    static const size_t sizeOfBlock = 2048; // number of the node rows processed by one task
+};
+
+/* Chooses the histogram kernel for every node.
+   Column-wise kernel gathers the bins of the node rows from every feature array separately, that is cheap while the node
+   rows are dense in the feature arrays. For the nodes that contain a small share of the rows every gather touches its own
+   cache line, so the histograms are computed by a single pass over the row-major bins of the node rows instead.
+   Row-wise kernel zeroes and merges the histograms of the sampled features in every thread, so it is chosen only if
+   that overhead is small compared to the number of the bins gathered for the node */
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
+class UpdaterByColumnsOrRows : public UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>
+{
+public:
+    using super = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>;
+
+    UpdaterByColumnsOrRows(typename super::DataType & data, typename super::NodeInfoType & node) : super(data, node) {}
+
+protected:
+    virtual void findSplit(const RowIndexType * featureSample, typename super::BestSplitType & bestSplit) DAAL_C11_OVERRIDE
+    {
+        if (isRowWiseKernelPreferable(featureSample))
+        {
+            super::findSplit(featureSample, bestSplit);
+            return;
+        }
+
+        LoopHelper<cpu>::run(true, this->_data.ctx.nFeaturesPerNode(), [&](size_t i) {
+            const DAAL_INT iFeature = featureSample ? featureSample[i] : i;
+            DAAL_TYPENAME super::SplitTaskType task(iFeature, this->_data, this->_node, bestSplit, this->_result->res[i]);
+            task.execute();
+        });
+    }
+
+    bool isRowWiseKernelPreferable(const RowIndexType * featureSample) const
+    {
+        if (!this->_data.GH_SUMS_BUF->newFI) return false; // row-major bins are not built
+
+        /* The node rows are sparse in the feature arrays: less than one row of the node per cache line of bins */
+        const size_t nRows            = this->_node.n;
+        const size_t nBinsInCacheLine = 64 / sizeof(dtrees::internal::IndexedFeatures::IndexType);
+        if (nRows * nBinsInCacheLine >= size_t(this->_data.ctx.nSamples())) return false;
+
+        /* Every thread that processes a block of the node rows zeroes and merges its own histograms of the sampled features */
+        const auto & indexedFeatures  = this->_data.ctx.dataHelper().indexedFeatures();
+        const size_t nFeaturesPerNode = this->_data.ctx.nFeaturesPerNode();
+        size_t nSampledBins           = 0;
+        for (size_t i = 0; i < nFeaturesPerNode; ++i) nSampledBins += indexedFeatures.numIndices(featureSample ? featureSample[i] : i);
+
+        const size_t nBlocks  = nRows / super::sizeOfBlock + !!(nRows % super::sizeOfBlock);
+        const size_t nThreads = threader_get_threads_number();
+        const size_t nLocals  = (nBlocks < nThreads) ? nBlocks : nThreads;
+        return 2 * nLocals * nSampledBins < nRows * nFeaturesPerNode;
+    }
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
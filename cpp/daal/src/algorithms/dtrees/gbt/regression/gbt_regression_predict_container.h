@@ -58,11 +58,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * a                                   = static_cast<NumericTable *>(input->get(data).get());
     daal::algorithms::gbt::regression::Model * m       = static_cast<daal::algorithms::gbt::regression::Model *>(input->get(model).get());
     NumericTable * r                                   = static_cast<NumericTable *>(result->get(prediction).get());
-    const gbt::regression::prediction::Parameter * par = static_cast<gbt::regression::prediction::Parameter *>(_par);
+    const gbt::regression::prediction::interface1::Parameter * par = static_cast<gbt::regression::prediction::interface1::Parameter *>(_par);
+
+    const DAAL_UINT64 resultsToCompute = internal::getResultsToCompute(par);
+    NumericTable * contributions =
+        (resultsToCompute & computeShapContributions) ? static_cast<NumericTable *>(result->get(predictionContributions).get()) : nullptr;
+    NumericTable * interactions =
+        (resultsToCompute & computeShapInteractions) ? static_cast<NumericTable *>(result->get(predictionInteractions).get()) : nullptr;
 
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations, contributions, interactions);
 }
 
 } // namespace prediction
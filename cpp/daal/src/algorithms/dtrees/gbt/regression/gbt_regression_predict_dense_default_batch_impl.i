@@ -32,13 +32,18 @@
 #include "src/algorithms/dtrees/gbt/regression/gbt_regression_model_impl.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_tree_shap_impl.i"
+#include "src/externals/service_ittnotify.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
 
+DAAL_ITTNOTIFY_DOMAIN(gbt.predict.dense.default);
+
 namespace daal
 {
 namespace algorithms
@@ -52,6 +57,7 @@ namespace prediction
 namespace internal
 {
 using gbt::prediction::internal::VECTOR_BLOCK_SIZE;
+using gbt::prediction::internal::threaderForCancellable;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictRegressionTask
@@ -63,15 +69,18 @@ public:
     typedef gbt::internal::GbtDecisionTree TreeType;
     PredictRegressionTask(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
     services::Status run(const gbt::regression::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp);
+    services::Status runShap(const gbt::internal::ModelImpl * m, services::HostAppIface * pHostApp, NumericTable * contributions,
+                             NumericTable * interactions);
 
 protected:
     services::Status runInternal(services::HostAppIface * pHostApp, NumericTable * result);
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x);
     void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, algorithmFPType * res);
+    void predictByTreesBlock(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nRows, size_t nCols, algorithmFPType * res);
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
-    TArray<const TreeType *, cpu> _aTree;
+    TArrayScratch<const TreeType *, cpu> _aTree;
     const NumericTable * _data;
     NumericTable * _res;
 };
@@ -81,12 +90,22 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const regression::Model * m, NumericTable * r, size_t nIterations)
+                                                                      const regression::Model * m, NumericTable * r, size_t nIterations,
+                                                                      NumericTable * contributions, NumericTable * interactions)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(regression.compute);
+    ScratchArenaScope scratch;
     const daal::algorithms::gbt::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
     PredictRegressionTask<algorithmFPType, cpu> task(x, r);
-    return task.run(pModel, nIterations, pHostApp);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, task.run(pModel, nIterations, pHostApp));
+    if (contributions || interactions)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(regression.compute.shap);
+        s = task.runShap(pModel, pHostApp, contributions, interactions);
+    }
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -102,42 +121,66 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     return runInternal(pHostApp, this->_res);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::runShap(const gbt::internal::ModelImpl * m, services::HostAppIface * pHostApp,
+                                                                      NumericTable * contributions, NumericTable * interactions)
+{
+    const size_t nTreesTotal = this->_aTree.size();
+    TArrayScratch<const int *, cpu> aCover(nTreesTotal);
+    DAAL_CHECK_MALLOC(aCover.get());
+    for (size_t i = 0; i < nTreesTotal; ++i) aCover[i] = m->getNodeSampleCount(i);
+
+    gbt::prediction::internal::TreeShapTask<algorithmFPType, cpu> task(this->_data, this->_aTree.get(), aCover.get(), nTreesTotal, this->_featHelper);
+    return task.run(pHostApp, contributions, interactions);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(services::HostAppIface * pHostApp, NumericTable * result)
 {
     const auto nTreesTotal = this->_aTree.size();
+    const size_t treeSize  = gbt::prediction::internal::getAverageTreeSize(this->_aTree.get(), nTreesTotal);
 
-    gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTreesTotal);
+    gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTreesTotal, treeSize);
     WriteOnlyRows<algorithmFPType, cpu> resBD(result, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
-    services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
-    SafeStatus safeStat;
+    algorithmFPType * const res = resBD.get();
+    services::internal::service_memset<algorithmFPType, cpu>(res, 0, dim.nRowsTotal);
     services::Status s;
-    HostAppHelper host(pHostApp, 100);
-    for (size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
-    {
-        if (!s || host.isCancelled(s, 1)) return s;
-        size_t nTreesToUse = ((iTree + dim.nTreesInBlock) < nTreesTotal ? dim.nTreesInBlock : (nTreesTotal - iTree));
 
-        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+    if (!dim.bTreeBlocksInParallel)
+    {
+        s = threaderForCancellable(pHostApp, dim.nDataBlocks, dim.getNumberOfDataBlocksBetweenChecks(), [&](size_t iBlock, SafeStatus & safeStat) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
-            const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            const size_t nRowsToProcess = dim.getNumberOfRowsInBlock(iBlock);
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
 
-            size_t iRow;
-            for (iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
+            for (size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
             {
-                predictByTreesVector(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols, res + iRow);
-            }
-            for (; iRow < nRowsToProcess; ++iRow)
-            {
-                res[iRow] += predictByTrees(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols);
+                predictByTreesBlock(iTree, dim.getNumberOfTreesInBlock(iTree), xBD.get(), nRowsToProcess, dim.nCols, res + iStartRow);
             }
         });
+    }
+    else
+    {
+        daal::TlsSum<algorithmFPType, cpu> partialRes(dim.nRowsTotal);
+        const size_t nTiles = dim.nDataBlocks * dim.nTreeBlocks;
 
-        s = safeStat.detach();
+        s = threaderForCancellable(pHostApp, nTiles, dim.nTilesBetweenChecks, [&](size_t iTile, SafeStatus & safeStat) {
+            const size_t iBlock         = iTile / dim.nTreeBlocks;
+            const size_t iTree          = (iTile % dim.nTreeBlocks) * dim.nTreesInBlock;
+            const size_t iStartRow      = iBlock * dim.nRowsInBlock;
+            const size_t nRowsToProcess = dim.getNumberOfRowsInBlock(iBlock);
+
+            algorithmFPType * const localRes = partialRes.local();
+            DAAL_CHECK_MALLOC_THR(localRes);
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+
+            predictByTreesBlock(iTree, dim.getNumberOfTreesInBlock(iTree), xBD.get(), nRowsToProcess, dim.nCols, localRes + iStartRow);
+        });
+
+        if (s) partialRes.reduceTo(res, dim.nRowsTotal);
     }
 
     return s;
@@ -167,6 +210,21 @@ void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesVector(size_t iF
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesBlock(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nRows,
+                                                                      size_t nCols, algorithmFPType * res)
+{
+    size_t iRow;
+    for (iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRows; iRow += VECTOR_BLOCK_SIZE)
+    {
+        predictByTreesVector(iFirstTree, nTrees, x + iRow * nCols, res + iRow);
+    }
+    for (; iRow < nRows; ++iRow)
+    {
+        res[iRow] += predictByTrees(iFirstTree, nTrees, x + iRow * nCols);
+    }
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
@@ -44,6 +44,13 @@ namespace prediction
 {
 namespace internal
 {
+/* Additional results to compute, the parameters of the previous interface compute the predictions only */
+inline DAAL_UINT64 getResultsToCompute(const daal::algorithms::Parameter * parameter)
+{
+    const prediction::interface2::Parameter * par = dynamic_cast<const prediction::interface2::Parameter *>(parameter);
+    return par ? par->resultsToCompute : 0;
+}
+
 template <typename algorithmFpType, gbt::regression::prediction::Method method, CpuType cpu>
 class PredictKernel : public daal::algorithms::Kernel
 {
@@ -55,9 +62,11 @@ public:
      *  \param m[in]    gradient boosted trees model obtained on training stage
      *  \param r[out]   Prediction results
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param contributions[out]  SHAP feature contributions, not computed if null
+     *  \param interactions[out]   SHAP feature interaction values, not computed if null
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r,
-                             size_t nIterations);
+                             size_t nIterations, NumericTable * contributions, NumericTable * interactions);
 };
 
 } // namespace internal
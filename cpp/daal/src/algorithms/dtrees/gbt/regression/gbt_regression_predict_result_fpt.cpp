@@ -24,6 +24,7 @@
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict_types.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "src/services/daal_strings.h"
+#include "src/algorithms/dtrees/gbt/regression/gbt_regression_predict_kernel.h"
 
 namespace daal
 {
@@ -47,6 +48,21 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     const size_t nVectors = dataPtr->getNumberOfRows();
     Argument::set(prediction,
                   data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const DAAL_UINT64 resultsToCompute = internal::getResultsToCompute(par);
+    const size_t nContribs             = dataPtr->getNumberOfColumns() + 1;
+    if (resultsToCompute & computeShapContributions)
+    {
+        Argument::set(predictionContributions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                                   nContribs, nVectors, data_management::NumericTableIface::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if (resultsToCompute & computeShapInteractions)
+    {
+        Argument::set(predictionInteractions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                                  nContribs * nContribs, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    }
     return s;
 }
 
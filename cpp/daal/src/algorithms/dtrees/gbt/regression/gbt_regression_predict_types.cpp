@@ -25,6 +25,7 @@
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
 #include "src/algorithms/dtrees/gbt/regression/gbt_regression_model_impl.h"
+#include "src/algorithms/dtrees/gbt/regression/gbt_regression_predict_kernel.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -143,6 +144,24 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     Status s;
     DAAL_CHECK_STATUS(s, algorithms::regression::prediction::Result::check(input, par, method));
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
+
+    const DAAL_UINT64 resultsToCompute = internal::getResultsToCompute(par);
+    if (resultsToCompute & (computeShapContributions | computeShapInteractions))
+    {
+        const Input * in       = static_cast<const Input *>(input);
+        const size_t nRows     = in->get(data)->getNumberOfRows();
+        const size_t nContribs = in->get(data)->getNumberOfColumns() + 1;
+        if (resultsToCompute & computeShapContributions)
+        {
+            DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(predictionContributions).get(), predictionContributionsStr(), 0, 0,
+                                                                    nContribs, nRows));
+        }
+        if (resultsToCompute & computeShapInteractions)
+        {
+            DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(predictionInteractions).get(), predictionInteractionsStr(), 0, 0,
+                                                                    nContribs * nContribs, nRows));
+        }
+    }
     return s;
 }
 
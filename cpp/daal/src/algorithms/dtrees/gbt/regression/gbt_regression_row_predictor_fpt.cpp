@@ -0,0 +1,133 @@
+/* file: gbt_regression_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees regression prediction of a single observation.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_row_predictor.h"
+#include "src/algorithms/dtrees/gbt/regression/gbt_regression_model_impl.h"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+namespace interface1
+{
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::Impl
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+
+    Impl() : _nFeatures(0) {}
+
+    services::Status prepare(const gbt::regression::ModelPtr & model, const Parameter & parameter, const data_management::NumericTablePtr & data)
+    {
+        DAAL_CHECK(model, services::ErrorNullModel);
+
+        const gbt::regression::internal::ModelImpl * const pModel = static_cast<const gbt::regression::internal::ModelImpl *>(model.get());
+        const size_t nTrees                                       = (parameter.nIterations ? parameter.nIterations : pModel->size());
+        DAAL_CHECK(nTrees && nTrees <= pModel->size(), services::ErrorIncorrectParameter);
+
+        _aTree.reset(nTrees);
+        DAAL_CHECK_MALLOC(_aTree.get());
+        for (size_t i = 0; i < nTrees; ++i) _aTree[i] = pModel->at(i);
+        if (data) DAAL_CHECK_MALLOC(_featHelper.init(*data));
+
+        _model     = model;
+        _nFeatures = pModel->getNumberOfFeatures();
+        return services::Status();
+    }
+
+    services::Status predict(const algorithmFPType * const x, algorithmFPType * const response) const
+    {
+        const size_t nTrees = _aTree.size();
+        algorithmFPType val = algorithmFPType(0);
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            val += gbt::prediction::internal::predictForTree<algorithmFPType, TreeType, sse2>(*_aTree[iTree], _featHelper, x);
+        }
+        *response = val;
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    gbt::regression::ModelPtr _model; /* owns the trees */
+    services::internal::TArray<const TreeType *, sse2> _aTree;
+    dtrees::internal::FeatureTypes _featHelper;
+    size_t _nFeatures;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor() : _impl(nullptr)
+{}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::prepare(const gbt::regression::ModelPtr & model, const Parameter & parameter,
+                                                        const data_management::NumericTablePtr & data)
+{
+    delete _impl;
+    _impl = new Impl();
+    DAAL_CHECK_MALLOC(_impl);
+    const services::Status s = _impl->prepare(model, parameter, data);
+    if (!s)
+    {
+        delete _impl;
+        _impl = nullptr;
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::predict(const algorithmFPType * x, algorithmFPType * response)
+{
+    DAAL_CHECK(_impl, services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, response);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface1
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
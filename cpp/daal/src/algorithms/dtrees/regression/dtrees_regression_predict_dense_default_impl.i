@@ -77,11 +77,32 @@ protected:
         for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict(*_aTree[iTree], _featHelper, x);
         return val;
     }
+
+    /* Adds the predictions of the trees to a block of observations, every tree is traversed by the block in lock-step */
+    void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nRows, size_t nCols, algorithmFPType factor,
+                              algorithmFPType * res)
+    {
+        uint32_t aIdx[s_cVectorBlockSize];
+        algorithmFPType val[s_cVectorBlockSize];
+        DAAL_ASSERT(nRows <= s_cVectorBlockSize);
+        const size_t iLastTree = iFirstTree + nTrees;
+
+        for (size_t i = 0; i < nRows; ++i) val[i] = 0;
+        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+        {
+            const dtrees::internal::DecisionTreeNode * const aNode = (const dtrees::internal::DecisionTreeNode *)_aTree[iTree]->getArray();
+            dtrees::prediction::internal::findLeaves<algorithmFPType, cpu>(aNode, x, nRows, nCols, aIdx);
+            for (size_t i = 0; i < nRows; ++i) val[i] += aNode[aIdx[i]].featureValueOrResponse;
+        }
+        for (size_t i = 0; i < nRows; ++i) res[i] += factor * val[i];
+    }
+
     services::Status run(services::HostAppIface * pHostApp, algorithmFPType factor);
 
 protected:
+    static const size_t s_cVectorBlockSize = 64; /* number of observations traversing a tree in lock-step */
     dtrees::internal::FeatureTypes _featHelper;
-    TArray<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
+    TArrayScratch<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
     const NumericTable * _data;
     NumericTable * _res;
 };
@@ -110,7 +131,16 @@ services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType * res = resBD.get() + iStartRow;
-            if (nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
+            if (!_featHelper.hasUnorderedFeatures())
+            {
+                const size_t nVectorBlocks = nRowsToProcess / s_cVectorBlockSize + !!(nRowsToProcess % s_cVectorBlockSize);
+                daal::threader_for(nVectorBlocks, nVectorBlocks, [&](size_t iVectorBlock) {
+                    const size_t iStart = iVectorBlock * s_cVectorBlockSize;
+                    const size_t nRows  = (iVectorBlock == nVectorBlocks - 1) ? nRowsToProcess - iStart : s_cVectorBlockSize;
+                    predictByTreesVector(iTree, nTreesToUse, xBD.get() + iStart * dim.nCols, nRows, dim.nCols, factor, res + iStart);
+                });
+            }
+            else if (nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
             {
                 for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
                     res[iRow] += factor * predictByTrees(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols);
@@ -32,7 +32,7 @@ namespace implicit_als
 {
 Model::Model() {}
 
-services::Status Parameter::check() const
+services::Status interface1::Parameter::check() const
 {
     if (nFactors == 0)
     {
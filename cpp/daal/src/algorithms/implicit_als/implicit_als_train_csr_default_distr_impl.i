@@ -176,19 +176,36 @@ template <typename algorithmFPType, CpuType cpu>
 struct AlsTls
 {
     DAAL_NEW_DELETE();
-    AlsTls(size_t nBlocks, const Parameter & parameter) : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors) {}
-    bool isValid() const { return _lhs.get(); }
+    AlsTls(size_t nBlocks, const Parameter & parameter)
+        : _nBlocks(nBlocks),
+          _prm(parameter),
+          _nCGIterations(getNumberOfCGIterations(&parameter)),
+          _lhs(_nCGIterations ? 0 : parameter.nFactors * parameter.nFactors),
+          _cg(_nCGIterations ? parameter.nFactors : 0)
+    {}
+    bool isValid() const { return _nCGIterations ? _cg.isValid() : (_lhs.get() != nullptr); }
 
     Status run(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
                NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
 
 protected:
+    Status runCG(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
+                 NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
+
     Status formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
                       const int ** indices);
 
+    Status formObservations(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
+                            const int ** indices, size_t & nObservations);
+
+    Status readSrcFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
+
 protected:
     WriteOnlyRows<algorithmFPType, cpu> _mtDstFactors;
+    WriteRows<algorithmFPType, cpu> _mtCurFactors;
+    size_t _nCGIterations;
     TArray<algorithmFPType, cpu> _lhs;
+    ImplicitALSCGTls<algorithmFPType, cpu> _cg;
     ReadRows<algorithmFPType, cpu> _mtSrcFactors;
     const Parameter & _prm;
     size_t _nBlocks;
@@ -198,6 +215,8 @@ template <typename algorithmFPType, CpuType cpu>
 Status AlsTls<algorithmFPType, cpu>::run(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
                                          NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices)
 {
+    if (_nCGIterations) return runCG(dstFactors, mtData, i, xtx, aSrcFactors, nColFactorsRows, indices);
+
     int result = 0;
 
     _mtDstFactors.set(dstFactors, i, 1);
@@ -215,6 +234,25 @@ Status AlsTls<algorithmFPType, cpu>::run(NumericTable & dstFactors, ReadRowsCSR<
     return s;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::runCG(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i,
+                                           const algorithmFPType * xtx, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
+                                           const int ** indices)
+{
+    /* The factors stored in the partial result are the initial approximation of the solution */
+    _mtCurFactors.set(dstFactors, i, 1);
+    DAAL_CHECK_BLOCK_STATUS(_mtCurFactors);
+
+    size_t nObservations = 0;
+    Status s             = formObservations(mtData, i, aSrcFactors, nColFactorsRows, indices, nObservations);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const algorithmFPType gamma = algorithmFPType(_prm.lambda) * nObservations;
+    ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(_prm.nFactors, nObservations, xtx, gamma, _nCGIterations, _cg,
+                                                              _mtCurFactors.get());
+    return s;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(data_management::KeyValueDataCollection * srcPartialModels,
                                                                                 data_management::NumericTable * dataTable,
@@ -275,6 +313,42 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::readSrcFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices)
+{
+    int blockIndex = -1;
+    /* find block that contains needed index */
+    for (size_t block = 0; block < _nBlocks; block++)
+    {
+        if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
+        {
+            blockIndex = block;
+            break;
+        }
+    }
+    if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    const int * blockIndices = indices[blockIndex];
+    /* find index in the block using binary search */
+    size_t hiIndex = nColFactorsRows[blockIndex] - 1;
+    size_t loIndex = 0;
+    size_t meIndex = ((loIndex + hiIndex) >> 1);
+    while (colIndex != blockIndices[meIndex])
+    {
+        if (colIndex < blockIndices[meIndex])
+            hiIndex = meIndex - 1;
+        else if (colIndex > blockIndices[meIndex])
+            loIndex = meIndex + 1;
+        meIndex = ((loIndex + hiIndex) >> 1);
+        if (loIndex >= hiIndex) break;
+    }
+    if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
+    DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
                                                 const size_t * nColFactorsRows, const int ** indices)
@@ -292,36 +366,8 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu
         DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
         int colIndex = (int)mtData.cols()[j] - 1;
 
-        int blockIndex = -1;
-        /* find block that contains needed index */
-        for (size_t block = 0; block < _nBlocks; block++)
-        {
-            if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
-            {
-                blockIndex = block;
-                break;
-            }
-        }
-        if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        const int * blockIndices = indices[blockIndex];
-        /* find index in the block using binary search */
-        size_t hiIndex = nColFactorsRows[blockIndex] - 1;
-        size_t loIndex = 0;
-        size_t meIndex = ((loIndex + hiIndex) >> 1);
-        while (colIndex != blockIndices[meIndex])
-        {
-            if (colIndex < blockIndices[meIndex])
-                hiIndex = meIndex - 1;
-            else if (colIndex > blockIndices[meIndex])
-                loIndex = meIndex + 1;
-            meIndex = ((loIndex + hiIndex) >> 1);
-            if (loIndex >= hiIndex) break;
-        }
-        if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+        Status s = readSrcFactors(colIndex, aSrcFactors, nColFactorsRows, indices);
+        DAAL_CHECK_STATUS_VAR(s);
         ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(_prm.nFactors, _mtSrcFactors.get(), &c1, &c, lhs, rhs);
     }
 
@@ -334,6 +380,30 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu
     return Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::formObservations(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
+                                                      const size_t * nColFactorsRows, const int ** indices, size_t & nObservations)
+{
+    const size_t startIdx = mtData.rows()[i] - 1;
+    const size_t endIdx   = mtData.rows()[i + 1] - 1;
+    nObservations         = endIdx - startIdx;
+    DAAL_CHECK_MALLOC(_cg.reserve(nObservations));
+
+    /* The factors are looked up once per row and not on each iteration of the conjugate gradient method */
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
+        Status s = readSrcFactors((int)mtData.cols()[j] - 1, aSrcFactors, nColFactorsRows, indices);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        const algorithmFPType * srcFactors = _mtSrcFactors.get();
+        algorithmFPType * dst              = _cg.factors.get() + (j - startIdx) * _prm.nFactors;
+        for (size_t k = 0; k < _prm.nFactors; k++) dst[k] = srcFactors[k];
+        _cg.coeffs[j - startIdx] = algorithmFPType(_prm.alpha) * mtData.values()[j];
+    }
+    return Status();
+}
+
 } // namespace internal
 } // namespace training
 } // namespace implicit_als
@@ -28,6 +28,7 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_lapack.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/services/service_data_utils.h"
 
 namespace daal
 {
@@ -86,6 +87,89 @@ bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(size_t nCols, algor
     return (info == 0);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(size_t nFactors, size_t nObservations, const algorithmFPType * xtx,
+                                                               algorithmFPType gamma, size_t nIterations, ImplicitALSCGTls<algorithmFPType, cpu> & cg,
+                                                               algorithmFPType * x)
+{
+    /* The system (Y^T*Y + Y^T*(C - I)*Y + gamma*I) * x = Y^T*C*p is not formed, its product with a vector
+       costs O(nFactors^2 + nObservations*nFactors) operations, while the Cholesky decomposition costs O(nFactors^3) */
+    char side            = 'L';
+    char uplo            = 'U';
+    const char transN    = 'N';
+    const char transT    = 'T';
+    DAAL_INT m           = (DAAL_INT)nFactors;
+    DAAL_INT iOne        = 1;
+    const DAAL_INT n     = (DAAL_INT)nObservations;
+    algorithmFPType one  = 1.0;
+    algorithmFPType zero = 0.0;
+
+    const algorithmFPType * y = cg.factors.get();
+    const algorithmFPType * c = cg.coeffs.get();
+    algorithmFPType * yv      = cg.products.get();
+    algorithmFPType * b       = cg.work.get();
+    algorithmFPType * r       = b + nFactors;
+    algorithmFPType * p       = r + nFactors;
+    algorithmFPType * ap      = p + nFactors;
+
+    auto applySystem = [&](const algorithmFPType * v, algorithmFPType * av) {
+        /* Y^T*Y is stored in the upper triangle as the matrix of the Cholesky decomposition */
+        Blas<algorithmFPType, cpu>::xxsymm(&side, &uplo, &m, &iOne, &one, const_cast<algorithmFPType *>(xtx), &m, const_cast<algorithmFPType *>(v),
+                                           &m, &zero, av, &m);
+        if (nObservations)
+        {
+            Blas<algorithmFPType, cpu>::xxgemv(&transT, &m, &n, &one, y, &m, v, &iOne, &zero, yv, &iOne);
+            for (size_t j = 0; j < nObservations; j++) yv[j] *= c[j];
+            Blas<algorithmFPType, cpu>::xxgemv(&transN, &m, &n, &one, y, &m, yv, &iOne, &one, av, &iOne);
+        }
+        for (size_t k = 0; k < nFactors; k++) av[k] += gamma * v[k];
+    };
+
+    /* b = Y^T*C*p, the preferences p are equal to one for the observations with positive confidence alpha*r
+       and to zero for the others, as in the system of normal equations solved by the Cholesky decomposition */
+    service_memset<algorithmFPType, cpu>(b, zero, nFactors);
+    if (nObservations)
+    {
+        for (size_t j = 0; j < nObservations; j++) yv[j] = (c[j] > zero) ? c[j] + one : zero;
+        Blas<algorithmFPType, cpu>::xxgemv(&transN, &m, &n, &one, y, &m, yv, &iOne, &zero, b, &iOne);
+    }
+
+    /* Iterations start from the current factors that are close to the solution after the first iterations of ALS */
+    applySystem(x, ap);
+    algorithmFPType rr = zero;
+    algorithmFPType bb = zero;
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        r[k] = b[k] - ap[k];
+        p[k] = r[k];
+        rr += r[k] * r[k];
+        bb += b[k] * b[k];
+    }
+
+    const algorithmFPType eps       = services::internal::EpsilonVal<algorithmFPType>::get();
+    const algorithmFPType threshold = eps * eps * bb;
+    for (size_t it = 0; it < nIterations && rr > threshold; it++)
+    {
+        applySystem(p, ap);
+        algorithmFPType pap = zero;
+        for (size_t k = 0; k < nFactors; k++) pap += p[k] * ap[k];
+        if (!(pap > zero)) break;
+
+        const algorithmFPType step = rr / pap;
+        algorithmFPType rrNew      = zero;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            x[k] += step * p[k];
+            r[k] -= step * ap[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType beta = rrNew / rr;
+        for (size_t k = 0; k < nFactors; k++) p[k] = r[k] + beta * p[k];
+        rr = rrNew;
+    }
+}
+
 static inline void getSizes(size_t nRows, size_t nCols, size_t & nBlocks, size_t & blockSize, size_t & tailSize)
 {
     const size_t nThreads       = threader_get_threads_number();
@@ -146,6 +230,85 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType * data,
+                                                                          const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                          algorithmFPType * colFactors, algorithmFPType * rowFactors,
+                                                                          algorithmFPType alpha, algorithmFPType lambda, algorithmFPType * xtx,
+                                                                          size_t nIterations, bool bWarmStart,
+                                                                          daal::tls<ImplicitALSCGTls<algorithmFPType, cpu> *> & cgTls)
+{
+    SafeStatus safeStat;
+    size_t nBlocks, blockSize, tailSize;
+
+    getSizes(nRows, nCols, nBlocks, blockSize, tailSize);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
+        ImplicitALSCGTls<algorithmFPType, cpu> * cg = cgTls.local();
+        DAAL_CHECK_MALLOC_THR(cg);
+
+        const size_t curBlockSize = (i < tailSize) ? blockSize + 1 : blockSize;
+        const size_t offset       = (i < tailSize) ? i * blockSize + i : i * blockSize + tailSize;
+
+        for (size_t j = 0; j < curBlockSize; j++)
+        {
+            algorithmFPType * x = rowFactors + (offset + j) * nFactors;
+            if (!bWarmStart) service_memset<algorithmFPType, cpu>(x, algorithmFPType(0), nFactors);
+
+            size_t nObservations  = 0;
+            algorithmFPType gamma = 0.0;
+            const bool bFormed =
+                formObservations(offset + j, nCols, data, colIndices, rowOffsets, nFactors, colFactors, alpha, lambda, *cg, nObservations, gamma);
+            DAAL_CHECK_MALLOC_THR(bFormed);
+
+            solveCG(nFactors, nObservations, xtx, gamma, nIterations, *cg, x);
+        }
+    });
+
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::trainCG(size_t nUsers, size_t nItems, size_t nFactors, const algorithmFPType * data,
+                                                                 const size_t * colIndices, const size_t * rowOffsets, const algorithmFPType * tdata,
+                                                                 const size_t * rowIndices, const size_t * colOffsets, algorithmFPType * itemsFactors,
+                                                                 algorithmFPType * usersFactors, algorithmFPType * xtx, const Parameter * parameter)
+{
+    const algorithmFPType alpha(parameter->alpha);
+    const algorithmFPType lambda(parameter->lambda);
+    const size_t nIterations = getNumberOfCGIterations(parameter);
+
+    daal::tls<ImplicitALSCGTls<algorithmFPType, cpu> *> cgTls([=]() -> ImplicitALSCGTls<algorithmFPType, cpu> * {
+        ImplicitALSCGTls<algorithmFPType, cpu> * ptr = new ImplicitALSCGTls<algorithmFPType, cpu>(nFactors);
+        if (ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    Status s;
+    algorithmFPType beta = 0.0;
+    for (size_t i = 0; i < parameter->maxIterations; i++)
+    {
+        this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
+
+        /* Users factors are not initialized before the first iteration, items factors come from the initialization step */
+        s = computeFactorsCG(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, nIterations,
+                             i > 0, cgTls);
+        if (!s) break;
+
+        this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
+
+        s = computeFactorsCG(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, nIterations,
+                             true, cgTls);
+        if (!s) break;
+    }
+    cgTls.reduce([](ImplicitALSCGTls<algorithmFPType, cpu> * ptr) { delete ptr; });
+    return s;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data,
                                                                                 size_t * colIndices, size_t * rowOffsets,
@@ -294,6 +457,61 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(size
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::formObservations(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                             const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                             const algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                             algorithmFPType lambda, ImplicitALSCGTls<algorithmFPType, cpu> & cg,
+                                                                             size_t & nObservations, algorithmFPType & gamma)
+{
+    const size_t startIdx = rowOffsets[i] - 1;
+    const size_t endIdx   = rowOffsets[i + 1] - 1;
+    nObservations         = endIdx - startIdx;
+    if (!cg.reserve(nObservations)) return false;
+
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        const algorithmFPType * colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+        algorithmFPType * dst                 = cg.factors.get() + (j - startIdx) * nFactors;
+        for (size_t k = 0; k < nFactors; k++) dst[k] = colFactorsRow[k];
+        cg.coeffs[j - startIdx] = alpha * data[j];
+    }
+
+    /* Same regularization term as in the system of normal equations */
+    gamma = lambda * nObservations;
+    return true;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formObservations(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                                  const size_t * colIndices, const size_t * rowOffsets,
+                                                                                  size_t nFactors, const algorithmFPType * colFactors,
+                                                                                  algorithmFPType alpha, algorithmFPType lambda,
+                                                                                  ImplicitALSCGTls<algorithmFPType, cpu> & cg, size_t & nObservations,
+                                                                                  algorithmFPType & gamma)
+{
+    const algorithmFPType * row = data + i * nCols;
+    nObservations               = 0;
+    for (size_t j = 0; j < nCols; j++) nObservations += (row[j] > 0.0);
+    if (!cg.reserve(nObservations)) return false;
+
+    size_t idx = 0;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        if (row[j] > 0.0)
+        {
+            const algorithmFPType * colFactorsRow = colFactors + j * nFactors;
+            algorithmFPType * dst                 = cg.factors.get() + idx * nFactors;
+            for (size_t k = 0; k < nFactors; k++) dst[k] = colFactorsRow[k];
+            cg.coeffs[idx++] = alpha * row[j];
+        }
+    }
+
+    /* Same regularization term as in the system of normal equations */
+    gamma = lambda * (nObservations + 1);
+    return true;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const NumericTable * dataTable, implicit_als::Model * initModel,
                                                                                      implicit_als::Model * model, const Parameter * parameter)
@@ -325,6 +543,12 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
                         alpha, lambda, &costFunction);
 #endif
 
+    if (getNumberOfCGIterations(parameter))
+    {
+        return this->trainCG(nUsers, nItems, nFactors, data, colIndices, rowOffsets, tdata, rowIndices, colOffsets, itemsFactors, usersFactors, xtx,
+                             parameter);
+    }
+
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
 
@@ -389,6 +613,11 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
                         alpha, lambda, &costFunction);
 #endif
 
+    if (getNumberOfCGIterations(parameter))
+    {
+        return this->trainCG(nUsers, nItems, nFactors, data, NULL, NULL, tdata, NULL, NULL, itemsFactors, usersFactors, xtx, parameter);
+    }
+
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
 
@@ -116,7 +116,13 @@ DAAL_EXPORT Status DistributedPartialResultStep4::allocate(const daal::algorithm
     const DistributedInput<step4Local> * algInput = static_cast<const DistributedInput<step4Local> *>(input);
     const Parameter * algParameter                = static_cast<const Parameter *>(parameter);
 
-    set(outputOfStep4ForStep1, PartialModelPtr(new PartialModel(*algParameter, algInput->getNumberOfRows(), (algorithmFPType)0.0)));
+    PartialModelPtr partialModel(new PartialModel(*algParameter, algInput->getNumberOfRows(), (algorithmFPType)0.0));
+    set(outputOfStep4ForStep1, partialModel);
+
+    /* Conjugate gradient iterations start from the factors in the partial result. The partial result is allocated only
+       when it is not set via setPartialResult(), so the iterations of the freshly allocated one start from zeros */
+    const interface2::Parameter * cgParameter = dynamic_cast<const interface2::Parameter *>(parameter);
+    if (cgParameter && cgParameter->nCGIterations) return partialModel->getFactors()->assign((algorithmFPType)0.0);
     return Status();
 }
 
@@ -58,6 +58,43 @@ protected:
     void computeXtX(size_t * nRows, size_t * nCols, algorithmFPType * beta, algorithmFPType * x, size_t * ldx, algorithmFPType * xtx, size_t * ldxtx);
 };
 
+/* Number of conjugate gradient iterations, the parameters of the previous interface solve the systems exactly */
+inline size_t getNumberOfCGIterations(const daal::algorithms::Parameter * parameter)
+{
+    const implicit_als::interface2::Parameter * par = dynamic_cast<const implicit_als::interface2::Parameter *>(parameter);
+    return par ? par->nCGIterations : 0;
+}
+
+/**
+ *  \brief Thread local buffers of the conjugate gradient solver: the factors of the observed columns of the row,
+ *         their confidence coefficients and the vectors of the method
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct ImplicitALSCGTls
+{
+    DAAL_NEW_DELETE();
+    ImplicitALSCGTls(size_t nFactors) : nFactors(nFactors), capacity(0), work(4 * nFactors) {}
+    bool isValid() const { return work.get(); }
+
+    /* Storage of the observations grows when the row has more observations than any of the rows processed before */
+    bool reserve(size_t nObservations)
+    {
+        if (nObservations <= capacity) return true;
+        factors.reset(nObservations * nFactors);
+        coeffs.reset(nObservations);
+        products.reset(nObservations);
+        capacity = (factors.get() && coeffs.get() && products.get()) ? nObservations : 0;
+        return (capacity > 0);
+    }
+
+    size_t nFactors;
+    size_t capacity;
+    daal::internal::TArray<algorithmFPType, cpu> factors;  /*<! Factors of the observed columns, one row per observation */
+    daal::internal::TArray<algorithmFPType, cpu> coeffs;   /*<! alpha * r for each observation */
+    daal::internal::TArray<algorithmFPType, cpu> products; /*<! Products of the factors of the observed columns and a vector */
+    daal::internal::TArray<algorithmFPType, cpu> work;     /*<! Right hand side, residual, direction and product of the system and direction */
+};
+
 template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernelBase : public ImplicitALSTrainKernelCommon<algorithmFPType, cpu>
 {
@@ -67,6 +104,9 @@ public:
 
     static bool solve(size_t nCols, algorithmFPType * a, algorithmFPType * b);
 
+    static void solveCG(size_t nFactors, size_t nObservations, const algorithmFPType * xtx, algorithmFPType gamma, size_t nIterations,
+                        ImplicitALSCGTls<algorithmFPType, cpu> & cg, algorithmFPType * x);
+
 protected:
     friend struct ImplicitALSTrainTaskBase<algorithmFPType, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
@@ -76,6 +116,19 @@ protected:
                                     size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
                                     algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs);
 
+    services::Status computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                                      size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
+                                      algorithmFPType lambda, algorithmFPType * xtx, size_t nIterations, bool bWarmStart,
+                                      daal::tls<ImplicitALSCGTls<algorithmFPType, cpu> *> & cgTls);
+
+    services::Status trainCG(size_t nUsers, size_t nItems, size_t nFactors, const algorithmFPType * data, const size_t * colIndices,
+                             const size_t * rowOffsets, const algorithmFPType * tdata, const size_t * rowIndices, const size_t * colOffsets,
+                             algorithmFPType * itemsFactors, algorithmFPType * usersFactors, algorithmFPType * xtx, const Parameter * parameter);
+
+    virtual bool formObservations(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                                  size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                                  ImplicitALSCGTls<algorithmFPType, cpu> & cg, size_t & nObservations, algorithmFPType & gamma) = 0;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) = 0;
@@ -93,6 +146,10 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu> : public ImplicitALSTrainKernelBase<algorithmFPType, cpu>
 {
 protected:
+    virtual bool formObservations(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                                  size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                                  ImplicitALSCGTls<algorithmFPType, cpu> & cg, size_t & nObservations, algorithmFPType & gamma) DAAL_C11_OVERRIDE;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) DAAL_C11_OVERRIDE;
@@ -106,6 +163,10 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu> : public ImplicitALSTrainKernelBase<algorithmFPType, cpu>
 {
 protected:
+    virtual bool formObservations(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                                  size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                                  ImplicitALSCGTls<algorithmFPType, cpu> & cg, size_t & nObservations, algorithmFPType & gamma) DAAL_C11_OVERRIDE;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) DAAL_C11_OVERRIDE;
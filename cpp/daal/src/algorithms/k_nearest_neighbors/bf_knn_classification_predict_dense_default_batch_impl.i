@@ -0,0 +1,278 @@
+/* file: bf_knn_classification_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the CPU kernel for brute force kNN prediction.
+//  Squared Euclidean distances between blocks of query and training rows
+//  are computed with GEMM as |t|^2 - 2 * <q, t> (the |q|^2 term does not
+//  change the ordering of neighbors), k nearest neighbors of each query row
+//  are kept in a fixed-size max-heap.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __BF_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_heap.h"
+#include "src/algorithms/service_sort.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_ittnotify.h"
+#include "src/services/service_utils.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/k_nearest_neighbors/bf_knn_classification_predict_kernel.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/* Maximal number of query rows processed by one thread at once */
+const size_t bfKnnMaxQueryBlockRowCount = 128;
+/* Minimal number of query rows processed by one thread at once */
+const size_t bfKnnMinQueryBlockRowCount = 16;
+/* Number of training rows in one GEMM block, the distances block stays in L2 cache */
+const size_t bfKnnDataBlockRowCount = 512;
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, cpu>::compute(const NumericTable * x, const classifier::Model * m, NumericTable * y,
+                                                                                const daal::algorithms::Parameter * par)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    services::Status status;
+
+    const Model * const model         = static_cast<const Model *>(m);
+    const NumericTable * const data   = model->impl()->getData().get();
+    const NumericTable * const labels = model->impl()->getLabels().get();
+    const Parameter * const parameter = static_cast<const Parameter *>(par);
+
+    const size_t nQueryRows = x->getNumberOfRows();
+    const size_t nLabelRows = labels->getNumberOfRows();
+    const size_t nDataRows  = data->getNumberOfRows() < nLabelRows ? data->getNumberOfRows() : nLabelRows;
+    const size_t nFeatures  = data->getNumberOfColumns();
+    const size_t k          = parameter->k < nDataRows ? parameter->k : nDataRows;
+    if (k == 0 || nQueryRows == 0) return status;
+
+    TArray<algorithmFpType, cpu> dataSqArray(nDataRows);
+    DAAL_CHECK_MALLOC(dataSqArray.get());
+    const algorithmFpType * const dataSq = dataSqArray.get();
+    DAAL_CHECK_STATUS(status, computeSumOfSquares(*data, nDataRows, dataSqArray.get()));
+
+    ReadColumns<int, cpu> labelsBlock(const_cast<NumericTable *>(labels), 0, 0, nDataRows);
+    DAAL_CHECK_BLOCK_STATUS(labelsBlock);
+    const int * const labelsPtr = labelsBlock.get();
+
+    /* Query blocks are made smaller for short inputs so that all threads get work */
+    const size_t nThreads          = threader_get_threads_number();
+    size_t queryBlockRowCount      = (nQueryRows + nThreads - 1) / nThreads;
+    queryBlockRowCount             = queryBlockRowCount > bfKnnMaxQueryBlockRowCount ? bfKnnMaxQueryBlockRowCount : queryBlockRowCount;
+    queryBlockRowCount             = queryBlockRowCount < bfKnnMinQueryBlockRowCount ? bfKnnMinQueryBlockRowCount : queryBlockRowCount;
+    const size_t dataBlockRowCount = bfKnnDataBlockRowCount;
+    const size_t nQueryBlocks      = nQueryRows / queryBlockRowCount + !!(nQueryRows % queryBlockRowCount);
+    const size_t nDataBlocks       = nDataRows / dataBlockRowCount + !!(nDataRows % dataBlockRowCount);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, queryBlockRowCount, k);
+    daal::TlsMem<algorithmFpType, cpu> distancesTls(queryBlockRowCount * dataBlockRowCount);
+    daal::TlsMem<BruteForceNeighbor<algorithmFpType>, cpu> heapsTls(queryBlockRowCount * k);
+    daal::TlsMem<int, cpu> classesTls(k);
+
+    const size_t yColumnCount = y->getNumberOfColumns();
+
+    SafeStatus safeStat;
+    daal::threader_for(nQueryBlocks, nQueryBlocks, [&](size_t iQueryBlock) {
+        algorithmFpType * const distances                 = distancesTls.local();
+        BruteForceNeighbor<algorithmFpType> * const heaps = heapsTls.local();
+        int * const classes                               = classesTls.local();
+        DAAL_CHECK_MALLOC_THR(distances && heaps && classes);
+
+        const size_t queryStart = iQueryBlock * queryBlockRowCount;
+        const size_t queryCount = (queryStart + queryBlockRowCount > nQueryRows) ? nQueryRows - queryStart : queryBlockRowCount;
+
+        ReadRows<algorithmFpType, cpu> queryRows(const_cast<NumericTable *>(x), queryStart, queryCount);
+        DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+        const algorithmFpType * const query = queryRows.get();
+
+        size_t heapSizes[bfKnnMaxQueryBlockRowCount] = { 0 };
+
+        for (size_t iDataBlock = 0; iDataBlock < nDataBlocks; ++iDataBlock)
+        {
+            const size_t dataStart = iDataBlock * dataBlockRowCount;
+            const size_t dataCount = (dataStart + dataBlockRowCount > nDataRows) ? nDataRows - dataStart : dataBlockRowCount;
+
+            ReadRows<algorithmFpType, cpu> dataRows(const_cast<NumericTable *>(data), dataStart, dataCount);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+
+            for (size_t i = 0; i < queryCount; ++i)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < dataCount; ++j)
+                {
+                    distances[i * dataCount + j] = dataSq[dataStart + j];
+                }
+            }
+
+            /* distances(j, i) = |t_j|^2 - 2 * <t_j, q_i>, stored column-wise: one column per query row */
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT _m           = dataCount;
+            const DAAL_INT _n           = queryCount;
+            const DAAL_INT _k           = nFeatures;
+            const algorithmFpType alpha = -2.0;
+            const DAAL_INT lda          = nFeatures;
+            const DAAL_INT ldb          = nFeatures;
+            const algorithmFpType beta  = 1.0;
+            const DAAL_INT ldc          = dataCount;
+
+            Blas<algorithmFpType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, dataRows.get(), &lda, query, &ldb, &beta, distances, &ldc);
+
+            for (size_t i = 0; i < queryCount; ++i)
+            {
+                updateNeighbors(distances + i * dataCount, dataStart, dataCount, k, heaps + i * k, heapSizes[i]);
+            }
+        }
+
+        WriteOnlyRows<algorithmFpType, cpu> resultRows(y, queryStart, queryCount);
+        DAAL_CHECK_BLOCK_STATUS_THR(resultRows);
+        algorithmFpType * const result = resultRows.get();
+        for (size_t i = 0; i < queryCount; ++i)
+        {
+            result[i * yColumnCount] = vote(heaps + i * k, heapSizes[i], labelsPtr, classes);
+        }
+    });
+
+    return safeStat.detach();
+}
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, cpu>::computeSumOfSquares(const NumericTable & data, size_t nDataRows,
+                                                                                            algorithmFpType * dataSq)
+{
+    const size_t nFeatures   = data.getNumberOfColumns();
+    const size_t blockSize   = bfKnnDataBlockRowCount;
+    const size_t nDataBlocks = nDataRows / blockSize + !!(nDataRows % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        const size_t start = iBlock * blockSize;
+        const size_t count = (start + blockSize > nDataRows) ? nDataRows - start : blockSize;
+
+        ReadRows<algorithmFpType, cpu> dataRows(const_cast<NumericTable &>(data), start, count);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFpType * const dataPtr = dataRows.get();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            algorithmFpType sum = algorithmFpType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; ++j)
+            {
+                sum += dataPtr[i * nFeatures + j] * dataPtr[i * nFeatures + j];
+            }
+            dataSq[start + i] = sum;
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, cpu>::updateNeighbors(const algorithmFpType * distances, size_t dataBlockStart,
+                                                                            size_t dataBlockRowCount, size_t k,
+                                                                            BruteForceNeighbor<algorithmFpType> * heap, size_t & heapSize)
+{
+    auto compare = [](const BruteForceNeighbor<algorithmFpType> & a, const BruteForceNeighbor<algorithmFpType> & b) -> bool {
+        return a.distance < b.distance;
+    };
+
+    size_t j = 0;
+    /* Fill the heap with the first k training rows */
+    for (; j < dataBlockRowCount && heapSize < k; ++j)
+    {
+        heap[heapSize].distance = distances[j];
+        heap[heapSize].index    = dataBlockStart + j;
+        if (++heapSize == k)
+        {
+            daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + k, compare);
+        }
+    }
+    /* Replace the farthest neighbor found so far */
+    for (; j < dataBlockRowCount; ++j)
+    {
+        if (distances[j] < heap[0].distance)
+        {
+            heap[0].distance = distances[j];
+            heap[0].index    = dataBlockStart + j;
+            daal::algorithms::internal::internalAdjustMaxHeap<cpu>(heap, heap + k, k, size_t(0), compare);
+        }
+    }
+}
+
+template <typename algorithmFpType, CpuType cpu>
+algorithmFpType KNNClassificationPredictKernel<algorithmFpType, cpu>::vote(const BruteForceNeighbor<algorithmFpType> * heap, size_t heapSize,
+                                                                            const int * labels, int * classes)
+{
+    if (heapSize < 1) return algorithmFpType(0);
+
+    for (size_t i = 0; i < heapSize; ++i)
+    {
+        classes[i] = labels[heap[i].index];
+    }
+    daal::algorithms::internal::qSort<int, cpu>(heapSize, classes);
+
+    int currentClass     = classes[0];
+    int winnerClass      = currentClass;
+    size_t currentWeight = 1;
+    size_t winnerWeight  = currentWeight;
+    for (size_t i = 1; i < heapSize; ++i)
+    {
+        if (classes[i] == currentClass)
+        {
+            if ((++currentWeight) > winnerWeight)
+            {
+                winnerWeight = currentWeight;
+                winnerClass  = currentClass;
+            }
+        }
+        else
+        {
+            currentWeight = 1;
+            currentClass  = classes[i];
+        }
+    }
+    return algorithmFpType(winnerClass);
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
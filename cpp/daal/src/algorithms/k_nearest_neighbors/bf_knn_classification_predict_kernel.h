@@ -0,0 +1,74 @@
+/* file: bf_knn_classification_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the CPU kernel for brute force kNN prediction
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_PREDICT_KERNEL_H__
+#define __BF_KNN_CLASSIFICATION_PREDICT_KERNEL_H__
+
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/k_nearest_neighbors/bf_knn_classification_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+/**
+ * Neighbor candidate stored in the per-query max-heap
+ */
+template <typename algorithmFpType>
+struct BruteForceNeighbor
+{
+    algorithmFpType distance;
+    size_t index;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+
+protected:
+    services::Status computeSumOfSquares(const NumericTable & data, size_t nDataRows, algorithmFpType * dataSq);
+
+    void updateNeighbors(const algorithmFpType * distances, size_t dataBlockStart, size_t dataBlockRowCount, size_t k,
+                         BruteForceNeighbor<algorithmFpType> * heap, size_t & heapSize);
+
+    algorithmFpType vote(const BruteForceNeighbor<algorithmFpType> * heap, size_t heapSize, const int * labels, int * classes);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
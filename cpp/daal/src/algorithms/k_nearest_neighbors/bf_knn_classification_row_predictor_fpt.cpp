@@ -0,0 +1,210 @@
+/* file: bf_knn_classification_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of brute force k nearest neighbors classification prediction of a single observation.
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/bf_knn_classification_row_predictor.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h"
+#include "src/algorithms/service_heap.h"
+#include "src/algorithms/service_sort.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace prediction
+{
+namespace interface1
+{
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::Impl
+{
+public:
+    Impl() : _nFeatures(0), _nDataRows(0), _k(0) {}
+
+    services::Status prepare(const bf_knn_classification::ModelPtr & model, const Parameter & parameter)
+    {
+        DAAL_CHECK(model && model->impl(), services::ErrorNullModel);
+        DAAL_CHECK(parameter.k > 0, services::ErrorIncorrectParameter);
+        data_management::NumericTablePtr data   = model->impl()->getData();
+        data_management::NumericTablePtr labels = model->impl()->getLabels();
+        DAAL_CHECK(data && labels, services::ErrorModelNotFullInitialized);
+
+        const size_t nFeatures = data->getNumberOfColumns();
+        const size_t nDataRows = services::internal::min<sse2, size_t>(data->getNumberOfRows(), labels->getNumberOfRows());
+        DAAL_CHECK(nFeatures && nDataRows, services::ErrorModelNotFullInitialized);
+
+        daal::internal::ReadRows<algorithmFPType, sse2> dataRows(data.get(), 0, nDataRows);
+        DAAL_CHECK_BLOCK_STATUS(dataRows);
+        daal::internal::ReadColumns<int, sse2> labelsColumn(labels.get(), 0, 0, nDataRows);
+        DAAL_CHECK_BLOCK_STATUS(labelsColumn);
+
+        const size_t k = services::internal::min<sse2, size_t>(parameter.k, nDataRows);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nDataRows, nFeatures);
+        _data.reset(nDataRows * nFeatures);
+        _norms.reset(nDataRows);
+        _labels.reset(nDataRows);
+        _heap.reset(k);
+        _votes.reset(k);
+        DAAL_CHECK_MALLOC(_data.get() && _norms.get() && _labels.get() && _heap.get() && _votes.get());
+
+        /* the squared norms of the training observations are computed once, ||t - q||^2 - ||q||^2 = ||t||^2 - 2 <t, q> keeps the order */
+        const algorithmFPType * const pData = dataRows.get();
+        const int * const pLabels           = labelsColumn.get();
+        for (size_t i = 0; i < nDataRows; ++i)
+        {
+            const algorithmFPType * const row = pData + i * nFeatures;
+            algorithmFPType * const dst       = _data.get() + i * nFeatures;
+            algorithmFPType norm              = algorithmFPType(0);
+            for (size_t j = 0; j < nFeatures; ++j)
+            {
+                dst[j] = row[j];
+                norm += row[j] * row[j];
+            }
+            _norms[i]  = norm;
+            _labels[i] = pLabels[i];
+        }
+
+        _nFeatures = nFeatures;
+        _nDataRows = nDataRows;
+        _k         = k;
+        return services::Status();
+    }
+
+    services::Status predict(const algorithmFPType * const x, algorithmFPType * const label)
+    {
+        HeapItem * const heap = _heap.get();
+        for (size_t i = 0; i < _nDataRows; ++i)
+        {
+            const algorithmFPType * const row = _data.get() + i * _nFeatures;
+            algorithmFPType dot               = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nFeatures; ++j) dot += row[j] * x[j];
+            const algorithmFPType distance = _norms[i] - algorithmFPType(2) * dot;
+
+            /* the heap keeps the k nearest observations found so far with the farthest one at the top */
+            if (i < _k)
+            {
+                heap[i].distance = distance;
+                heap[i].index    = i;
+                if (i + 1 == _k) algorithms::internal::makeMaxHeap<sse2>(heap, heap + _k, compare);
+            }
+            else if (distance < heap[0].distance)
+            {
+                heap[0].distance = distance;
+                heap[0].index    = i;
+                algorithms::internal::internalAdjustMaxHeap<sse2>(heap, heap + _k, _k, size_t(0), compare);
+            }
+        }
+
+        int * const votes = _votes.get();
+        for (size_t i = 0; i < _k; ++i) votes[i] = _labels[heap[i].index];
+        daal::algorithms::internal::qSort<int, sse2>(_k, votes);
+
+        /* the most frequent class wins, the ties are resolved in favor of the smallest label as in the batch prediction */
+        int winner         = votes[0];
+        size_t winnerCount = 0;
+        for (size_t i = 0; i < _k;)
+        {
+            size_t j = i + 1;
+            while (j < _k && votes[j] == votes[i]) ++j;
+            if (j - i > winnerCount)
+            {
+                winner      = votes[i];
+                winnerCount = j - i;
+            }
+            i = j;
+        }
+        *label = algorithmFPType(winner);
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    struct HeapItem
+    {
+        algorithmFPType distance;
+        size_t index;
+    };
+
+    static bool compare(const HeapItem & lhs, const HeapItem & rhs) { return lhs.distance < rhs.distance; }
+
+    services::internal::TArray<algorithmFPType, sse2> _data;
+    services::internal::TArray<algorithmFPType, sse2> _norms;
+    services::internal::TArray<int, sse2> _labels;
+    services::internal::TArray<HeapItem, sse2> _heap;
+    services::internal::TArray<int, sse2> _votes;
+    size_t _nFeatures;
+    size_t _nDataRows;
+    size_t _k;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor() : _impl(nullptr)
+{}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::prepare(const bf_knn_classification::ModelPtr & model, const Parameter & parameter)
+{
+    delete _impl;
+    _impl = new Impl();
+    DAAL_CHECK_MALLOC(_impl);
+    const services::Status s = _impl->prepare(model, parameter);
+    if (!s)
+    {
+        delete _impl;
+        _impl = nullptr;
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::predict(const algorithmFPType * x, algorithmFPType * label)
+{
+    DAAL_CHECK(_impl, services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, label);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface1
+} // namespace prediction
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -20,6 +20,7 @@
 
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_model.h"
 #include "data_management/data/numeric_table_sycl_homogen.h"
+#include "data_management/data/homogen_numeric_table.h"
 
 #include "services/daal_defines.h"
 
@@ -77,6 +78,13 @@ protected:
         }
         else
         {
+            auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+            auto & deviceInfo = context.getInfoDevice();
+            if (deviceInfo.isCpu)
+            {
+                return copyTableCpu<algorithmFPType>(value, dest);
+            }
+
             services::Status status;
             dest = data_management::SyclHomogenNumericTable<algorithmFPType>::create(value->getNumberOfColumns(), value->getNumberOfRows(),
                                                                                      data_management::NumericTable::doAllocate, &status);
@@ -86,7 +94,6 @@ protected:
             DAAL_CHECK_STATUS_VAR(value->getBlockOfRows(0, value->getNumberOfRows(), data_management::readOnly, srcBD));
             auto source      = srcBD.getBuffer();
             auto destination = destBD.getBuffer();
-            auto & context   = services::Environment::getInstance()->getDefaultExecutionContext();
             context.copy(destination, 0, source, 0, source.size(), &status);
             DAAL_CHECK_STATUS_VAR(status);
             DAAL_CHECK_STATUS_VAR(dest->releaseBlockOfRows(destBD));
@@ -95,6 +102,24 @@ protected:
         return services::Status();
     }
 
+    /* Host memory copy: the CPU execution context does not copy buffers */
+    template <typename algorithmFPType>
+    DAAL_FORCEINLINE services::Status copyTableCpu(const data_management::NumericTablePtr & value, data_management::NumericTablePtr & dest)
+    {
+        services::Status status;
+        dest = data_management::HomogenNumericTable<algorithmFPType>::create(value->getNumberOfColumns(), value->getNumberOfRows(),
+                                                                             data_management::NumericTable::doAllocate, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        data_management::BlockDescriptor<algorithmFPType> destBD, srcBD;
+        DAAL_CHECK_STATUS_VAR(dest->getBlockOfRows(0, dest->getNumberOfRows(), data_management::writeOnly, destBD));
+        DAAL_CHECK_STATUS_VAR(value->getBlockOfRows(0, value->getNumberOfRows(), data_management::readOnly, srcBD));
+        const size_t size = srcBD.getNumberOfColumns() * srcBD.getNumberOfRows() * sizeof(algorithmFPType);
+        const int result  = services::internal::daal_memcpy_s(destBD.getBlockPtr(), size, srcBD.getBlockPtr(), size);
+        DAAL_CHECK_STATUS_VAR(dest->releaseBlockOfRows(destBD));
+        DAAL_CHECK_STATUS_VAR(value->releaseBlockOfRows(srcBD));
+        return (!result) ? services::Status() : services::Status(services::ErrorMemoryCopyFailedInternal);
+    }
+
 private:
     size_t _nFeatures;
     data_management::NumericTablePtr _data;
@@ -93,7 +93,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                                            result->get(nIterations).get() };
 
     interface1::Parameter * par = static_cast<interface1::Parameter *>(_par);
-    interface2::Parameter par2(par->nClusters, par->maxIterations);
+    interface3::Parameter par2(par->nClusters, par->maxIterations);
     convertParameter(*par, par2);
     daal::services::Environment::env & env = *_env;
 
@@ -125,7 +125,7 @@ services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>:
     Input * input               = static_cast<Input *>(_in);
     PartialResult * pres        = static_cast<PartialResult *>(_pres);
     interface1::Parameter * par = static_cast<interface1::Parameter *>(_par);
-    interface2::Parameter par2(par->nClusters, par->maxIterations);
+    interface3::Parameter par2(par->nClusters, par->maxIterations);
     convertParameter(*par, par2);
 
     const size_t na = 2;
@@ -157,7 +157,7 @@ services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>:
     Result * res         = static_cast<Result *>(_res);
 
     interface1::Parameter * par = static_cast<interface1::Parameter *>(_par);
-    interface2::Parameter par2(par->nClusters, par->maxIterations);
+    interface3::Parameter par2(par->nClusters, par->maxIterations);
     convertParameter(*par, par2);
 
     const size_t na = 1;
@@ -218,7 +218,7 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
     r[4] = static_cast<NumericTable *>(pres->get(partialCandidatesCentroids).get());
 
     interface1::Parameter * par = static_cast<interface1::Parameter *>(_par);
-    interface2::Parameter par2(par->nClusters, par->maxIterations);
+    interface3::Parameter par2(par->nClusters, par->maxIterations);
     convertParameter(*par, par2);
     daal::services::Environment::env & env = *_env;
 
@@ -249,7 +249,7 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
     r[1] = static_cast<NumericTable *>(result->get(objectiveFunction).get());
 
     interface1::Parameter * par = static_cast<interface1::Parameter *>(_par);
-    interface2::Parameter par2(par->nClusters, par->maxIterations);
+    interface3::Parameter par2(par->nClusters, par->maxIterations);
     convertParameter(*par, par2);
     daal::services::Environment::env & env = *_env;
 
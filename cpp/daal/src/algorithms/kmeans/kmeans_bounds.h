@@ -0,0 +1,70 @@
+/* file: kmeans_bounds.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Auxiliary functions used in the bounded Lloyd method of K-means algorithm.
+//--
+*/
+
+#ifndef _KMEANS_BOUNDS_H__
+#define _KMEANS_BOUNDS_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+/**
+ * Returns the number of groups of centroids an observation keeps a lower bound for.
+ * A single group gives the Hamerly algorithm, that is the fastest one for a small number of clusters.
+ * For a large number of clusters the centroids are split into groups of about ten centroids (Yinyang algorithm),
+ * the number of groups is limited to keep the memory footprint of the bounds moderate
+ */
+inline size_t kmeansGetNumberOfBoundGroups(const size_t nClusters)
+{
+    const size_t maxClustersForSingleGroup = 32;
+    const size_t nClustersPerGroup         = 10;
+    const size_t maxGroups                 = 32;
+
+    if (nClusters <= maxClustersForSingleGroup)
+    {
+        return 1;
+    }
+    const size_t nGroups = (nClusters + nClustersPerGroup - 1) / nClustersPerGroup;
+    return (nGroups < maxGroups) ? nGroups : maxGroups;
+}
+
+/**
+ * Returns the number of centroids in every group but the last one
+ */
+inline size_t kmeansGetBoundGroupSize(const size_t nClusters, const size_t nGroups)
+{
+    return (nClusters + nGroups - 1) / nGroups;
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+
+#endif
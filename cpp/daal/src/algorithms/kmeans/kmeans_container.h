@@ -28,6 +28,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "src/algorithms/kmeans/kmeans_lloyd_kernel.h"
 #include "src/algorithms/kmeans/oneapi/kmeans_dense_lloyd_batch_kernel_ucapi.h"
 #include "sycl/internal/execution_context.h"
@@ -78,7 +79,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * r[lastResultId + 1] = { result->get(centroids).get(), result->get(assignments).get(), result->get(objectiveFunction).get(),
                                            result->get(nIterations).get() };
 
-    Parameter * par                        = static_cast<Parameter *>(_par);
+    kmeans::Parameter * par                = static_cast<kmeans::Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
     if (deviceInfo.isCpu || method != lloydDense)
@@ -106,9 +107,9 @@ DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedCont
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
 {
-    Input * input        = static_cast<Input *>(_in);
-    PartialResult * pres = static_cast<PartialResult *>(_pres);
-    Parameter * par      = static_cast<Parameter *>(_par);
+    Input * input           = static_cast<Input *>(_in);
+    PartialResult * pres    = static_cast<PartialResult *>(_pres);
+    kmeans::Parameter * par = static_cast<kmeans::Parameter *>(_par);
 
     const size_t na = 2;
     NumericTable * a[na];
@@ -116,17 +117,23 @@ services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>:
     a[1] = static_cast<NumericTable *>(input->get(inputCentroids).get());
 
     const size_t isAssignments = par->resultsToEvaluate & computeAssignments || par->assignFlag;
-    const size_t nr            = 5 + isAssignments;
-    NumericTable * r[6];
+    const size_t isBounds      = (method == boundedLloydDense);
+    const size_t nr            = isBounds ? 8 : 5 + isAssignments;
+    NumericTable * r[8];
     r[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
     r[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
     r[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
     r[3] = static_cast<NumericTable *>(pres->get(partialCandidatesDistances).get());
     r[4] = static_cast<NumericTable *>(pres->get(partialCandidatesCentroids).get());
-    if (isAssignments)
+    if (isAssignments || isBounds)
     {
         r[5] = static_cast<NumericTable *>(pres->get(partialAssignments).get());
     }
+    if (isBounds)
+    {
+        r[6] = static_cast<NumericTable *>(pres->get(partialLowerBounds).get());
+        r[7] = static_cast<NumericTable *>(pres->get(partialBoundsCentroids).get());
+    }
 
     daal::services::Environment::env & env = *_env;
 
@@ -136,9 +143,9 @@ services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>:
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
 {
-    PartialResult * pres = static_cast<PartialResult *>(_pres);
-    Result * res         = static_cast<Result *>(_res);
-    Parameter * par      = static_cast<Parameter *>(_par);
+    PartialResult * pres    = static_cast<PartialResult *>(_pres);
+    Result * res            = static_cast<Result *>(_res);
+    kmeans::Parameter * par = static_cast<kmeans::Parameter *>(_par);
 
     const size_t na = 1;
     NumericTable * a[na];
@@ -197,7 +204,7 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
     r[3] = static_cast<NumericTable *>(pres->get(partialCandidatesDistances).get());
     r[4] = static_cast<NumericTable *>(pres->get(partialCandidatesCentroids).get());
 
-    Parameter * par                        = static_cast<Parameter *>(_par);
+    kmeans::Parameter * par                = static_cast<kmeans::Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
     services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::KMeansDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType),
@@ -226,13 +233,74 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
     r[0] = static_cast<NumericTable *>(result->get(centroids).get());
     r[1] = static_cast<NumericTable *>(result->get(objectiveFunction).get());
 
-    Parameter * par                        = static_cast<Parameter *>(_par);
+    kmeans::Parameter * par                = static_cast<kmeans::Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::KMeansDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r,
                        par);
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansOnlineKernel, method, algorithmFPType);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * input           = static_cast<Input *>(_in);
+    PartialResult * pres    = static_cast<PartialResult *>(_pres);
+    kmeans::Parameter * par = static_cast<kmeans::Parameter *>(_par);
+
+    const size_t na = 2;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(input->get(data).get());
+    a[1] = static_cast<NumericTable *>(input->get(inputCentroids).get());
+
+    const size_t nr = 3;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    Input * input           = static_cast<Input *>(_in);
+    PartialResult * pres    = static_cast<PartialResult *>(_pres);
+    Result * result         = static_cast<Result *>(_res);
+    kmeans::Parameter * par = static_cast<kmeans::Parameter *>(_par);
+
+    const size_t na = 4;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    a[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    a[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+    a[3] = static_cast<NumericTable *>(input->get(inputCentroids).get());
+
+    const size_t nr = 3;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(result->get(centroids).get());
+    r[1] = static_cast<NumericTable *>(result->get(objectiveFunction).get());
+    r[2] = static_cast<NumericTable *>(result->get(nIterations).get());
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r, par);
+}
+
 } // namespace interface2
 } // namespace kmeans
 } // namespace algorithms
@@ -86,6 +86,15 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     {
         DAAL_CHECK(inputRows >= kmPar->nClusters, ErrorKMeansNumberOfClustersIsTooLarge);
     }
+
+    /* Distance bounds of boundedLloydDense are computed without the weights of categorical features */
+    if (method == boundedLloydDense)
+    {
+        for (size_t i = 0; i < inputFeatures; i++)
+        {
+            DAAL_CHECK(get(data)->getFeatureType(i) != features::DAAL_CATEGORICAL, ErrorKMeansCategoricalFeaturesAreNotSupported);
+        }
+    }
     return checkNumericTable(get(inputCentroids).get(), inputCentroidsStr(), 0, 0, inputFeatures, kmPar->nClusters);
 }
 
@@ -124,12 +124,29 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
 
-    TArray<double, cpu> dS1(method == defaultDense ? p : 0);
-    if (method == defaultDense)
+    const bool isDoubleSums = (method == defaultDense || method == boundedLloydDense);
+    TArray<double, cpu> dS1(isDoubleSums ? p : 0);
+    if (isDoubleSums)
     {
         DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
     }
 
+    /* Distance bounds kept between the iterations by the bounded method */
+    const bool isBounds  = (method == boundedLloydDense);
+    const size_t nGroups = isBounds ? kmeansGetNumberOfBoundGroups(nClusters) : 0;
+    if (isBounds)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nGroups);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nGroups, sizeof(algorithmFPType));
+    }
+    TArrayCalloc<int, cpu> assignState(isBounds ? n : 0);
+    TArrayCalloc<algorithmFPType, cpu> lowerBounds(isBounds ? n * nGroups : 0);
+    TArrayCalloc<algorithmFPType, cpu> boundsCentroids(isBounds ? nClusters * p : 0);
+    if (isBounds)
+    {
+        DAAL_CHECK(assignState.get() && lowerBounds.get() && boundsCentroids.get(), services::ErrorMemoryAllocationFailed);
+    }
+
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(algorithmFPType));
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(size_t));
 
@@ -145,13 +162,23 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
     for (kIter = 0; kIter < nIter; kIter++)
     {
+        /* Temporaries of the iteration reuse the memory of the previous one */
+        ScratchArenaScope scratch;
         auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(p, nClusters, inClusters, blockSize);
         DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
             /* For the last iteration we do not need to recount of assignmets */
-            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize,
-                                                           assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr);
+            NumericTable * const ntAssign = assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr;
+            if (isBounds)
+            {
+                s = task->addNTToTaskThreadedBounded(ntData, blockSize, assignState.get(), lowerBounds.get(), nGroups, boundsCentroids.get(),
+                                                     ntAssign);
+            }
+            else
+            {
+                s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize, ntAssign);
+            }
         }
 
         if (!s)
@@ -120,7 +120,21 @@ Status KMeansDistributedStep1Kernel<method, algorithmFPType, cpu>::compute(size_
         DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
         DAAL_ASSERT(task);
 
-        if (par->resultsToEvaluate & computeAssignments || par->assignFlag)
+        if (method == boundedLloydDense)
+        {
+            /* The bounds are kept in the partial result between the calls of the algorithm */
+            NumericTable * ntLowerBounds = const_cast<NumericTable *>(r[6]);
+            WriteRows<int, cpu> mtAssignState(ntAssignments, 0, n);
+            DAAL_CHECK_BLOCK_STATUS(mtAssignState);
+            WriteRows<algorithmFPType, cpu> mtLowerBounds(ntLowerBounds, 0, n);
+            DAAL_CHECK_BLOCK_STATUS(mtLowerBounds);
+            WriteRows<algorithmFPType, cpu> mtBoundsCentroids(const_cast<NumericTable *>(r[7]), 0, nClusters);
+            DAAL_CHECK_BLOCK_STATUS(mtBoundsCentroids);
+
+            s = task->addNTToTaskThreadedBounded(ntData, blockSize, mtAssignState.get(), mtLowerBounds.get(), ntLowerBounds->getNumberOfColumns(),
+                                                 mtBoundsCentroids.get());
+        }
+        else if (par->resultsToEvaluate & computeAssignments || par->assignFlag)
         {
             s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize, ntAssignments);
         }
@@ -136,8 +150,8 @@ Status KMeansDistributedStep1Kernel<method, algorithmFPType, cpu>::compute(size_
 
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
 
-        TArray<double, cpu> dS1(method == defaultDense ? p : 0);
-        if (method == defaultDense)
+        TArray<double, cpu> dS1((method == defaultDense || method == boundedLloydDense) ? p : 0);
+        if (method == defaultDense || method == boundedLloydDense)
         {
             DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
         }
@@ -35,6 +35,7 @@
 #include "src/externals/service_spblas.h"
 #include "src/services/service_data_utils.h"
 #include "src/services/service_environment.h"
+#include "src/algorithms/kmeans/kmeans_bounds.h"
 
 namespace daal
 {
@@ -60,6 +61,7 @@ struct TlsTask
         cS0      = service_scalable_calloc<int, cpu>(clNum);
         cValues  = service_scalable_calloc<algorithmFPType, cpu>(clNum);
         cIndices = service_scalable_calloc<size_t, cpu>(clNum);
+        rowsIdx  = service_scalable_calloc<size_t, cpu>(maxBlockSize);
     }
 
     ~TlsTask()
@@ -84,6 +86,10 @@ struct TlsTask
         {
             service_scalable_free<size_t, cpu>(cIndices);
         }
+        if (rowsIdx)
+        {
+            service_scalable_free<size_t, cpu>(rowsIdx);
+        }
     }
 
     static TlsTask<algorithmFPType, cpu> * create(const size_t dim, const size_t clNum, const size_t maxBlockSize)
@@ -93,7 +99,7 @@ struct TlsTask
         {
             return nullptr;
         }
-        if (!result->mklBuff || !result->cS1 || !result->cS0)
+        if (!result->mklBuff || !result->cS1 || !result->cS0 || !result->rowsIdx)
         {
             delete result;
             return nullptr;
@@ -108,6 +114,7 @@ struct TlsTask
     size_t cNum               = 0;
     algorithmFPType * cValues = nullptr;
     size_t * cIndices         = nullptr;
+    size_t * rowsIdx          = nullptr; /* Rows of the block whose distances are recomputed by the bounded method */
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -151,6 +158,10 @@ struct BSHelper<lloydCSR, algorithmFPType, cpu>
     static size_t kmeansGetBlockSize(const size_t nRows, const size_t dim, const size_t clNum) { return 512; }
 };
 
+template <typename algorithmFPType, CpuType cpu>
+struct BSHelper<boundedLloydDense, algorithmFPType, cpu> : public BSHelper<lloydDense, algorithmFPType, cpu>
+{};
+
 template <typename algorithmFPType>
 struct Fp2IntSize
 {};
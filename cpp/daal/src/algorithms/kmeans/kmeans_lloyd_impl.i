@@ -31,6 +31,7 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_spblas.h"
 #include "src/services/service_data_utils.h"
+#include "src/externals/service_math.h"
 
 #include "src/algorithms/kmeans/kmeans_lloyd_helper.h"
 
@@ -62,7 +63,7 @@ struct TaskKMeansLloyd
             return TlsTask<algorithmFPType, cpu>::create(dim, clNum, max_block_size);
         }); /* Allocate memory for all arrays inside TLS: end */
 
-        clSq = service_scalable_calloc<algorithmFPType, cpu>(clNum);
+        clSq = service_scratch_malloc<algorithmFPType, cpu>(clNum);
         if (clSq)
         {
             for (size_t k = 0; k < clNum; k++)
@@ -88,7 +89,7 @@ struct TaskKMeansLloyd
         }
         if (clSq)
         {
-            service_scalable_free<algorithmFPType, cpu>(clSq);
+            service_scratch_free<algorithmFPType, cpu>(clSq);
         }
     }
 
@@ -112,6 +113,10 @@ struct TaskKMeansLloyd
     Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                NumericTable * ntAssign = nullptr);
 
+    Status addNTToTaskThreadedBounded(const NumericTable * const ntData, const size_t blockSizeDefault, int * const assignState,
+                                      algorithmFPType * const lowerBounds, const size_t lbStride, algorithmFPType * const boundsCentroids,
+                                      NumericTable * ntAssign = nullptr);
+
     template <typename centroidsFPType>
     int kmeansUpdateCluster(int jidx, centroidsFPType * s1);
 
@@ -343,6 +348,268 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     return safeStat.detach();
 }
 
+/*
+ * Assigns observations to the nearest centroids using the distance bounds kept between iterations.
+ * Every observation keeps the assigned centroid in assignState and lower bounds of the distances
+ * to the other centroids of each group in lowerBounds. The bounds are computed for boundsCentroids,
+ * they are decreased by the largest shift of a centroid in the group, so the distances are recomputed
+ * only for the observations whose distance to the assigned centroid exceeds a lower bound.
+ * Zero bounds filter out no observations, that is the state before the first iteration
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedBounded(const NumericTable * const ntData, const size_t blockSizeDefault,
+                                                                         int * const assignState, algorithmFPType * const lowerBounds,
+                                                                         const size_t lbStride, algorithmFPType * const boundsCentroids,
+                                                                         NumericTable * ntAssign)
+{
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = dim;
+    const size_t nClusters = clNum;
+    const size_t groupSize = kmeansGetBoundGroupSize(nClusters, lbStride);
+    const size_t nGroups   = (nClusters + groupSize - 1) / groupSize;
+
+    TArrayScratch<algorithmFPType, cpu> groupShiftArr(nGroups);
+    DAAL_CHECK_MALLOC(groupShiftArr.get());
+    algorithmFPType * const groupShift = groupShiftArr.get();
+    service_memset_seq<algorithmFPType, cpu>(groupShift, algorithmFPType(0), nGroups);
+
+    for (size_t j = 0; j < nClusters; j++)
+    {
+        algorithmFPType shift = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t l = 0; l < p; l++)
+        {
+            const algorithmFPType diff = cCenters[j * p + l] - boundsCentroids[j * p + l];
+            shift += diff * diff;
+        }
+        shift = Math<algorithmFPType, cpu>::sSqrt(shift);
+        if (shift > groupShift[j / groupSize])
+        {
+            groupShift[j / groupSize] = shift;
+        }
+    }
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k) {
+        struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local();
+        DAAL_CHECK_MALLOC_THR(tt);
+        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k * blockSizeDefault, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        const algorithmFPType * const inClusters = cCenters;
+        const algorithmFPType * const clustersSq = clSq;
+        const algorithmFPType maxDist            = MaxVal<algorithmFPType>::get();
+
+        int * const assign         = assignState + k * blockSizeDefault;
+        algorithmFPType * const lb = lowerBounds + k * blockSizeDefault * lbStride;
+
+        algorithmFPType * trg        = &(tt->goalFunc);
+        algorithmFPType * x_clusters = tt->mklBuff;
+        size_t * rowsIdx             = tt->rowsIdx;
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        int * assignments = nullptr;
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, k * blockSizeDefault, blockSize);
+        if (ntAssign)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        /* Shift the lower bounds to the new centroids and keep the rows whose assigned centroid may be not the nearest one */
+        size_t nRowsToUpdate = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            algorithmFPType * const lbRow = lb + i * lbStride;
+            if (assign[i] < 0 || assign[i] >= (int)nClusters)
+            {
+                assign[i] = 0;
+                service_memset_seq<algorithmFPType, cpu>(lbRow, algorithmFPType(0), nGroups);
+            }
+
+            algorithmFPType minLb = maxDist;
+            for (size_t g = 0; g < nGroups; g++)
+            {
+                lbRow[g] = (lbRow[g] > groupShift[g]) ? lbRow[g] - groupShift[g] : algorithmFPType(0);
+                minLb    = (lbRow[g] < minLb) ? lbRow[g] : minLb;
+            }
+
+            const algorithmFPType * const x = data + i * p;
+            const algorithmFPType * const c = inClusters + assign[i] * p;
+            algorithmFPType ubSq            = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t l = 0; l < p; l++)
+            {
+                ubSq += (x[l] - c[l]) * (x[l] - c[l]);
+            }
+            if (ubSq > minLb * minLb)
+            {
+                rowsIdx[nRowsToUpdate++] = i;
+            }
+        }
+
+        /* Compute all the distances of the block with matrix multiplication if most of the rows are to be updated */
+        const bool useGemm = (2 * nRowsToUpdate >= blockSize);
+        if (useGemm)
+        {
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT _m           = blockSize;
+            const DAAL_INT _n           = nClusters;
+            const DAAL_INT _k           = p;
+            const algorithmFPType alpha = -1.0;
+            const DAAL_INT lda          = p;
+            const DAAL_INT ldy          = p;
+            const algorithmFPType beta  = 1.0;
+            const DAAL_INT ldaty        = blockSize;
+
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < blockSize; i++)
+                {
+                    x_clusters[i + j * blockSize] = clustersSq[j];
+                }
+            }
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data, &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
+        }
+
+        for (size_t iRow = 0; iRow < nRowsToUpdate; iRow++)
+        {
+            const size_t i                  = rowsIdx[iRow];
+            const algorithmFPType * const x = data + i * p;
+            algorithmFPType * const lbRow   = lb + i * lbStride;
+
+            algorithmFPType xSq = algorithmFPType(0);
+            if (useGemm)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t l = 0; l < p; l++)
+                {
+                    xSq += x[l] * x[l];
+                }
+            }
+
+            /* x_clusters contains 0.5 * ||c||^2 - x * c */
+            auto distance = [=](const size_t j) -> algorithmFPType {
+                algorithmFPType distSq = algorithmFPType(0);
+                if (useGemm)
+                {
+                    distSq = xSq + 2 * x_clusters[i + j * blockSize];
+                }
+                else
+                {
+                    const algorithmFPType * const c = inClusters + j * p;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t l = 0; l < p; l++)
+                    {
+                        distSq += (x[l] - c[l]) * (x[l] - c[l]);
+                    }
+                }
+                return (distSq > algorithmFPType(0)) ? Math<algorithmFPType, cpu>::sSqrt(distSq) : algorithmFPType(0);
+            };
+
+            const size_t oldIdx                 = assign[i];
+            const algorithmFPType oldDist       = distance(oldIdx);
+            size_t bestIdx                      = oldIdx;
+            algorithmFPType bestDist            = oldDist;
+            size_t bestGroup                    = 0;
+            algorithmFPType bestGroupSecondDist = maxDist;
+
+            for (size_t g = 0; g < nGroups; g++)
+            {
+                /* None of the centroids of the group is closer than the best one found so far */
+                if (lbRow[g] >= bestDist) continue;
+
+                const size_t jEnd          = (g + 1) * groupSize < nClusters ? (g + 1) * groupSize : nClusters;
+                algorithmFPType firstDist  = maxDist;
+                algorithmFPType secondDist = maxDist;
+                size_t firstIdx            = 0;
+                for (size_t j = g * groupSize; j < jEnd; j++)
+                {
+                    if (j == oldIdx) continue;
+                    const algorithmFPType dist = distance(j);
+                    if (dist < firstDist)
+                    {
+                        secondDist = firstDist;
+                        firstDist  = dist;
+                        firstIdx   = j;
+                    }
+                    else if (dist < secondDist)
+                    {
+                        secondDist = dist;
+                    }
+                }
+
+                lbRow[g] = firstDist;
+                if (firstDist < bestDist)
+                {
+                    bestDist            = firstDist;
+                    bestIdx             = firstIdx;
+                    bestGroup           = g;
+                    bestGroupSecondDist = secondDist;
+                }
+            }
+
+            if (bestIdx != oldIdx)
+            {
+                /* The new centroid is excluded from the bound of its group and the old one is included into the bound of its group */
+                lbRow[bestGroup]      = bestGroupSecondDist;
+                const size_t oldGroup = oldIdx / groupSize;
+                lbRow[oldGroup]       = (oldDist < lbRow[oldGroup]) ? oldDist : lbRow[oldGroup];
+                assign[i]             = (int)bestIdx;
+            }
+        }
+
+        algorithmFPType goal = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t minIdx             = assign[i];
+            const algorithmFPType * const x = data + i * p;
+            const algorithmFPType * const c = inClusters + minIdx * p;
+            algorithmFPType minGoalVal      = algorithmFPType(0);
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += x[j];
+                minGoalVal += (x[j] - c[j]) * (x[j] - c[j]);
+            }
+
+            kmeansInsertCandidate(tt, minGoalVal, k * blockSizeDefault + i);
+            cS0[minIdx]++;
+
+            goal += minGoalVal;
+
+            if (ntAssign)
+            {
+                assignments[i] = (int)minIdx;
+            }
+        }
+
+        *trg += goal;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    const int result = daal::services::internal::daal_memcpy_s(boundsCentroids, nClusters * p * sizeof(algorithmFPType), cCenters,
+                                                               nClusters * p * sizeof(algorithmFPType));
+    return (!result) ? Status() : Status(services::ErrorMemoryCopyFailedInternal);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef,
@@ -385,7 +652,7 @@ template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansComputeCentroids(int * clusterS0, algorithmFPType * clusterS1, double * auxData)
 {
-    if (method == defaultDense && auxData)
+    if ((method == defaultDense || method == boundedLloydDense) && auxData)
     {
         for (size_t i = 0; i < clNum; i++)
         {
@@ -440,8 +707,8 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::kmeansComputeCentroidsCandidates(a
 {
     cNum = 0;
 
-    TArray<algorithmFPType, cpu> tmpValues(clNum);
-    TArray<size_t, cpu> tmpIndices(clNum);
+    TArrayScratch<algorithmFPType, cpu> tmpValues(clNum);
+    TArrayScratch<size_t, cpu> tmpIndices(clNum);
     DAAL_CHECK_MALLOC(tmpValues.get() && tmpIndices.get());
 
     algorithmFPType * tmpValuesPtr = tmpValues.get();
@@ -329,6 +329,10 @@ struct PostProcessing<lloydCSR, algorithmFPType, cpu>
     }
 };
 
+template <typename algorithmFPType, CpuType cpu>
+struct PostProcessing<boundedLloydDense, algorithmFPType, cpu> : public PostProcessing<lloydDense, algorithmFPType, cpu>
+{};
+
 } // namespace internal
 } // namespace kmeans
 } // namespace algorithms
@@ -0,0 +1,396 @@
+/* file: kmeans_minibatch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch method for K-means algorithm.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/threading/threading.h"
+#include "services/daal_defines.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_defines.h"
+
+#include "src/algorithms/kmeans/kmeans_lloyd_impl.i"
+#include "src/algorithms/kmeans/kmeans_lloyd_postprocessing.h"
+#include "src/algorithms/distributions/uniform/uniform_kernel.h"
+#include "src/algorithms/distributions/uniform/uniform_impl.i"
+#include "algorithms/engines/mt2203/mt2203.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kmeans.dense.minibatch);
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::algorithms::distributions::uniform::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+/*
+ * Assigns the observations of the mini-batch to the nearest centroids and moves every centroid towards the mean
+ * of its observations. The learning rate of the centroid is the inverse number of all the observations assigned
+ * to it so far, so the centroid stays the mean of all these observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status updateCentroidsOnMiniBatch(const NumericTable * const ntBatch, const size_t p, const size_t nClusters, algorithmFPType * const centroids,
+                                  algorithmFPType * const counts, int * const clusterS0, algorithmFPType * const clusterS1, double * const dS1,
+                                  const size_t blockSize, algorithmFPType & batchGoalFunc, algorithmFPType & centroidsShift)
+{
+    auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(p, nClusters, centroids, blockSize);
+    DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+    Status s;
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
+        s = task->template addNTToTaskThreaded<lloydDense>(ntBatch, nullptr, blockSize);
+    }
+    if (!s)
+    {
+        task->kmeansClearClusters(&batchGoalFunc);
+        return s;
+    }
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(kmeansPartialReduceCentroids);
+        task->template kmeansComputeCentroids<lloydDense>(clusterS0, clusterS1, dS1);
+    }
+    task->kmeansClearClusters(&batchGoalFunc);
+
+    centroidsShift = algorithmFPType(0);
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        if (clusterS0[i] == 0) continue;
+
+        counts[i] += clusterS0[i];
+        const algorithmFPType rate   = algorithmFPType(1) / counts[i];
+        const algorithmFPType nBatch = clusterS0[i];
+
+        algorithmFPType * const c        = centroids + i * p;
+        const algorithmFPType * const s1 = clusterS1 + i * p;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            const algorithmFPType delta = (s1[j] - nBatch * c[j]) * rate;
+            c[j] += delta;
+            centroidsShift += delta * delta;
+        }
+    }
+    return s;
+}
+
+/*
+ * Computes the centroids from the numbers and the sums of the observations assigned to them,
+ * the input centroids are kept for the clusters with no observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeCentroidsFromSums(const size_t p, const size_t nClusters, const algorithmFPType * const counts, const algorithmFPType * const sums,
+                              const algorithmFPType * const inClusters, algorithmFPType * const clusters)
+{
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        const algorithmFPType * const src = (counts[i] > 0) ? sums + i * p : inClusters + i * p;
+        const algorithmFPType coeff       = (counts[i] > 0) ? algorithmFPType(1) / counts[i] : algorithmFPType(1);
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            clusters[i * p + j] = src[j] * coeff;
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status KMeansBatchKernel<miniBatchDense, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r,
+                                                                        const Parameter * par)
+{
+    Status s;
+    NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
+    const size_t nIter     = par->maxIterations;
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    const size_t batchSize = (par->batchSize < n) ? par->batchSize : n;
+
+    /* Default engine is created on demand when the parameter does not provide one */
+    engines::EnginePtr engine = par->engine;
+    if (!engine) engine = engines::mt2203::Batch<>::create();
+    DAAL_CHECK_MALLOC(engine.get());
+    DAAL_CHECK(n <= services::internal::MaxVal<int>::get(), services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(int));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, batchSize, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, batchSize * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
+
+    TArray<int, cpu> clusterS0(nClusters);
+    TArray<algorithmFPType, cpu> clusterS1(nClusters * p);
+    TArrayCalloc<algorithmFPType, cpu> counts(nClusters);
+    TArray<double, cpu> dS1(p);
+    TArray<int, cpu> batchIndices(batchSize);
+    TArray<algorithmFPType, cpu> batchData(batchSize * p);
+    DAAL_CHECK(clusterS0.get() && clusterS1.get() && counts.get() && dS1.get() && batchIndices.get() && batchData.get(),
+               services::ErrorMemoryAllocationFailed);
+
+    NumericTablePtr ntBatch = HomogenNumericTableCPU<algorithmFPType, cpu>::create(batchData.get(), p, batchSize, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+    const algorithmFPType * const inClusters = mtInClusters.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * clusters = mtClusters.get();
+
+    TArray<algorithmFPType, cpu> tClusters;
+    if (clusters == nullptr)
+    {
+        tClusters.reset(nClusters * p);
+        DAAL_CHECK(tClusters.get(), services::ErrorMemoryAllocationFailed);
+        clusters = tClusters.get();
+    }
+    int result = daal::services::internal::daal_memcpy_s(clusters, nClusters * p * sizeof(algorithmFPType), inClusters,
+                                                         nClusters * p * sizeof(algorithmFPType));
+
+    size_t blockSize = 0;
+    DAAL_SAFE_CPU_CALL((blockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(batchSize, p, nClusters)), (blockSize = 512))
+
+    const size_t gatherBlockSize = 256;
+    const size_t nGatherBlocks   = batchSize / gatherBlockSize + !!(batchSize % gatherBlockSize);
+
+    algorithmFPType batchGoalFunc = algorithmFPType(0);
+    size_t kIter;
+
+    for (kIter = 0; kIter < nIter; kIter++)
+    {
+        /* Sample the mini-batch with replacement and gather its observations into the contiguous buffer */
+        DAAL_CHECK_STATUS(s, (UniformKernelDefault<int, cpu>::compute(0, (int)n, *engine, batchSize, batchIndices.get())));
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(gatherMiniBatch);
+
+            const int * const indices        = batchIndices.get();
+            algorithmFPType * const batchPtr = batchData.get();
+            SafeStatus safeStat;
+            daal::threader_for(nGatherBlocks, nGatherBlocks, [=, &safeStat](const size_t iBlock) {
+                const size_t iStart = iBlock * gatherBlockSize;
+                const size_t iEnd   = (iStart + gatherBlockSize < batchSize) ? iStart + gatherBlockSize : batchSize;
+                ReadRows<algorithmFPType, cpu> mtRow;
+                for (size_t i = iStart; i < iEnd; i++)
+                {
+                    const algorithmFPType * const row = mtRow.set(ntData, indices[i], 1);
+                    DAAL_CHECK_BLOCK_STATUS_THR(mtRow);
+
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        batchPtr[i * p + j] = row[j];
+                    }
+                }
+            });
+            DAAL_CHECK_SAFE_STATUS();
+        }
+
+        algorithmFPType centroidsShift = algorithmFPType(0);
+        DAAL_CHECK_STATUS(s, (updateCentroidsOnMiniBatch<algorithmFPType, cpu>(ntBatch.get(), p, nClusters, clusters, counts.get(), clusterS0.get(),
+                                                                              clusterS1.get(), dS1.get(), blockSize, batchGoalFunc, centroidsShift)));
+
+        /* The objective function on a mini-batch is too noisy to stop on, the shift of the centroids is used instead */
+        if (par->accuracyThreshold > (algorithmFPType)0.0 && centroidsShift < par->accuracyThreshold)
+        {
+            kIter++;
+            break;
+        }
+    }
+
+    size_t fullBlockSize = 0;
+    DAAL_SAFE_CPU_CALL((fullBlockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (fullBlockSize = 512))
+
+    NumericTable * assignmetsNT = nullptr;
+    NumericTablePtr assignmentsPtr;
+    if (r[1])
+    {
+        assignmetsNT = const_cast<NumericTable *>(r[1]);
+    }
+    else if (par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        assignmentsPtr = HomogenNumericTableCPU<int, cpu>::create(1, n, &s);
+        DAAL_CHECK_MALLOC(s);
+        assignmetsNT = assignmentsPtr.get();
+    }
+
+    if (assignmetsNT)
+    {
+        DAAL_CHECK_STATUS(s, (PostProcessing<lloydDense, algorithmFPType, cpu>::computeAssignments(p, nClusters, clusters, ntData, nullptr,
+                                                                                                  assignmetsNT, fullBlockSize)));
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    if (par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        algorithmFPType exactTargetFunc = algorithmFPType(0);
+        DAAL_CHECK_STATUS(s, (PostProcessing<lloydDense, algorithmFPType, cpu>::computeExactObjectiveFunction(
+                                 p, nClusters, clusters, ntData, nullptr, assignmetsNT, exactTargetFunc, fullBlockSize)));
+
+        *mtTarget.get() = exactTargetFunc;
+    }
+    else
+    {
+        /* Estimate of the objective function on the whole data set by the last mini-batch */
+        *mtTarget.get() = batchGoalFunc * n / batchSize;
+    }
+
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[3]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = kIter;
+    return (!result) ? s : services::Status(services::ErrorMemoryCopyFailedInternal);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::compute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r,
+                                                                 const Parameter * par)
+{
+    Status s;
+    NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    const size_t batchSize = (par->batchSize < n) ? par->batchSize : n;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(int));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
+
+    TArray<int, cpu> clusterS0(nClusters);
+    TArray<algorithmFPType, cpu> clusterS1(nClusters * p);
+    TArray<algorithmFPType, cpu> clusters(nClusters * p);
+    TArray<double, cpu> dS1(p);
+    DAAL_CHECK(clusterS0.get() && clusterS1.get() && clusters.get() && dS1.get(), services::ErrorMemoryAllocationFailed);
+
+    ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+
+    WriteRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    algorithmFPType * const counts = mtCounts.get();
+
+    WriteRows<algorithmFPType, cpu> mtSums(*const_cast<NumericTable *>(r[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+    algorithmFPType * const sums = mtSums.get();
+
+    WriteRows<algorithmFPType, cpu> mtGoalFunc(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtGoalFunc);
+
+    computeCentroidsFromSums<algorithmFPType, cpu>(p, nClusters, counts, sums, mtInClusters.get(), clusters.get());
+
+    size_t blockSize = 0;
+    DAAL_SAFE_CPU_CALL((blockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(batchSize, p, nClusters)), (blockSize = 512))
+
+    /* The block of the data set is processed as the sequence of mini-batches of consecutive observations */
+    for (size_t iStart = 0; iStart < n; iStart += batchSize)
+    {
+        const size_t nBatchRows = (iStart + batchSize < n) ? batchSize : n - iStart;
+
+        ReadRows<algorithmFPType, cpu> mtBatch(ntData, iStart, nBatchRows);
+        DAAL_CHECK_BLOCK_STATUS(mtBatch);
+        NumericTablePtr ntBatch =
+            HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(mtBatch.get()), p, nBatchRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        algorithmFPType batchGoalFunc  = algorithmFPType(0);
+        algorithmFPType centroidsShift = algorithmFPType(0);
+        DAAL_CHECK_STATUS(s, (updateCentroidsOnMiniBatch<algorithmFPType, cpu>(ntBatch.get(), p, nClusters, clusters.get(), counts, clusterS0.get(),
+                                                                              clusterS1.get(), dS1.get(), blockSize, batchGoalFunc, centroidsShift)));
+        *mtGoalFunc.get() += batchGoalFunc;
+    }
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            sums[i * p + j] = clusters[i * p + j] * counts[i];
+        }
+    }
+    return s;
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(size_t na, const NumericTable * const * a, size_t nr,
+                                                                         const NumericTable * const * r, const Parameter * par)
+{
+    const size_t nClusters = par->nClusters;
+    const size_t p         = a[1]->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable *>(a[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    const algorithmFPType * const counts = mtCounts.get();
+
+    ReadRows<algorithmFPType, cpu> mtSums(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+
+    ReadRows<algorithmFPType, cpu> mtGoalFunc(*const_cast<NumericTable *>(a[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtGoalFunc);
+
+    ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable *>(a[3]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+
+    computeCentroidsFromSums<algorithmFPType, cpu>(p, nClusters, counts, mtSums.get(), mtInClusters.get(), mtClusters.get());
+
+    algorithmFPType nObservationsTotal = algorithmFPType(0);
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        nObservationsTotal += counts[i];
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[1]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    *mtTarget.get() = *mtGoalFunc.get();
+
+    /* Number of the mini-batches of the full size that hold all the processed observations */
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = (int)((size_t(nObservationsTotal) + par->batchSize - 1) / par->batchSize);
+    return Status();
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
@@ -74,6 +74,33 @@ services::Status Parameter::check() const
 }
 
 } // namespace interface2
+
+namespace interface3
+{
+/**
+ *  Constructs parameters of the K-Means algorithm
+ *  \param[in] _nClusters   Number of clusters
+ *  \param[in] _maxIterations Number of iterations
+ */
+Parameter::Parameter(size_t _nClusters, size_t _maxIterations) : interface2::Parameter(_nClusters, _maxIterations), batchSize(1024) {}
+
+/**
+ *  Constructs parameters of the K-Means algorithm by copying another parameters of the K-Means algorithm
+ *  \param[in] other    Parameters of the K-Means algorithm
+ */
+Parameter::Parameter(const Parameter & other)
+    : interface2::Parameter(other), batchSize(other.batchSize), engine(other.engine ? other.engine->clone() : engines::EnginePtr())
+{}
+
+services::Status Parameter::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, interface2::Parameter::check());
+    DAAL_CHECK_EX(batchSize > 0, ErrorIncorrectParameter, ParameterName, batchSizeStr());
+    return s;
+}
+
+} // namespace interface3
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
@@ -26,6 +26,7 @@
 
 #include "algorithms/kmeans/kmeans_types.h"
 #include "src/algorithms/kmeans/inner/kmeans_types_v1.h"
+#include "src/algorithms/kmeans/kmeans_bounds.h"
 
 using namespace daal::data_management;
 
@@ -68,7 +69,8 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
 
     if (kmPar2)
     {
-        if ((kmPar2->resultsToEvaluate & computeAssignments || kmPar2->assignFlag) && step1Input)
+        /* Assignments are not computed in the online processing mode of the mini-batch method */
+        if ((kmPar2->resultsToEvaluate & computeAssignments || kmPar2->assignFlag) && step1Input && method != miniBatchDense)
         {
             const size_t nRows = step1Input->get(data)->getNumberOfRows();
             set(partialAssignments, HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status));
@@ -82,6 +84,20 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
             set(partialAssignments, HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status));
         }
     }
+    DAAL_CHECK_STATUS_VAR(status);
+
+    if (method == boundedLloydDense && step1Input)
+    {
+        /* Bounds are kept between the calls of the algorithm on the local node. Zero bounds filter out no observations */
+        const size_t nRows   = step1Input->get(data)->getNumberOfRows();
+        const size_t nGroups = internal::kmeansGetNumberOfBoundGroups(nClusters);
+        set(partialAssignments, HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, 0, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        set(partialLowerBounds, HomogenNumericTable<algorithmFPType>::create(nGroups, nRows, NumericTable::doAllocate, algorithmFPType(0), &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        set(partialBoundsCentroids,
+            HomogenNumericTable<algorithmFPType>::create(nFeatures, nClusters, NumericTable::doAllocate, algorithmFPType(0), &status));
+    }
 
     return status;
 }
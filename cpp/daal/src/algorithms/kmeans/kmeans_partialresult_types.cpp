@@ -23,6 +23,7 @@
 
 #include "algorithms/kmeans/kmeans_types.h"
 #include "src/algorithms/kmeans/inner/kmeans_types_v1.h"
+#include "src/algorithms/kmeans/kmeans_bounds.h"
 #include "services/daal_defines.h"
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
@@ -99,7 +100,7 @@ services::Status PartialResult::check(const daal::algorithms::Input * input, con
         s, checkNumericTable(get(partialCandidatesCentroids).get(), partialCandidatesCentroidsStr(), unexpectedLayouts, 0, inputFeatures, nClusters));
     if (kmPar2)
     {
-        if (kmPar2->resultsToEvaluate & computeAssignments || kmPar2->assignFlag)
+        if ((kmPar2->resultsToEvaluate & computeAssignments || kmPar2->assignFlag) && method != miniBatchDense)
         {
             Input * algInput = dynamic_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
             if (!algInput)
@@ -123,6 +124,22 @@ services::Status PartialResult::check(const daal::algorithms::Input * input, con
             s                  = checkNumericTable(get(partialAssignments).get(), partialAssignmentsStr(), unexpectedLayouts, 0, 1, nRows);
         }
     }
+    DAAL_CHECK_STATUS_VAR(s);
+
+    if (method == boundedLloydDense)
+    {
+        Input * algInput = dynamic_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+        if (!algInput)
+        {
+            return s;
+        }
+        const size_t nRows   = algInput->get(data)->getNumberOfRows();
+        const size_t nGroups = internal::kmeansGetNumberOfBoundGroups(nClusters);
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(partialAssignments).get(), partialAssignmentsStr(), unexpectedLayouts, 0, 1, nRows));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(partialLowerBounds).get(), partialLowerBoundsStr(), unexpectedLayouts, 0, nGroups, nRows));
+        DAAL_CHECK_STATUS(
+            s, checkNumericTable(get(partialBoundsCentroids).get(), partialBoundsCentroidsStr(), unexpectedLayouts, 0, inputFeatures, nClusters));
+    }
     return s;
 }
 
@@ -26,6 +26,7 @@
 
 #include "services/env_detect.h"
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
 #include "src/data_management/service_numeric_table.h"
 
 namespace daal
@@ -147,6 +148,17 @@ public:
      */
     Status update(DAAL_INT startRow, DAAL_INT nRows, const NumericTable & xTable, const NumericTable & yTable);
 
+    /**
+     * Updates local partial result with the new block of data stored in CSR format
+     * \param[in] startRow  Index of the starting row of the block
+     * \param[in] nRows     Number of rows in the block of data
+     * \param[in] nFeatures Number of features P in the input data set
+     * \param[in] xTable    Input data set of size N x P in CSR format
+     * \param[in] yTable    Input array of responses of size N x Ny
+     * \return Status of the computations
+     */
+    Status updateCSR(DAAL_INT startRow, DAAL_INT nRows, DAAL_INT nFeatures, CSRNumericTableIface & xTable, const NumericTable & yTable);
+
     /**
      * Reduces thread local partial results into global partial result
      * \param[out] xtx Global partial result of size P' x P'
@@ -133,6 +133,55 @@ Status ThreadingTask<algorithmFPType, cpu>::update(DAAL_INT startRow, DAAL_INT n
     return Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status ThreadingTask<algorithmFPType, cpu>::updateCSR(DAAL_INT startRow, DAAL_INT nRows, DAAL_INT nFeatures, CSRNumericTableIface & xTable,
+                                                      const NumericTable & yTable)
+{
+    ReadRowsCSR<algorithmFPType, cpu> xBlock(xTable, startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType * values = xBlock.values();
+    const size_t * colIndices      = xBlock.cols();
+    const size_t * rowOffsets      = xBlock.rows();
+
+    _yBlock.set(const_cast<NumericTable &>(yTable), startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(_yBlock);
+    const algorithmFPType * y = _yBlock.get();
+
+    const bool bIntercept          = (nFeatures < _nBetasIntercept);
+    algorithmFPType * xtxIntercept = _xtx + nFeatures * _nBetasIntercept;
+
+    /* The same triangle of X'^T*X' as in the dense case is accumulated from the sparse outer products of the observations,
+       so the cost of the update is proportional to the sum of the squared numbers of non-zeros in the rows */
+    for (DAAL_INT i = 0; i < nRows; i++)
+    {
+        const size_t iStart        = rowOffsets[i] - rowOffsets[0];
+        const size_t iEnd          = rowOffsets[i + 1] - rowOffsets[0];
+        const algorithmFPType * yi = y + i * _nResponses;
+        for (size_t j = iStart; j < iEnd; j++)
+        {
+            const size_t cj          = colIndices[j] - 1;
+            const algorithmFPType xj = values[j];
+            algorithmFPType * xtxRow = _xtx + cj * _nBetasIntercept;
+            for (size_t k = iStart; k < iEnd; k++)
+            {
+                const size_t ck = colIndices[k] - 1;
+                if (ck <= cj) xtxRow[ck] += xj * values[k];
+            }
+
+            for (DAAL_INT r = 0; r < _nResponses; r++) _xty[r * _nBetasIntercept + cj] += xj * yi[r];
+            if (bIntercept) xtxIntercept[cj] += xj;
+        }
+
+        if (bIntercept)
+        {
+            for (DAAL_INT r = 0; r < _nResponses; r++) _xty[r * _nBetasIntercept + nFeatures] += yi[r];
+        }
+    }
+
+    if (bIntercept) xtxIntercept[nFeatures] += algorithmFPType(nRows);
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ThreadingTask<algorithmFPType, cpu>::reduce(algorithmFPType * xtx, algorithmFPType * xty)
 {
@@ -199,6 +248,9 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
         nBlocks++;
     }
 
+    /* The data in CSR format is processed without conversion to the dense layout */
+    CSRNumericTableIface * const xCSR = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&xTable));
+
     /* Create TLS */
     daal::tls<ThreadingTaskType *> tls([=]() -> ThreadingTaskType * { return ThreadingTaskType::create(nBetasIntercept, nResponses); });
 
@@ -219,7 +271,8 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
             endRow = nRows;
         }
 
-        Status localSt = tlsLocal->update(startRow, endRow - startRow, xTable, yTable);
+        Status localSt = xCSR ? tlsLocal->updateCSR(startRow, endRow - startRow, nBetas - 1, *xCSR, yTable) :
+                                tlsLocal->update(startRow, endRow - startRow, xTable, yTable);
         DAAL_CHECK_STATUS_THR(localSt);
     });
 
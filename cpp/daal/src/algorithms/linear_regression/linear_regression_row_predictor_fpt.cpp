@@ -0,0 +1,145 @@
+/* file: linear_regression_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of linear regression prediction of a single observation.
+//--
+*/
+
+#include "algorithms/linear_regression/linear_regression_row_predictor.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace prediction
+{
+namespace interface1
+{
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::Impl
+{
+public:
+    Impl() : _nFeatures(0), _nResponses(0), _nBetas(0), _interceptFlag(false) {}
+
+    services::Status prepare(const linear_regression::ModelPtr & model)
+    {
+        DAAL_CHECK(model, services::ErrorNullModel);
+        data_management::NumericTablePtr beta = model->getBeta();
+        DAAL_CHECK(beta, services::ErrorModelNotFullInitialized);
+
+        const size_t nResponses = beta->getNumberOfRows();
+        const size_t nBetas     = beta->getNumberOfColumns();
+        DAAL_CHECK(nResponses && nBetas > 1, services::ErrorModelNotFullInitialized);
+
+        /* the coefficients are kept in the row-major layout of the table: the intercept followed by the coefficients of the features */
+        daal::internal::ReadRows<algorithmFPType, sse2> betaRows(beta.get(), 0, nResponses);
+        DAAL_CHECK_BLOCK_STATUS(betaRows);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses, nBetas);
+        _beta.reset(nResponses * nBetas);
+        DAAL_CHECK_MALLOC(_beta.get());
+        const algorithmFPType * const pBeta = betaRows.get();
+        for (size_t i = 0; i < nResponses * nBetas; ++i) _beta[i] = pBeta[i];
+
+        _nResponses    = nResponses;
+        _nBetas        = nBetas;
+        _nFeatures     = nBetas - 1;
+        _interceptFlag = model->getInterceptFlag();
+        return services::Status();
+    }
+
+    services::Status predict(const algorithmFPType * const x, algorithmFPType * const responses) const
+    {
+        for (size_t j = 0; j < _nResponses; ++j)
+        {
+            const algorithmFPType * const beta = _beta.get() + j * _nBetas;
+            algorithmFPType sum                = _interceptFlag ? beta[0] : algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < _nFeatures; ++i) sum += x[i] * beta[i + 1];
+            responses[j] = sum;
+        }
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+    size_t getNumberOfResponses() const { return _nResponses; }
+
+private:
+    services::internal::TArray<algorithmFPType, sse2> _beta;
+    size_t _nFeatures;
+    size_t _nResponses;
+    size_t _nBetas;
+    bool _interceptFlag;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor() : _impl(nullptr)
+{}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::prepare(const linear_regression::ModelPtr & model)
+{
+    delete _impl;
+    _impl = new Impl();
+    DAAL_CHECK_MALLOC(_impl);
+    const services::Status s = _impl->prepare(model);
+    if (!s)
+    {
+        delete _impl;
+        _impl = nullptr;
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::predict(const algorithmFPType * x, algorithmFPType * responses)
+{
+    DAAL_CHECK(_impl, services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, responses);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfResponses() const
+{
+    return _impl ? _impl->getNumberOfResponses() : 0;
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface1
+} // namespace prediction
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,165 @@
+/* file: logistic_regression_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logistic regression prediction of a single observation.
+//--
+*/
+
+#include "algorithms/logistic_regression/logistic_regression_row_predictor.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_utils.h"
+#include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
+#include "src/algorithms/objective_function/logistic_loss/logistic_loss_dense_default_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace prediction
+{
+namespace interface2
+{
+namespace ll  = daal::algorithms::optimization_solver::logistic_loss;
+namespace cel = daal::algorithms::optimization_solver::cross_entropy_loss;
+
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::Impl
+{
+public:
+    Impl() : _nFeatures(0), _nClasses(0) {}
+
+    services::Status prepare(const logistic_regression::ModelPtr & model, const classifier::Parameter & parameter)
+    {
+        DAAL_CHECK(model, services::ErrorNullModel);
+        DAAL_CHECK(parameter.nClasses > 1, services::ErrorIncorrectNumberOfClasses);
+        data_management::NumericTablePtr beta = model->getBeta();
+        DAAL_CHECK(beta, services::ErrorModelNotFullInitialized);
+
+        /* one row of the coefficients for the binary classification and one row per class otherwise */
+        const size_t nBetaRows = (parameter.nClasses == 2 ? 1 : parameter.nClasses);
+        const size_t nBetas    = beta->getNumberOfColumns();
+        DAAL_CHECK(beta->getNumberOfRows() >= nBetaRows && nBetas > 1, services::ErrorIncorrectNumberOfClasses);
+
+        daal::internal::ReadRows<algorithmFPType, sse2> betaRows(beta.get(), 0, nBetaRows);
+        DAAL_CHECK_BLOCK_STATUS(betaRows);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetaRows, nBetas);
+        _beta.reset(nBetaRows * nBetas);
+        _values.reset(parameter.nClasses);
+        DAAL_CHECK_MALLOC(_beta.get() && _values.get());
+        const algorithmFPType * const pBeta = betaRows.get();
+        for (size_t i = 0; i < nBetaRows * nBetas; ++i) _beta[i] = pBeta[i];
+
+        _nClasses  = parameter.nClasses;
+        _nFeatures = nBetas - 1;
+        return services::Status();
+    }
+
+    services::Status predict(const algorithmFPType * const x, algorithmFPType * const label, algorithmFPType * const probabilities)
+    {
+        if (_nClasses == 2)
+        {
+            algorithmFPType f = applyBeta(_beta.get(), x);
+
+            /* probability of the class 1 is sigmoid(f), hence sign(f) defines the label */
+            const algorithmFPType labels[2] = { algorithmFPType(1), algorithmFPType(0) };
+            if (label) *label = labels[services::internal::SignBit<algorithmFPType, sse2>::get(f)];
+            if (probabilities)
+            {
+                ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, sse2>::sigmoid(&f, probabilities + 1, 1);
+                probabilities[0] = algorithmFPType(1) - probabilities[1];
+            }
+            return services::Status();
+        }
+
+        algorithmFPType * const val = _values.get();
+        for (size_t j = 0; j < _nClasses; ++j) val[j] = applyBeta(_beta.get() + j * (_nFeatures + 1), x);
+
+        if (label) *label = algorithmFPType(services::internal::getMaxElementIndex<algorithmFPType, sse2>(val, _nClasses));
+        if (probabilities) cel::internal::CrossEntropyLossKernel<algorithmFPType, cel::defaultDense, sse2>::softmax(val, probabilities, 1, _nClasses);
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    /* beta[0] is the intercept, it is zero for the models trained without the intercept term */
+    algorithmFPType applyBeta(const algorithmFPType * const beta, const algorithmFPType * const x) const
+    {
+        algorithmFPType sum = beta[0];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < _nFeatures; ++i) sum += x[i] * beta[i + 1];
+        return sum;
+    }
+
+    services::internal::TArray<algorithmFPType, sse2> _beta;
+    services::internal::TArray<algorithmFPType, sse2> _values;
+    size_t _nFeatures;
+    size_t _nClasses;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor() : _impl(nullptr)
+{}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::prepare(const logistic_regression::ModelPtr & model, const classifier::Parameter & parameter)
+{
+    delete _impl;
+    _impl = new Impl();
+    DAAL_CHECK_MALLOC(_impl);
+    const services::Status s = _impl->prepare(model, parameter);
+    if (!s)
+    {
+        delete _impl;
+        _impl = nullptr;
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+services::Status RowPredictor<algorithmFPType>::predict(const algorithmFPType * x, algorithmFPType * label, algorithmFPType * probabilities)
+{
+    DAAL_CHECK(_impl, services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, label, probabilities);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface2
+} // namespace prediction
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
@@ -31,6 +31,7 @@
 #include "src/services/service_algo_utils.h"
 #include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
 #include "algorithms/optimization_solver/objective_function/cross_entropy_loss_batch.h"
+#include "algorithms/optimization_solver/saga/saga_types.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_math.h"
 #include "src/externals/service_ittnotify.h"
@@ -54,6 +55,32 @@ namespace internal
 //////////////////////////////////////////////////////////////////////////////////////////
 // TrainBatchKernel
 //////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, logistic_loss::Method objectiveMethod>
+static sum_of_functions::BatchPtr createLogLoss(const NumericTablePtr & x, const NumericTablePtr & y, const Parameter & par)
+{
+    services::SharedPtr<logistic_loss::Batch<algorithmFPType, objectiveMethod> > objFunc(
+        logistic_loss::Batch<algorithmFPType, objectiveMethod>::create(x->getNumberOfRows()));
+    objFunc->input.set(logistic_loss::data, x);
+    objFunc->input.set(logistic_loss::dependentVariables, y);
+    objFunc->parameter().interceptFlag = par.interceptFlag;
+    objFunc->parameter().penaltyL1     = par.penaltyL1;
+    objFunc->parameter().penaltyL2     = par.penaltyL2;
+    return objFunc;
+}
+
+template <typename algorithmFPType, cross_entropy_loss::Method objectiveMethod>
+static sum_of_functions::BatchPtr createCrossEntropyLoss(const NumericTablePtr & x, const NumericTablePtr & y, const Parameter & par)
+{
+    services::SharedPtr<cross_entropy_loss::Batch<algorithmFPType, objectiveMethod> > objFunc(
+        cross_entropy_loss::Batch<algorithmFPType, objectiveMethod>::create(par.nClasses, x->getNumberOfRows()));
+    objFunc->input.set(cross_entropy_loss::data, x);
+    objFunc->input.set(cross_entropy_loss::dependentVariables, y);
+    objFunc->parameter().interceptFlag = par.interceptFlag;
+    objFunc->parameter().penaltyL1     = par.penaltyL1;
+    objFunc->parameter().penaltyL2     = par.penaltyL2;
+    return objFunc;
+}
+
 template <typename algorithmFPType, logistic_regression::training::Method method, CpuType cpu>
 services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(const HostAppIfacePtr & pHost, const NumericTablePtr & x,
                                                                          const NumericTablePtr & y, logistic_regression::Model & m, Result & res,
@@ -63,27 +90,16 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(const H
     DAAL_ASSERT(p == m.getNumberOfBetas());
     services::SharedPtr<optimization_solver::iterative_solver::Batch> pSolver = par.optimizationSolver->clone();
     pSolver->setHostApp(pHost);
+    /* the data in CSR format is handled by the sparse methods of the objective functions, except for SAGA
+       that keeps a dense gradient of every term */
+    const bool bSaga = (dynamic_cast<const saga::Parameter *>(pSolver->getParameter()) != nullptr);
+    const bool bCSR  = !bSaga && (dynamic_cast<CSRNumericTableIface *>(x.get()) != nullptr);
     if (par.nClasses == 2)
-    {
-        services::SharedPtr<logistic_loss::Batch<algorithmFPType> > objFunc(logistic_loss::Batch<algorithmFPType>::create(x->getNumberOfRows()));
-        objFunc->input.set(logistic_loss::data, x);
-        objFunc->input.set(logistic_loss::dependentVariables, y);
-        objFunc->parameter().interceptFlag = par.interceptFlag;
-        objFunc->parameter().penaltyL1     = par.penaltyL1;
-        objFunc->parameter().penaltyL2     = par.penaltyL2;
-        pSolver->getParameter()->function  = objFunc;
-    }
+        pSolver->getParameter()->function = bCSR ? createLogLoss<algorithmFPType, logistic_loss::fastCSR>(x, y, par) :
+                                                   createLogLoss<algorithmFPType, logistic_loss::defaultDense>(x, y, par);
     else
-    {
-        services::SharedPtr<cross_entropy_loss::Batch<algorithmFPType> > objFunc(
-            cross_entropy_loss::Batch<algorithmFPType>::create(par.nClasses, x->getNumberOfRows()));
-        objFunc->input.set(cross_entropy_loss::data, x);
-        objFunc->input.set(cross_entropy_loss::dependentVariables, y);
-        objFunc->parameter().interceptFlag = par.interceptFlag;
-        objFunc->parameter().penaltyL1     = par.penaltyL1;
-        objFunc->parameter().penaltyL2     = par.penaltyL2;
-        pSolver->getParameter()->function  = objFunc;
-    }
+        pSolver->getParameter()->function = bCSR ? createCrossEntropyLoss<algorithmFPType, cross_entropy_loss::fastCSR>(x, y, par) :
+                                                   createCrossEntropyLoss<algorithmFPType, cross_entropy_loss::defaultDense>(x, y, par);
 
     const size_t nBetaRows  = m.getBeta()->getNumberOfRows();
     const size_t nBetaTotal = p * nBetaRows;
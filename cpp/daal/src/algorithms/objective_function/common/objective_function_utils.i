@@ -54,6 +54,135 @@ services::Status getXY(NumericTable * dataNT, NumericTable * dependentVariablesN
     return services::Status();
 }
 
+/* Rows of the data in CSR format selected by the batch indices and the corresponding dependent variables.
+   Column indices and row offsets are one-based as in CSRNumericTable, the rows are copied only when the batch is a subset of the data */
+template <typename algorithmFPType, CpuType cpu>
+class CSRBatch
+{
+public:
+    CSRBatch() : _values(nullptr), _colIndices(nullptr), _rowOffsets(nullptr), _y(nullptr), _n(0) {}
+
+    services::Status init(NumericTable * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(getXY);
+
+        CSRNumericTableIface * csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+        DAAL_CHECK(csrData, services::ErrorIncorrectTypeOfInputNumericTable);
+
+        if (!indNT)
+        {
+            const size_t nRows = dataNT->getNumberOfRows();
+            _dataRows.set(csrData, 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(_dataRows);
+            _yRows.set(dependentVariablesNT, 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(_yRows);
+
+            _values     = _dataRows.values();
+            _colIndices = _dataRows.cols();
+            _rowOffsets = _dataRows.rows();
+            _y          = _yRows.get();
+            _n          = nRows;
+            return services::Status();
+        }
+
+        const size_t n = indNT->getNumberOfColumns();
+        ReadRows<int, cpu> rInd(*const_cast<NumericTable *>(indNT), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(rInd);
+        const int * const ind = rInd.get();
+
+        _aRowOffsets.reset(n + 1);
+        _aY.reset(n);
+        DAAL_CHECK_MALLOC(_aRowOffsets.get() && _aY.get());
+
+        /* Only the selected rows are fetched from the table: the first pass counts their non-zero values, the second one copies them */
+        ReadRowsCSR<algorithmFPType, cpu> csrRow(csrData);
+        ReadRows<algorithmFPType, cpu> yRow(*dependentVariablesNT);
+        _aRowOffsets[0] = 1;
+        for (size_t i = 0; i < n; ++i)
+        {
+            csrRow.next(ind[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(csrRow);
+            yRow.next(ind[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(yRow);
+            _aRowOffsets[i + 1] = _aRowOffsets[i] + csrRow.rows()[1] - csrRow.rows()[0];
+            _aY[i]              = yRow.get()[0];
+        }
+
+        const size_t nNonZeros = _aRowOffsets[n] - 1;
+        _aValues.reset(nNonZeros);
+        _aColIndices.reset(nNonZeros);
+        DAAL_CHECK_MALLOC((_aValues.get() && _aColIndices.get()) || !nNonZeros);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            csrRow.next(ind[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(csrRow);
+            const size_t iDst                       = _aRowOffsets[i] - 1;
+            const size_t nInRow                     = _aRowOffsets[i + 1] - _aRowOffsets[i];
+            const algorithmFPType * const rowValues = csrRow.values();
+            const size_t * const rowCols            = csrRow.cols();
+            for (size_t j = 0; j < nInRow; ++j)
+            {
+                _aValues[iDst + j]     = rowValues[j];
+                _aColIndices[iDst + j] = rowCols[j];
+            }
+        }
+
+        _values     = _aValues.get();
+        _colIndices = _aColIndices.get();
+        _rowOffsets = _aRowOffsets.get();
+        _y          = _aY.get();
+        _n          = n;
+        return services::Status();
+    }
+
+    const algorithmFPType * values() const { return _values; }
+    const size_t * colIndices() const { return _colIndices; }
+    const size_t * rowOffsets() const { return _rowOffsets; }
+    const algorithmFPType * y() const { return _y; }
+    size_t size() const { return _n; }
+
+private:
+    ReadRowsCSR<algorithmFPType, cpu> _dataRows;
+    ReadRows<algorithmFPType, cpu> _yRows;
+    TArrayScalable<algorithmFPType, cpu> _aValues;
+    TArrayScalable<size_t, cpu> _aColIndices;
+    TArrayScalable<size_t, cpu> _aRowOffsets;
+    TArrayScalable<algorithmFPType, cpu> _aY;
+    const algorithmFPType * _values;
+    const size_t * _colIndices;
+    const size_t * _rowOffsets;
+    const algorithmFPType * _y;
+    size_t _n;
+};
+
+/* Maximal squared norm of the rows of the data in CSR format */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType maxSquaredRowNormCSR(const algorithmFPType * values, const size_t * rowOffsets, size_t n)
+{
+    const size_t blockSize = 256;
+    size_t nBlocks         = n / blockSize;
+    nBlocks += (nBlocks * blockSize != n);
+
+    TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(1);
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        algorithmFPType & maxNorm = *tlsData.local();
+        const size_t startRow     = iBlock * blockSize;
+        const size_t finishRow    = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+        for (size_t i = startRow; i < finishRow; i++)
+        {
+            algorithmFPType norm = 0;
+            for (size_t j = rowOffsets[i] - 1; j < rowOffsets[i + 1] - 1; j++) norm += values[j] * values[j];
+            if (norm > maxNorm) maxNorm = norm;
+        }
+    });
+    algorithmFPType globalMaxNorm = 0;
+    tlsData.reduce([&](algorithmFPType * maxNorm) {
+        if (globalMaxNorm < *maxNorm) globalMaxNorm = *maxNorm;
+    });
+    return globalMaxNorm;
+}
+
 } // namespace internal
 
 } // namespace objective_function
@@ -0,0 +1,49 @@
+/* file: cross_entropy_loss_csr_default_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of cross-entropy loss calculation functions for the data in CSR format.
+//--
+
+#include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
+#include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_csr_default_batch_impl.i"
+#include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace cross_entropy_loss
+{
+namespace interface2
+{
+template class BatchContainer<DAAL_FPTYPE, fastCSR, DAAL_CPU>;
+}
+namespace internal
+{
+template class CrossEntropyLossKernel<DAAL_FPTYPE, fastCSR, DAAL_CPU>;
+}
+
+} // namespace cross_entropy_loss
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,288 @@
+/* file: cross_entropy_loss_csr_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of cross-entropy loss algorithm for the data in CSR format
+//--
+*/
+#include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_impl.i"
+#include "src/externals/service_spblas.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace cross_entropy_loss
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// Cross entropy loss function for the data in CSR format. The products X*B and X^T*(P - Y)
+// are computed by sparse BLAS on the column-major matrices of size n x nClasses,
+// the Hessian is accumulated from the sparse outer products of the observations
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+static void csrmm(char transa, const algorithmFPType * values, const size_t * colIndices, const size_t * rowOffsets, size_t nRows, size_t nCols,
+                  size_t nClasses, const algorithmFPType * b, size_t ldb, algorithmFPType * c, size_t ldc)
+{
+    const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT m           = (DAAL_INT)nRows;
+    const DAAL_INT n           = (DAAL_INT)nClasses;
+    const DAAL_INT k           = (DAAL_INT)nCols;
+    const DAAL_INT ldB         = (DAAL_INT)ldb;
+    const DAAL_INT ldC         = (DAAL_INT)ldc;
+    SpBlas<algorithmFPType, cpu>::xcsrmm(&transa, &m, &n, &k, &one, matdescra, values, (const DAAL_INT *)colIndices, (const DAAL_INT *)rowOffsets, b,
+                                         &ldB, &zero, c, &ldC);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, fastCSR, cpu>::doCompute(
+    const algorithmFPType * values, const size_t * colIndices, const size_t * rowOffsets, const algorithmFPType * y, size_t n, size_t p,
+    NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+    NumericTable * proximalProjection, NumericTable * lipschitzConstant, Parameter * parameter)
+{
+    typedef CrossEntropyLossKernel<algorithmFPType, defaultDense, cpu> DenseKernel;
+
+    services::Status st;
+    const size_t nClasses      = parameter->nClasses;
+    const size_t nBetaPerClass = p + 1;
+    const size_t nBeta         = nClasses * nBetaPerClass;
+    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
+
+    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(betar);
+    const algorithmFPType * b = betar.get();
+
+    if (proximalProjection)
+    {
+        st = computeProximalProjection<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, proximalProjection, parameter);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    algorithmFPType notSmoothTerm = 0;
+    if (nonSmoothTermValue)
+    {
+        st = computeNonSmoothTerm<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, nonSmoothTermValue, parameter, notSmoothTerm);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    if (lipschitzConstant)
+    {
+        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+        const algorithmFPType maxNorm = objective_function::internal::maxSquaredRowNormCSR<algorithmFPType, cpu>(values, rowOffsets, n);
+        *lipschitzConstantPtr.get()   = lipschitzConstantByMaxNorm<algorithmFPType, cpu>(maxNorm, n, parameter);
+    }
+
+    if (!valueNT && !gradientNT && !hessianNT) return st;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
+    TArrayScalable<algorithmFPType, cpu> f(n * nClasses);
+    TArrayScalable<algorithmFPType, cpu> fT(n * nClasses);
+    DAAL_CHECK_MALLOC(f.get() && fT.get());
+    algorithmFPType * const pf  = f.get();
+    algorithmFPType * const pfT = fT.get();
+
+    //fT = X*B in the column-major layout, f = fT^T + b0
+    csrmm<algorithmFPType, cpu>('N', values, colIndices, rowOffsets, n, p, nClasses, b + 1, nBetaPerClass, pfT, n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t k = 0; k < nClasses; ++k)
+            pf[i * nClasses + k] = pfT[k * n + i] + (parameter->interceptFlag ? b[k * nBetaPerClass] : algorithmFPType(0));
+    }
+
+    //f = softmax(f)
+    DenseKernel::softmaxThreaded(pf, pf, n, nClasses);
+
+    const bool bL1            = (parameter->penaltyL1 > 0);
+    const bool bL2            = (parameter->penaltyL2 > 0);
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+
+    if (valueNT)
+    {
+        TArrayScalable<algorithmFPType, cpu> logP(n * nClasses);
+        DAAL_CHECK_MALLOC(logP.get());
+        daal::internal::Math<algorithmFPType, cpu>::vLog(n * nClasses, pf, logP.get());
+
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value    = *vr.get();
+        value                      = 0.0;
+        const algorithmFPType * lp = logP.get();
+        for (size_t i = 0; i < n; ++i) value += lp[i * nClasses + size_t(y[i])];
+
+        value *= -div;
+
+        if (bL2)
+        {
+            for (size_t i = 0; i < nClasses; i++)
+            {
+                for (size_t j = 1; j < nBetaPerClass; j++) value += b[i * nBetaPerClass + j] * b[i * nBetaPerClass + j] * parameter->penaltyL2;
+            }
+        }
+
+        if (bL1)
+        {
+            if (nonSmoothTermValue)
+            {
+                value += notSmoothTerm;
+            }
+            else
+            {
+                for (size_t i = 0; i < nClasses; i++)
+                {
+                    for (size_t j = 1; j < nBetaPerClass; j++)
+                        value += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
+                }
+            }
+        }
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * g = gr.get();
+
+        /* residuals P - Y in the column-major layout replace fT that is not needed anymore */
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t k = 0; k < nClasses; ++k) pfT[k * n + i] = pf[i * nClasses + k] - algorithmFPType(size_t(y[i]) == k);
+        }
+
+        //g = X^T*(P - Y), the intercepts are not touched by the product
+        csrmm<algorithmFPType, cpu>('T', values, colIndices, rowOffsets, n, p, nClasses, pfT, n, g + 1, nBetaPerClass);
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            algorithmFPType sum = 0;
+            if (parameter->interceptFlag)
+            {
+                for (size_t i = 0; i < n; ++i) sum += pfT[k * n + i];
+            }
+            g[k * nBetaPerClass] = sum;
+        }
+
+        for (size_t i = 0; i < nBeta; ++i) g[i] *= div;
+
+        if (bL2)
+        {
+            for (size_t i = 0; i < nClasses; i++)
+            {
+                for (size_t j = 1; j < nBetaPerClass; j++) g[i * nBetaPerClass + j] += 2 * b[i * nBetaPerClass + j] * parameter->penaltyL2;
+            }
+        }
+    }
+
+    if (hessianNT)
+    {
+        DAAL_ASSERT(hessianNT->getNumberOfColumns() == nBeta);
+        DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        algorithmFPType * h = hr.get();
+        daal::services::internal::service_memset<algorithmFPType, cpu>(h, algorithmFPType(0), nBeta * nBeta);
+
+        /* the upper triangle is accumulated from the non-zeros of every observation extended by the intercept term,
+           h[(k, a), (m, c)] += p_k * (I(k == m) - p_m) * x_a * x_c */
+        const size_t nExtra = (parameter->interceptFlag ? 1 : 0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType * pi = pf + i * nClasses;
+            const size_t iStart        = rowOffsets[i] - 1;
+            const size_t nInRow        = rowOffsets[i + 1] - rowOffsets[i] + nExtra;
+            for (size_t ta = 0; ta < nInRow; ++ta)
+            {
+                const size_t a           = (ta < nExtra ? 0 : colIndices[iStart + ta - nExtra]);
+                const algorithmFPType xa = (ta < nExtra ? algorithmFPType(1) : values[iStart + ta - nExtra]);
+                for (size_t tc = 0; tc < nInRow; ++tc)
+                {
+                    const size_t c           = (tc < nExtra ? 0 : colIndices[iStart + tc - nExtra]);
+                    const algorithmFPType xc = (tc < nExtra ? algorithmFPType(1) : values[iStart + tc - nExtra]);
+                    for (size_t k = 0; k < nClasses; ++k)
+                    {
+                        const algorithmFPType pxx = pi[k] * xa * xc;
+                        for (size_t m = k; m < nClasses; ++m)
+                        {
+                            if (m == k && c < a) continue;
+                            h[(k * nBetaPerClass + a) * nBeta + m * nBetaPerClass + c] += pxx * (algorithmFPType(m == k) - pi[m]);
+                        }
+                    }
+                }
+            }
+        }
+
+        //hessian is a symmetrical matrix
+        for (size_t i = 0; i < nBeta; ++i)
+        {
+            h[i * nBeta + i] *= div;
+            for (size_t j = i + 1; j < nBeta; ++j)
+            {
+                h[i * nBeta + j] *= div;
+                h[j * nBeta + i] = h[i * nBeta + j];
+            }
+        }
+
+        if (bL2)
+        {
+            for (size_t i = 0; i < nBeta; i++)
+            {
+                const algorithmFPType regularValue = 2 * parameter->penaltyL2;
+                h[i * nBeta + i] += (i % nBetaPerClass) ? regularValue : 0;
+            }
+        }
+    }
+    return st;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, fastCSR, cpu>::compute(NumericTable * dataNT, NumericTable * dependentVariablesNT,
+                                                                                NumericTable * betaNT, NumericTable * valueNT,
+                                                                                NumericTable * hessianNT, NumericTable * gradientNT,
+                                                                                NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
+                                                                                NumericTable * lipschitzConstant, Parameter * parameter)
+{
+    const size_t nRows                                = dataNT->getNumberOfRows();
+    const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
+    if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
+
+    objective_function::internal::CSRBatch<algorithmFPType, cpu> batch;
+    services::Status s = batch.init(dataNT, dependentVariablesNT, ntInd);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    return doCompute(batch.values(), batch.colIndices(), batch.rowOffsets(), batch.y(), batch.size(), dataNT->getNumberOfColumns(), betaNT, valueNT,
+                     hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+}
+
+} // namespace internal
+
+} // namespace cross_entropy_loss
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
@@ -122,6 +122,68 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, fastCSR, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::CrossEntropyLossKernel, algorithmFPType, fastCSR);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, fastCSR, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, fastCSR, cpu>::compute()
+{
+    Input * input                          = static_cast<Input *>(_in);
+    objective_function::Result * result    = static_cast<objective_function::Result *>(_res);
+    Parameter * parameter                  = static_cast<Parameter *>(_par);
+    daal::services::Environment::env & env = *_env;
+    NumericTable * value                   = nullptr;
+    NumericTable * hessian                 = nullptr;
+    NumericTable * gradient                = nullptr;
+    NumericTable * nonSmoothTermValue      = nullptr;
+    NumericTable * proximalProjection      = nullptr;
+    NumericTable * lipschitzConstant       = nullptr;
+
+    if (parameter->resultsToCompute & objective_function::value)
+    {
+        value = result->get(objective_function::valueIdx).get();
+    }
+
+    if (parameter->resultsToCompute & objective_function::hessian)
+    {
+        hessian = result->get(objective_function::hessianIdx).get();
+    }
+
+    if (parameter->resultsToCompute & objective_function::gradient)
+    {
+        gradient = result->get(objective_function::gradientIdx).get();
+    }
+
+    if (parameter->resultsToCompute & objective_function::nonSmoothTermValue)
+    {
+        nonSmoothTermValue = result->get(objective_function::nonSmoothTermValueIdx).get();
+    }
+
+    if (parameter->resultsToCompute & objective_function::proximalProjection)
+    {
+        proximalProjection = result->get(objective_function::proximalProjectionIdx).get();
+    }
+
+    if (parameter->resultsToCompute & objective_function::lipschitzConstant)
+    {
+        lipschitzConstant = result->get(objective_function::lipschitzConstantIdx).get();
+    }
+
+    __DAAL_CALL_KERNEL(env, internal::CrossEntropyLossKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, fastCSR), compute,
+                       input->get(cross_entropy_loss::data).get(), input->get(cross_entropy_loss::dependentVariables).get(),
+                       input->get(cross_entropy_loss::argument).get(), value, hessian, gradient, nonSmoothTermValue, proximalProjection,
+                       lipschitzConstant, parameter);
+}
+
 } // namespace interface2
 } // namespace cross_entropy_loss
 } // namespace optimization_solver
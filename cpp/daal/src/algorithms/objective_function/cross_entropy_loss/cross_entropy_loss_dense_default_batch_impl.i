@@ -178,6 +178,62 @@ void addHessInPt(algorithmFPType * h, const algorithmFPType * xi, const algorith
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeProximalProjection(const algorithmFPType * b, size_t nClasses, size_t nBetaPerClass, NumericTable * proximalProjection,
+                                                  const Parameter * parameter)
+{
+    WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nClasses * nBetaPerClass);
+    DAAL_CHECK_BLOCK_STATUS(proxPtr);
+    algorithmFPType * prox = proxPtr.get();
+
+    for (size_t i = 0; i < nClasses; i++) prox[i * nBetaPerClass] = b[i * nBetaPerClass];
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        for (size_t j = 1; j < nBetaPerClass; j++)
+        {
+            if (b[i * nBetaPerClass + j] > parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - parameter->penaltyL1;
+            }
+            if (b[i * nBetaPerClass + j] < -parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + parameter->penaltyL1;
+            }
+            if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i * nBetaPerClass + j]) <= parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = 0;
+            }
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerm(const algorithmFPType * b, size_t nClasses, size_t nBetaPerClass, NumericTable * nonSmoothTermValue,
+                                             const Parameter * parameter, algorithmFPType & notSmoothTerm)
+{
+    WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType & value = *vr.get();
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        for (size_t j = 1; j < nBetaPerClass; j++)
+            notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
+    }
+    value = notSmoothTerm;
+    return services::Status();
+}
+
+/* Lipschitz constant of the gradient given the maximal squared norm of the observations */
+template <typename algorithmFPType, CpuType cpu>
+static algorithmFPType lipschitzConstantByMaxNorm(algorithmFPType globalMaxNorm, size_t n, const Parameter * parameter)
+{
+    algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
+    algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+    algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
+    return 2 * lipschitz + displacement;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t nRows,
                                                                                  size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
@@ -199,45 +255,18 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     DAAL_CHECK_BLOCK_STATUS(betar);
     const algorithmFPType * b = betar.get();
 
+    services::Status st;
     if (proximalProjection)
     {
-        WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nBeta);
-        DAAL_CHECK_BLOCK_STATUS(proxPtr);
-        algorithmFPType * prox = proxPtr.get();
-
-        for (size_t i = 0; i < nClasses; i++) prox[i * nBetaPerClass] = b[i * nBetaPerClass];
-        for (size_t i = 0; i < nClasses; i++)
-        {
-            for (size_t j = 1; j < nBetaPerClass; j++)
-            {
-                if (b[i * nBetaPerClass + j] > parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - parameter->penaltyL1;
-                }
-                if (b[i * nBetaPerClass + j] < -parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + parameter->penaltyL1;
-                }
-                if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i * nBetaPerClass + j]) <= parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = 0;
-                }
-            }
-        }
+        st = computeProximalProjection<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, proximalProjection, parameter);
+        DAAL_CHECK_STATUS_VAR(st);
     }
 
     algorithmFPType notSmoothTerm = 0;
     if (nonSmoothTermValue)
     {
-        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(vr);
-        algorithmFPType & value = *vr.get();
-        for (size_t i = 0; i < nClasses; i++)
-        {
-            for (size_t j = 1; j < nBetaPerClass; j++)
-                notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
-        }
-        value = notSmoothTerm;
+        st = computeNonSmoothTerm<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, nonSmoothTermValue, parameter, notSmoothTerm);
+        DAAL_CHECK_STATUS_VAR(st);
     }
 
     if (lipschitzConstant)
@@ -280,10 +309,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             }
         });
 
-        algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
-        algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
-        algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
-        c                            = 2 * lipschitz + displacement;
+        c = lipschitzConstantByMaxNorm<algorithmFPType, cpu>(globalMaxNorm, n, parameter);
     }
 
     if (valueNT || gradientNT || hessianNT)
@@ -415,7 +441,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             }
         }
     }
-    return services::Status();
+    return st;
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -64,6 +64,22 @@ protected:
                                NumericTable * proximalProjection, NumericTable * lipschitzConstant, Parameter * parameter);
 };
 
+/* Cross-entropy loss for the data in CSR format, column indices and row offsets of the data are one-based */
+template <typename algorithmFPType, CpuType cpu>
+class CrossEntropyLossKernel<algorithmFPType, fastCSR, cpu> : public Kernel
+{
+public:
+    services::Status compute(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
+                             NumericTable * hessian, NumericTable * gradient, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
+                             NumericTable * lipschitzConstant, Parameter * parameter);
+
+protected:
+    services::Status doCompute(const algorithmFPType * values, const size_t * colIndices, const size_t * rowOffsets, const algorithmFPType * y,
+                               size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT,
+                               NumericTable * nonSmoothTermValue, NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                               Parameter * parameter);
+};
+
 } // namespace internal
 
 } // namespace cross_entropy_loss
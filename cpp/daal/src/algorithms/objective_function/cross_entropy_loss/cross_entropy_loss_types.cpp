@@ -112,7 +112,8 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     sum_of_functions::Input::check(par, method);
     DAAL_CHECK(Argument::size() == 3, services::ErrorIncorrectNumberOfInputNumericTables);
 
-    services::Status s = checkNumericTable(get(data).get(), dataStr(), 0, 0);
+    const int expectedLayouts = (method == fastCSR ? (int)NumericTableIface::csrArray : 0);
+    services::Status s        = checkNumericTable(get(data).get(), dataStr(), 0, expectedLayouts);
     if (!s) return s;
 
     const size_t nColsInData = get(data)->getNumberOfColumns();
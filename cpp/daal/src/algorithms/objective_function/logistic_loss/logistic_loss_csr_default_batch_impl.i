@@ -0,0 +1,262 @@
+/* file: logistic_loss_csr_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logloss algorithm for the data in CSR format
+//--
+*/
+#include "src/algorithms/objective_function/logistic_loss/logistic_loss_dense_default_batch_impl.i"
+#include "src/externals/service_spblas.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace logistic_loss
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// Logistic loss function for the data in CSR format. The products X*b and X^T*(sigmoid(f) - y)
+// are computed by sparse BLAS, the Hessian is accumulated from the sparse outer products
+// of the observations, so the cost of all the results is proportional to the number of non-zeros
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+static void applyBetaCSR(const algorithmFPType * values, const size_t * colIndices, const size_t * rowOffsets, const algorithmFPType * beta,
+                         algorithmFPType * xb, size_t nRows, size_t nCols, bool bIntercept)
+{
+    const char transa          = 'N';
+    const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT m           = (DAAL_INT)nRows;
+    const DAAL_INT k           = (DAAL_INT)nCols;
+    SpBlas<algorithmFPType, cpu>::xcsrmv(&transa, &m, &k, &one, matdescra, values, (const DAAL_INT *)colIndices, (const DAAL_INT *)rowOffsets,
+                                         (const DAAL_INT *)(rowOffsets + 1), beta + 1, &zero, xb);
+    if (bIntercept)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; ++i) xb[i] += beta[0];
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, fastCSR, cpu>::doCompute(const algorithmFPType * values, const size_t * colIndices,
+                                                                         const size_t * rowOffsets, const algorithmFPType * y, size_t n, size_t p,
+                                                                         NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
+                                                                         NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                                                         NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                         Parameter * parameter)
+{
+    services::Status st;
+    const size_t nBeta = p + 1;
+    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
+
+    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(betar);
+    const algorithmFPType * b = betar.get();
+
+    if (proximalProjection)
+    {
+        st = computeProximalProjection<algorithmFPType, cpu>(b, nBeta, proximalProjection, parameter);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    if (lipschitzConstant)
+    {
+        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+        const algorithmFPType maxNorm = objective_function::internal::maxSquaredRowNormCSR<algorithmFPType, cpu>(values, rowOffsets, n);
+        *lipschitzConstantPtr.get()   = lipschitzConstantByMaxNorm<algorithmFPType, cpu>(maxNorm, n, parameter);
+    }
+
+    algorithmFPType nonSmoothTerm = 0;
+    if (nonSmoothTermValue)
+    {
+        st = computeNonSmoothTerm<algorithmFPType, cpu>(b, nBeta, nonSmoothTermValue, parameter, nonSmoothTerm);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    if (!valueNT && !gradientNT && !hessianNT) return st;
+
+    TArrayScalable<algorithmFPType, cpu> f(n);
+    TArrayScalable<algorithmFPType, cpu> sg(2 * n);
+    DAAL_CHECK_MALLOC(f.get() && sg.get());
+
+    //f = X*b + b0
+    applyBetaCSR<algorithmFPType, cpu>(values, colIndices, rowOffsets, b, f.get(), n, p, parameter->interceptFlag);
+
+    //s = sigm(f), s1 = 1 - s
+    algorithmFPType * const s = sg.get();
+    vexp<algorithmFPType, cpu>(f.get(), s, n);
+    sigmoids<algorithmFPType, cpu>(s, n);
+
+    const bool bL1            = (parameter->penaltyL1 > 0);
+    const bool bL2            = (parameter->penaltyL2 > 0);
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+
+    if (valueNT)
+    {
+        TArrayScalable<algorithmFPType, cpu> logS(2 * n);
+        DAAL_CHECK_MALLOC(logS.get());
+        daal::internal::Math<algorithmFPType, cpu>::vLog(2 * n, s, logS.get());
+
+        const algorithmFPType * ls  = logS.get();
+        const algorithmFPType * ls1 = ls + n;
+
+        WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        algorithmFPType & value = *vr.get();
+        value                   = 0.0;
+        for (size_t i = 0; i < n; ++i) value += y[i] * ls[i] + (algorithmFPType(1) - y[i]) * ls1[i];
+
+        value *= -div;
+        if (bL2)
+        {
+            for (size_t i = 1; i < nBeta; ++i) value += b[i] * b[i] * parameter->penaltyL2;
+        }
+
+        if (bL1)
+        {
+            if (nonSmoothTermValue)
+            {
+                value += nonSmoothTerm;
+            }
+            else
+            {
+                for (size_t i = 1; i < nBeta; ++i) value += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
+            }
+        }
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * g = gr.get();
+
+        /* residuals sigm(f) - y replace f that is not needed anymore */
+        algorithmFPType * const d = f.get();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i) d[i] = s[i] - y[i];
+
+        //g = X^T*d
+        const char trans           = 'T';
+        const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        const DAAL_INT m           = (DAAL_INT)n;
+        const DAAL_INT k           = (DAAL_INT)p;
+        SpBlas<algorithmFPType, cpu>::xcsrmv(&trans, &m, &k, &one, matdescra, values, (const DAAL_INT *)colIndices, (const DAAL_INT *)rowOffsets,
+                                             (const DAAL_INT *)(rowOffsets + 1), d, &zero, g + 1);
+
+        g[0] = 0;
+        if (parameter->interceptFlag)
+        {
+            for (size_t i = 0; i < n; ++i) g[0] += d[i];
+        }
+        for (size_t i = 0; i < nBeta; ++i) g[i] *= div;
+
+        if (bL2)
+        {
+            for (size_t i = 1; i < nBeta; ++i) g[i] += 2. * b[i] * parameter->penaltyL2;
+        }
+    }
+
+    if (hessianNT)
+    {
+        DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        algorithmFPType * h = hr.get();
+        daal::services::internal::service_memset<algorithmFPType, cpu>(h, algorithmFPType(0), nBeta * nBeta);
+
+        /* the upper triangle is accumulated from the non-zeros of every observation, one-based column indices are the indices of beta */
+        for (size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType si = s[i] * s[i + n]; //sigmoid derivative at x[i]
+            const size_t iStart      = rowOffsets[i] - 1;
+            const size_t iEnd        = rowOffsets[i + 1] - 1;
+            if (parameter->interceptFlag)
+            {
+                h[0] += si;
+                for (size_t j = iStart; j < iEnd; ++j) h[colIndices[j]] += si * values[j];
+            }
+            for (size_t j = iStart; j < iEnd; ++j)
+            {
+                const size_t cj            = colIndices[j];
+                const algorithmFPType sixj = si * values[j];
+                for (size_t k = iStart; k < iEnd; ++k)
+                {
+                    if (colIndices[k] >= cj) h[cj * nBeta + colIndices[k]] += sixj * values[k];
+                }
+            }
+        }
+
+        //hessian is a symmetrical matrix
+        for (size_t j = 0; j < nBeta; ++j)
+        {
+            h[j * nBeta + j] *= div;
+            for (size_t k = j + 1; k < nBeta; ++k)
+            {
+                h[j * nBeta + k] *= div;
+                h[k * nBeta + j] = h[j * nBeta + k];
+            }
+        }
+        for (size_t j = 1; j < nBeta; ++j) h[j * nBeta + j] += 2. * parameter->penaltyL2;
+    }
+    return st;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, fastCSR, cpu>::compute(NumericTable * dataNT, NumericTable * dependentVariablesNT,
+                                                                       NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
+                                                                       NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                                                       NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                       Parameter * parameter)
+{
+    const size_t nRows                                = dataNT->getNumberOfRows();
+    const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
+    if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
+
+    objective_function::internal::CSRBatch<algorithmFPType, cpu> batch;
+    services::Status s = batch.init(dataNT, dependentVariablesNT, ntInd);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    return doCompute(batch.values(), batch.colIndices(), batch.rowOffsets(), batch.y(), batch.size(), dataNT->getNumberOfColumns(), betaNT, valueNT,
+                     hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+}
+
+} // namespace internal
+
+} // namespace logistic_loss
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
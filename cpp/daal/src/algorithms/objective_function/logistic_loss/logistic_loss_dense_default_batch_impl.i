@@ -124,6 +124,74 @@ void LogLossKernel<algorithmFPType, method, cpu>::sigmoid(const algorithmFPType
     for (size_t i = 0; i < n; ++i) s[i] = algorithmFPType(1.0) / (algorithmFPType(1.0) + s[i]);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeProximalProjection(const algorithmFPType * b, size_t nBeta, NumericTable * proximalProjection,
+                                                  const Parameter * parameter)
+{
+    DAAL_ASSERT(proximalProjection->getNumberOfRows() == nBeta);
+    algorithmFPType * prox;
+
+    HomogenNumericTable<algorithmFPType> * hmgProx = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(proximalProjection);
+    WriteRows<algorithmFPType, cpu> pr;
+    if (hmgProx)
+    {
+        prox = hmgProx->getArray();
+    }
+    else
+    {
+        pr.set(proximalProjection, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(pr);
+        prox = pr.get();
+    }
+
+    prox[0] = b[0];
+    for (size_t i = 1; i < nBeta; i++)
+    {
+        if (b[i] > parameter->penaltyL1)
+        {
+            prox[i] = b[i] - parameter->penaltyL1;
+        }
+        if (b[i] < -parameter->penaltyL1)
+        {
+            prox[i] = b[i] + parameter->penaltyL1;
+        }
+        if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i]) <= parameter->penaltyL1)
+        {
+            prox[i] = 0;
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerm(const algorithmFPType * b, size_t nBeta, NumericTable * nonSmoothTermValue, const Parameter * parameter,
+                                             algorithmFPType & nonSmoothTerm)
+{
+    WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType & v = *vr.get();
+
+    if ((parameter->penaltyL1 > 0))
+    {
+        for (size_t i = 1; i < nBeta; ++i)
+        {
+            nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
+        }
+    }
+    v = nonSmoothTerm;
+    return services::Status();
+}
+
+/* Lipschitz constant of the gradient given the maximal squared norm of the observations */
+template <typename algorithmFPType, CpuType cpu>
+static algorithmFPType lipschitzConstantByMaxNorm(algorithmFPType globalMaxNorm, size_t n, const Parameter * parameter)
+{
+    algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
+    algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+    algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
+    return 2 * lipschitz + displacement;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p,
                                                                         NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
@@ -131,6 +199,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
                                                                         NumericTable * proximalProjection, NumericTable * lipschitzConstant,
                                                                         Parameter * parameter)
 {
+    services::Status st;
     const size_t nBeta = p + 1;
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
@@ -152,38 +221,8 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
 
     if (proximalProjection)
     {
-        DAAL_ASSERT(proximalProjection->getNumberOfRows() == nBeta);
-        algorithmFPType * prox;
-
-        HomogenNumericTable<algorithmFPType> * hmgProx = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(proximalProjection);
-        WriteRows<algorithmFPType, cpu> pr;
-        if (hmgProx)
-        {
-            prox = hmgProx->getArray();
-        }
-        else
-        {
-            pr.set(proximalProjection, 0, nBeta);
-            DAAL_CHECK_BLOCK_STATUS(pr);
-            prox = pr.get();
-        }
-
-        prox[0] = b[0];
-        for (size_t i = 1; i < nBeta; i++)
-        {
-            if (b[i] > parameter->penaltyL1)
-            {
-                prox[i] = b[i] - parameter->penaltyL1;
-            }
-            if (b[i] < -parameter->penaltyL1)
-            {
-                prox[i] = b[i] + parameter->penaltyL1;
-            }
-            if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i]) <= parameter->penaltyL1)
-            {
-                prox[i] = 0;
-            }
-        }
+        st = computeProximalProjection<algorithmFPType, cpu>(b, nBeta, proximalProjection, parameter);
+        DAAL_CHECK_STATUS_VAR(st);
     }
 
     if (lipschitzConstant)
@@ -224,27 +263,14 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
             }
         });
 
-        algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
-        algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
-        algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
-        c                            = 2 * lipschitz + displacement;
+        c = lipschitzConstantByMaxNorm<algorithmFPType, cpu>(globalMaxNorm, n, parameter);
     }
 
     algorithmFPType nonSmoothTerm = 0;
     if (nonSmoothTermValue)
     {
-        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(vr);
-        algorithmFPType & v = *vr.get();
-
-        if ((parameter->penaltyL1 > 0))
-        {
-            for (size_t i = 1; i < nBeta; ++i)
-            {
-                nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
-            }
-        }
-        v = nonSmoothTerm;
+        st = computeNonSmoothTerm<algorithmFPType, cpu>(b, nBeta, nonSmoothTermValue, parameter, nonSmoothTerm);
+        DAAL_CHECK_STATUS_VAR(st);
     }
 
     if (valueNT || gradientNT || hessianNT)
@@ -461,7 +487,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
             }
         }
     }
-    return services::Status();
+    return st;
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -118,6 +118,18 @@ public:
 
     void computeCorrectionPairImpl(size_t correctionIndex, const algorithmFPType * hessian, bool useWolfeConditions);
 
+    /*
+    * Prepares the buffers used to compute the correction vector y as the difference of the objective function
+    * gradients at the two last averaged arguments instead of the product of the Hessian matrix and s
+    */
+    Status initCorrectionGradients();
+
+    /*
+    * Computes the gradients of the objective function on the correction pair batch
+    * at the two last averaged arguments
+    */
+    Status computeCorrectionGradients(sum_of_functions::BatchPtr & function);
+
     algorithmFPType lineSearch(algorithmFPType * x, NumericTablePtr & ntValue, NumericTablePtr & ntGradient, algorithmFPType * dx,
                                sum_of_functions::BatchPtr & gradientFunction, bool & continueSearch);
     algorithmFPType lineSearch1(algorithmFPType * x, NumericTablePtr & ntValue, NumericTablePtr & ntGradient, algorithmFPType * dx,
@@ -200,6 +212,8 @@ public:
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<int, cpu> > ntCorrectionPairBatchIndices;
     /** Numeric table that stores the average of work values for last L iterations */
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > argumentLCurTable;
+    /** Numeric table that stores the average of work values for previous L iterations */
+    services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > argumentLPrevTable;
     /** Correction pair batch indices block descriptor */
     ReadRows<int, cpu> mtCorrectionPairBatchIndices;
 
@@ -27,6 +27,8 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_rng.h"
 #include "src/services/service_data_utils.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_batch.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -57,6 +59,18 @@ static size_t mod(size_t a, size_t m)
     return (a - (a / m) * m);
 }
 
+/**
+ * Returns true if the objective function works with the sparse (CSR) data.
+ * Hessian of such function is a dense p x p matrix which is never formed,
+ * the correction pairs are computed from the gradients instead.
+ */
+template <typename algorithmFPType>
+bool isSparseObjective(sum_of_functions::Batch * function)
+{
+    return dynamic_cast<logistic_loss::Batch<algorithmFPType, logistic_loss::fastCSR> *>(function)
+           || dynamic_cast<cross_entropy_loss::Batch<algorithmFPType, cross_entropy_loss::fastCSR> *>(function);
+}
+
 /**
  * \brief Kernel for LBFGS calculation
  */
@@ -101,9 +115,18 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
     }
     gradientFunction->sumOfFunctionsInput->set(sum_of_functions::argument, argumentTable);
 
-    sum_of_functions::BatchPtr hessianFunction                 = gradientFunction->clone();
-    hessianFunction->sumOfFunctionsParameter->batchIndices     = task.ntCorrectionPairBatchIndices;
-    hessianFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::hessian;
+    /* For the sparse data the correction vector y = H * s is computed as the difference of the gradients
+       at the two last averaged arguments on the correction pair batch */
+    const bool useCorrectionGradients = !useWolfeConditions && isSparseObjective<algorithmFPType>(gradientFunction.get());
+    if (useCorrectionGradients)
+    {
+        DAAL_CHECK_STATUS(s, task.initCorrectionGradients());
+    }
+
+    sum_of_functions::BatchPtr hessianFunction             = gradientFunction->clone();
+    hessianFunction->sumOfFunctionsParameter->batchIndices = task.ntCorrectionPairBatchIndices;
+    hessianFunction->sumOfFunctionsParameter->resultsToCompute =
+        useCorrectionGradients ? objective_function::gradient : objective_function::hessian;
     hessianFunction->sumOfFunctionsInput->set(sum_of_functions::argument, task.argumentLCurTable);
 
     NumericTablePtr ntGradient;
@@ -171,7 +194,11 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
                     s, task.updateCorrectionPairBatchIndices(iPredefinedIndicesCorrectionRow, nTerms, correctionPairBatchSize, engineImpl));
             }
             iPredefinedIndicesCorrectionRow++;
-            if (!useWolfeConditions)
+            if (useCorrectionGradients)
+            {
+                s = task.computeCorrectionGradients(hessianFunction);
+            }
+            else if (!useWolfeConditions)
             {
                 s = hessianFunction->computeNoThrow();
             }
@@ -185,7 +212,11 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
                 task.mtCorrectionPairBatchIndices.release();
             }
 
-            if (!useWolfeConditions)
+            if (useCorrectionGradients)
+            {
+                DAAL_CHECK_STATUS(s, task.computeCorrectionPair(correctionIndex, nullptr, true));
+            }
+            else if (!useWolfeConditions)
             {
                 ntHessian = hessianFunction->getResult()->get(objective_function::hessianIdx);
                 DAAL_CHECK_STATUS(s, task.computeCorrectionPair(correctionIndex, ntHessian.get(), useWolfeConditions));
@@ -871,6 +902,54 @@ Status LBFGSTask<algorithmFPType, cpu>::computeCorrectionPair(size_t correctionI
     return Status();
 }
 
+/**
+ * Allocates the gradient buffers and the numeric table for the previous averaged argument
+ * used to compute the correction vector y from the gradients of the objective function
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status LBFGSTask<algorithmFPType, cpu>::initCorrectionGradients()
+{
+    Status s;
+    _gradientPrevPtr.reset(this->argumentSize);
+    _gradientCurrPtr.reset(this->argumentSize);
+    DAAL_CHECK_MALLOC(_gradientPrevPtr.get() && _gradientCurrPtr.get());
+
+    argumentLPrevTable.reset(new HomogenNumericTableCPU<algorithmFPType, cpu>(argumentLPrev, 1, this->argumentSize, s));
+    DAAL_CHECK_MALLOC(argumentLPrevTable.get());
+    return s;
+}
+
+/**
+ * Computes the gradients of the objective function on the correction pair batch at the current and
+ * at the previous averaged arguments. Their difference is the product of the averaged Hessian matrix
+ * of the batch and the vector s, so the correction vector y is obtained without forming the Hessian.
+ *
+ * \param[in] function  Objective function with the correction pair batch indices set,
+ *                      its argument is the current averaged argument
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status LBFGSTask<algorithmFPType, cpu>::computeCorrectionGradients(sum_of_functions::BatchPtr & function)
+{
+    Status s;
+    const size_t nBytes                  = this->argumentSize * sizeof(algorithmFPType);
+    algorithmFPType * const gradients[2] = { _gradientCurrPtr.get(), _gradientPrevPtr.get() };
+    const NumericTablePtr arguments[2]   = { argumentLCurTable, argumentLPrevTable };
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        function->sumOfFunctionsInput->set(sum_of_functions::argument, arguments[i]);
+        s = function->computeNoThrow();
+        if (!s) break;
+
+        ReadRows<algorithmFPType, cpu> gradientRows(*function->getResult()->get(objective_function::gradientIdx), 0, this->argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(gradientRows);
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(gradients[i], nBytes, gradientRows.get(), nBytes),
+                   services::ErrorMemoryCopyFailedInternal);
+    }
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, argumentLCurTable);
+    return s;
+}
+
 /**
  * Computes the correction pair (s, y) and the corresponding value rho
  *
@@ -24,6 +24,8 @@
 #include "algorithms/optimization_solver/saga/saga_types.h"
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_batch.h"
 
 namespace daal
 {
@@ -37,6 +39,14 @@ namespace interface2
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_SAGA_RESULT_ID);
 
+/* SAGA keeps a dense gradient of every term of the objective function, which defeats the purpose of the sparse methods */
+template <typename algorithmFPType>
+static bool isSparseObjective(sum_of_functions::Batch * function)
+{
+    return dynamic_cast<logistic_loss::Batch<algorithmFPType, logistic_loss::fastCSR> *>(function)
+           || dynamic_cast<cross_entropy_loss::Batch<algorithmFPType, cross_entropy_loss::fastCSR> *>(function);
+}
+
 Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold,
                      const data_management::NumericTablePtr batchIndices, const size_t batchSize,
                      const data_management::NumericTablePtr learningRateSequence, size_t seed)
@@ -54,6 +64,9 @@ services::Status Parameter::check() const
     services::Status s = iterative_solver::Parameter::check();
     if (!s) return s;
 
+    if (isSparseObjective<float>(function.get()) || isSparseObjective<double>(function.get()))
+        return services::Status(services::Error::create(services::ErrorMethodNotSupported, services::ArgumentName, "function"));
+
     if (learningRateSequence)
     {
         const size_t nRows = learningRateSequence->getNumberOfRows();
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
 
@@ -34,21 +35,37 @@ namespace algorithms
 {
 namespace quantiles
 {
-namespace interface1
+namespace interface2
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILES_RESULT_ID);
-Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID);
+
+Parameter::Parameter(const NumericTablePtr quantileOrders) : interface1::Parameter(quantileOrders), sketchSize(200) {}
+
+/**
+ * Checks the parameters of the quantiles algorithm
+ */
+Status Parameter::check() const
 {
-    Status s;
-    if (quantileOrders.get() == NULL)
-    {
-        this->quantileOrders = HomogenNumericTable<double>::create(1, 1, NumericTableIface::doAllocate, 0.5, &s);
-        if (!s) return;
-    }
+    DAAL_CHECK_EX(sketchSize >= 2, ErrorIncorrectParameter, ParameterName, sketchSizeStr());
+    return Status();
 }
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
-Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input & other) : InputIface(other) {}
+
+/**
+ * Returns the number of features in the input data set
+ * \param[out] nFeatures Number of features
+ * \return Status of the call
+ */
+Status Input::getNumberOfFeatures(size_t & nFeatures) const
+{
+    NumericTablePtr dataTable = get(data);
+    Status s                  = checkNumericTable(dataTable.get(), dataStr());
+    nFeatures                 = s ? dataTable->getNumberOfColumns() : 0;
+    return s;
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -115,24 +132,197 @@ void Result::set(ResultId id, const NumericTablePtr & value)
  */
 Status Result::check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const
 {
-    const Input * input         = static_cast<const Input *>(in);
+    const Input * input = static_cast<const Input *>(in);
+    return checkImpl(input->get(data)->getNumberOfColumns(), par);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] pres   Pointer to the partial results structure
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult * pres, const daal::algorithms::Parameter * par, int method) const
+{
+    const PartialResult * partialResult = static_cast<const PartialResult *>(pres);
+    return checkImpl(partialResult->getNumberOfFeatures(), par);
+}
+
+Status Result::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const
+{
     const Parameter * parameter = static_cast<const Parameter *>(par);
 
     Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
     if (!s) return s;
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
-    size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
+    size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)NumericTableIface::csrArray | (int)NumericTableIface::upperPackedTriangularMatrix
                             | (int)NumericTableIface::lowerPackedTriangularMatrix | (int)NumericTableIface::upperPackedSymmetricMatrix
                             | (int)NumericTableIface::lowerPackedSymmetricMatrix;
 
-    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nFeatures, nVectors);
+    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nQuantileOrders, nFeatures);
+    return s;
+}
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the number of features in the partial result of the quantiles algorithm
+ * \return Number of features
+ */
+size_t PartialResult::getNumberOfFeatures() const
+{
+    NumericTablePtr sketchValuesTable = get(sketchValues);
+    return sketchValuesTable ? sketchValuesTable->getNumberOfRows() : 0;
+}
+
+/**
+ * Returns the partial result of the quantiles algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return services::staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the quantiles algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    return checkImpl(getNumberOfFeatures(), parameter);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    size_t nFeatures = 0;
+    Status s         = static_cast<const InputIface *>(input)->getNumberOfFeatures(nFeatures);
+    if (!s) return s;
+    return checkImpl(nFeatures, parameter);
+}
+
+Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const
+{
+    const Parameter * par       = static_cast<const Parameter *>(parameter);
+    const int unexpectedLayouts = (int)packed_mask;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchValues).get(), sketchValuesStr(), unexpectedLayouts, 0,
+                                           internal::getSketchMaxSize(par->sketchSize), nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchLevelSizes).get(), sketchLevelSizesStr(), unexpectedLayouts, 0, internal::getSketchStateSize(),
+                                           nFeatures));
+    return s;
+}
+
+template <>
+DistributedInput<step2Master>::DistributedInput() : InputIface(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+template <>
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master> & other) : InputIface(other)
+{}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id   Identifier of the input object, \ref MasterInputId
+ * \return Collection of distributed input objects
+ */
+template <>
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input object for the quantiles algorithm in the distributed processing mode
+ * \param[in] id  Identifier of the input object
+ * \param[in] ptr Pointer to the input object
+ */
+template <>
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+ */
+template <>
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr & partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Returns the number of features in the input data set
+ * \param[out] nFeatures Number of features
+ * \return Status of the call
+ */
+template <>
+Status DistributedInput<step2Master>::getNumberOfFeatures(size_t & nFeatures) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    DAAL_CHECK(collection->size(), ErrorIncorrectNumberOfInputNumericTables);
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+
+    Status s  = checkNumericTable(partialResult->get(sketchValues).get(), sketchValuesStr());
+    nFeatures = s ? partialResult->getNumberOfFeatures() : 0;
+    return s;
+}
+
+/**
+ * Checks the input objects of the quantiles algorithm on the master node
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <>
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    size_t nFeatures = 0;
+    Status s         = getNumberOfFeatures(nFeatures);
+    if (!s) return s;
+
+    DataCollectionPtr collection = get(partialResults);
+    const size_t nBlocks         = collection->size();
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+        DAAL_CHECK_STATUS(s, partialResult->check(parameter, method));
+        DAAL_CHECK(partialResult->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures);
+    }
     return s;
 }
 
-} // namespace interface1
+} // namespace interface2
 } // namespace quantiles
 } // namespace algorithms
 } // namespace daal
@@ -35,6 +35,8 @@ namespace algorithms
 {
 namespace quantiles
 {
+namespace interface2
+{
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
@@ -63,6 +65,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                        *quantileOrdersTable, *quantilesTable);
 }
 
+} // namespace interface2
 } // namespace quantiles
 
 } // namespace algorithms
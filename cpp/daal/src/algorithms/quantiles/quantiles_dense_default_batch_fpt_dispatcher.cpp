@@ -27,6 +27,6 @@ namespace daal
 {
 namespace algorithms
 {
-__DAAL_INSTANTIATE_DISPATCH_CONTAINER(quantiles::BatchContainer, batch, DAAL_FPTYPE, quantiles::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(quantiles::interface2::BatchContainer, batch, DAAL_FPTYPE, quantiles::defaultDense)
 } // namespace algorithms
 } // namespace daal
@@ -0,0 +1,32 @@
+/* file: quantiles_dense_sketch_distr_step2_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the quantiles algorithm container in the second step of the distributed processing mode.
+//--
+*/
+
+#include "src/algorithms/quantiles/quantiles_sketch_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(quantiles::DistributedContainer, distributed, step2Master, DAAL_FPTYPE, quantiles::sketchDense)
+} // namespace algorithms
+} // namespace daal
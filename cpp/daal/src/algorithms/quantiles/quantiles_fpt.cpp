@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
 
 namespace daal
 {
@@ -29,7 +30,7 @@ namespace algorithms
 {
 namespace quantiles
 {
-namespace interface1
+namespace interface2
 {
 /**
  * Allocates memory to store final results of the quantile algorithms
@@ -52,10 +53,79 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     return s;
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                              const int method)
+{
+    services::Status s;
+    const PartialResult * pres = static_cast<const PartialResult *>(partialResult);
+    const Parameter * par      = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures       = pres->getNumberOfFeatures();
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    set(quantiles,
+        data_management::HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Allocates memory to store partial results of the quantiles algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfFeatures(nFeatures));
+
+    set(sketchValues, data_management::HomogenNumericTable<algorithmFPType>::create(internal::getSketchMaxSize(par->sketchSize), nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(sketchLevelSizes,
+        data_management::HomogenNumericTable<int>::create(internal::getSketchStateSize(), nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes partial results of the quantiles algorithm with empty sketches
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ * \return Status of initialization
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, get(sketchValues)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(sketchLevelSizes)->assign((int)0));
+    return s;
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
                                                                     const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                           const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * par, const int method);
 
-} // namespace interface1
+} // namespace interface2
 } // namespace quantiles
 } // namespace algorithms
 } // namespace daal
@@ -26,6 +26,8 @@
 
 #include "data_management/data/numeric_table.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 
 #include "src/services/service_defines.h"
 #include "src/data_management/service_micro_table.h"
@@ -47,6 +49,24 @@ struct QuantilesKernel : public Kernel
     services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
 };
 
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    services::Status compute(const NumericTable & dataTable, NumericTable & sketchValuesTable, NumericTable & sketchLevelSizesTable,
+                             const Parameter * par);
+    services::Status finalizeCompute(const NumericTable & sketchValuesTable, const NumericTable & sketchLevelSizesTable,
+                                     const NumericTable & quantileOrdersTable, NumericTable & quantilesTable, const Parameter * par);
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public QuantilesOnlineKernel<method, algorithmFPType, cpu>
+{
+    virtual ~QuantilesDistributedKernel() {}
+    services::Status compute(data_management::DataCollection * partialResultsCollection, NumericTable & sketchValuesTable,
+                             NumericTable & sketchLevelSizesTable, const Parameter * par);
+};
+
 } // namespace internal
 
 } // namespace quantiles
@@ -0,0 +1,83 @@
+/* file: quantiles_sketch.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Layout of the mergeable quantiles sketch kept in the partial results.
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_H__
+#define __QUANTILES_SKETCH_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/*
+ * The sketch of a feature is the KLL sketch: the values on the level h have the weight 2^h and the level h
+ * of the sketch with nLevels levels keeps at most sketchSize*(2/3)^(nLevels-1-h) values. A full level is sorted
+ * and every other of its values is promoted to the next level, so the sketch of n observations keeps O(sketchSize)
+ * values and the rank error of the quantiles is O(n/sketchSize)
+ */
+const size_t sketchMaxLevels = 48;
+
+/* Positions in the row of the sketchLevelSizes table */
+enum SketchStateId
+{
+    sketchNumberOfLevels = 0, /* Number of levels, 0 for the empty sketch */
+    sketchCompactionParity,   /* Parity of the values that are promoted on the next compaction */
+    sketchFirstLevelSize      /* Size of the level 0, the sizes of the next levels follow */
+};
+
+inline size_t getSketchStateSize()
+{
+    return sketchFirstLevelSize + sketchMaxLevels;
+}
+
+inline size_t getSketchLevelCapacity(size_t sketchSize, size_t level, size_t nLevels)
+{
+    double capacity = double(sketchSize);
+    for (size_t h = level + 1; h < nLevels; h++) capacity *= 2.0 / 3.0;
+    return (capacity < 2.0) ? 2 : size_t(capacity);
+}
+
+inline size_t getSketchCapacity(size_t sketchSize, size_t nLevels)
+{
+    size_t capacity = 0;
+    for (size_t h = 0; h < nLevels; h++) capacity += getSketchLevelCapacity(sketchSize, h, nLevels);
+    return capacity;
+}
+
+/* Upper bound of the number of values in the sketch of a feature */
+inline size_t getSketchMaxSize(size_t sketchSize)
+{
+    return 3 * sketchSize + 2 * sketchMaxLevels;
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
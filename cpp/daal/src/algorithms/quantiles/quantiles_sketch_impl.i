@@ -0,0 +1,375 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the sketch method of quantiles computation
+//  in the online and distributed processing modes
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL__
+#define __QUANTILES_SKETCH_IMPL__
+
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/algorithms/service_sort.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/threading/threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/*
+ * Working copy of the sketch of a feature. The levels are stored in the buffer from the top level to the level 0,
+ * so new observations are appended to the end of the buffer and the values promoted from the level h are appended
+ * right after the values of the level h+1
+ */
+template <typename algorithmFPType, CpuType cpu>
+class Sketch
+{
+public:
+    Sketch(size_t sketchSize, algorithmFPType * buffer, algorithmFPType * auxBuffer)
+        : _sketchSize(sketchSize), _values(buffer), _aux(auxBuffer), _nLevels(1), _parity(0)
+    {
+        for (size_t h = 0; h < sketchMaxLevels; h++) _levelSizes[h] = 0;
+    }
+
+    void load(const algorithmFPType * values, const int * state)
+    {
+        _nLevels = state[sketchNumberOfLevels] ? state[sketchNumberOfLevels] : 1;
+        _parity  = state[sketchCompactionParity];
+        for (size_t h = 0; h < sketchMaxLevels; h++) _levelSizes[h] = (h < _nLevels) ? state[sketchFirstLevelSize + h] : 0;
+
+        const size_t n = size();
+        for (size_t i = 0; i < n; i++) _values[i] = values[i];
+    }
+
+    void store(algorithmFPType * values, int * state) const
+    {
+        state[sketchNumberOfLevels]   = int(_nLevels);
+        state[sketchCompactionParity] = int(_parity);
+        for (size_t h = 0; h < sketchMaxLevels; h++) state[sketchFirstLevelSize + h] = int(_levelSizes[h]);
+
+        const size_t n = size();
+        for (size_t i = 0; i < n; i++) values[i] = _values[i];
+    }
+
+    size_t size() const
+    {
+        size_t n = 0;
+        for (size_t h = 0; h < _nLevels; h++) n += _levelSizes[h];
+        return n;
+    }
+
+    /* Adds n observations to the level 0, compacting the sketch when it reaches its capacity */
+    Status update(const algorithmFPType * x, size_t n)
+    {
+        size_t i = 0;
+        while (i < n)
+        {
+            const size_t capacity = getSketchCapacity(_sketchSize, _nLevels);
+            const size_t nValues  = size();
+            if (nValues >= capacity)
+            {
+                DAAL_CHECK(compact(), services::ErrorQuantilesInternal);
+                continue;
+            }
+            const size_t nToAdd         = (capacity - nValues < n - i) ? capacity - nValues : n - i;
+            algorithmFPType * const dst = _values + nValues;
+            for (size_t j = 0; j < nToAdd; j++) dst[j] = x[i + j];
+            _levelSizes[0] += nToAdd;
+            i += nToAdd;
+        }
+        return Status();
+    }
+
+    /* Merges the sketch stored in values and state into this sketch */
+    Status merge(const algorithmFPType * values, const int * state)
+    {
+        const size_t nLevelsOther = state[sketchNumberOfLevels] ? state[sketchNumberOfLevels] : 1;
+        const size_t nLevels      = (_nLevels > nLevelsOther) ? _nLevels : nLevelsOther;
+
+        for (size_t h = 0; h < nLevels; h++)
+        {
+            const size_t nOther = (h < nLevelsOther) ? state[sketchFirstLevelSize + h] : 0;
+            _levelSizes[h] += nOther;
+        }
+
+        /* Both sketches keep the levels from the top one to the level 0, the merged levels are written in the same order */
+        size_t dst = 0, posThis = 0, posOther = 0;
+        for (size_t h = nLevels; h-- > 0;)
+        {
+            const size_t nOther = (h < nLevelsOther) ? state[sketchFirstLevelSize + h] : 0;
+            const size_t nThis  = _levelSizes[h] - nOther;
+            for (size_t j = 0; j < nThis; j++) _aux[dst++] = _values[posThis + j];
+            for (size_t j = 0; j < nOther; j++) _aux[dst++] = values[posOther + j];
+            posThis += nThis;
+            posOther += nOther;
+        }
+
+        algorithmFPType * const tmp = _values;
+        _values                     = _aux;
+        _aux                        = tmp;
+        _nLevels                    = nLevels;
+
+        while (size() > getSketchCapacity(_sketchSize, _nLevels))
+        {
+            DAAL_CHECK(compact(), services::ErrorQuantilesInternal);
+        }
+        return Status();
+    }
+
+    /* Computes quantiles of the given orders, values and levels are the buffers of size() elements */
+    Status computeQuantiles(const algorithmFPType * quantileOrders, size_t nQuantileOrders, algorithmFPType * quantiles, algorithmFPType * values,
+                            int * levels)
+    {
+        const size_t n = size();
+        DAAL_CHECK(n, services::ErrorEmptyInputNumericTable);
+
+        double totalWeight = 0.0;
+        size_t pos         = 0;
+        for (size_t h = _nLevels; h-- > 0;)
+        {
+            for (size_t j = 0; j < _levelSizes[h]; j++, pos++)
+            {
+                values[pos] = _values[pos];
+                levels[pos] = int(h);
+            }
+            totalWeight += double(_levelSizes[h]) * double((DAAL_UINT64)1 << h);
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, values, levels);
+
+        for (size_t iOrder = 0; iOrder < nQuantileOrders; iOrder++)
+        {
+            const algorithmFPType order = quantileOrders[iOrder];
+            DAAL_CHECK(order >= algorithmFPType(0) && order <= algorithmFPType(1), services::ErrorQuantileOrderValueIsInvalid);
+
+            const double rank = double(order) * totalWeight;
+            double weight     = 0.0;
+            size_t i          = 0;
+            for (; i + 1 < n; i++)
+            {
+                weight += double((DAAL_UINT64)1 << levels[i]);
+                if (weight >= rank) break;
+            }
+            quantiles[iOrder] = values[i];
+        }
+        return Status();
+    }
+
+private:
+    /* Compacts the lowest level that reached its capacity, returns false if the sketch has no room for a new level */
+    bool compact()
+    {
+        size_t level = 0;
+        while (level < _nLevels && _levelSizes[level] < getSketchLevelCapacity(_sketchSize, level, _nLevels)) level++;
+        if (level == _nLevels) level = _nLevels - 1;
+        if (level + 1 == sketchMaxLevels) return false;
+
+        size_t offset = 0;
+        for (size_t h = level + 1; h < _nLevels; h++) offset += _levelSizes[h];
+
+        const size_t nLevelValues = _levelSizes[level];
+        const size_t nTail        = size() - offset - nLevelValues;
+        algorithmFPType * const a = _values + offset;
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(nLevelValues, a);
+
+        /* The smallest value stays on the level if the level has odd size, every other value of the rest is promoted */
+        const size_t nOdd          = nLevelValues & 1;
+        const size_t nPromoted     = nLevelValues / 2;
+        const algorithmFPType kept = a[0];
+        for (size_t i = 0; i < nPromoted; i++) a[i] = a[nOdd + 2 * i + _parity];
+        if (nOdd) a[nPromoted] = kept;
+        _parity ^= 1;
+
+        /* Move the lower levels towards the beginning of the buffer */
+        algorithmFPType * const tailDst       = a + nPromoted + nOdd;
+        const algorithmFPType * const tailSrc = a + nLevelValues;
+        for (size_t i = 0; i < nTail; i++) tailDst[i] = tailSrc[i];
+
+        if (level + 1 == _nLevels)
+        {
+            _levelSizes[_nLevels] = 0;
+            _nLevels++;
+        }
+        _levelSizes[level + 1] += nPromoted;
+        _levelSizes[level] = nOdd;
+        return true;
+    }
+
+    size_t _sketchSize;
+    algorithmFPType * _values;
+    algorithmFPType * _aux;
+    size_t _levelSizes[sketchMaxLevels];
+    size_t _nLevels;
+    size_t _parity;
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, NumericTable & sketchValuesTable,
+                                                                              NumericTable & sketchLevelSizesTable, const Parameter * par)
+{
+    const size_t nFeatures     = dataTable.getNumberOfColumns();
+    const size_t nVectors      = dataTable.getNumberOfRows();
+    const size_t sketchSize    = par->sketchSize;
+    const size_t sketchMaxSize = getSketchMaxSize(sketchSize);
+    const size_t stateSize     = getSketchStateSize();
+
+    WriteRows<algorithmFPType, cpu> sketchValuesBlock(sketchValuesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchValuesBlock)
+    algorithmFPType * const values = sketchValuesBlock.get();
+
+    WriteRows<int, cpu> sketchLevelSizesBlock(sketchLevelSizesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchLevelSizesBlock)
+    int * const states = sketchLevelSizesBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, 4, sketchMaxSize);
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(4 * sketchMaxSize);
+
+    /* The features are processed in parallel, the sketch of a feature is updated with the whole column of the block */
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+        algorithmFPType * const buffer = tlsBuffer.local();
+        DAAL_CHECK_THR(buffer, services::ErrorMemoryAllocationFailed);
+
+        ReadColumns<algorithmFPType, cpu> columnBlock(const_cast<NumericTable &>(dataTable), iFeature, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS_THR(columnBlock);
+
+        Sketch<algorithmFPType, cpu> sketch(sketchSize, buffer, buffer + 2 * sketchMaxSize);
+        sketch.load(values + iFeature * sketchMaxSize, states + iFeature * stateSize);
+        const Status s = sketch.update(columnBlock.get(), nVectors);
+        DAAL_CHECK_STATUS_THR(s);
+        sketch.store(values + iFeature * sketchMaxSize, states + iFeature * stateSize);
+    });
+    return safeStat.detach();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable & sketchValuesTable,
+                                                                                      const NumericTable & sketchLevelSizesTable,
+                                                                                      const NumericTable & quantileOrdersTable,
+                                                                                      NumericTable & quantilesTable, const Parameter * par)
+{
+    const size_t nFeatures       = sketchValuesTable.getNumberOfRows();
+    const size_t nQuantileOrders = quantilesTable.getNumberOfColumns();
+    const size_t sketchSize      = par->sketchSize;
+    const size_t sketchMaxSize   = getSketchMaxSize(sketchSize);
+    const size_t stateSize       = getSketchStateSize();
+
+    ReadRows<algorithmFPType, cpu> sketchValuesBlock(const_cast<NumericTable &>(sketchValuesTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchValuesBlock)
+    const algorithmFPType * const values = sketchValuesBlock.get();
+
+    ReadRows<int, cpu> sketchLevelSizesBlock(const_cast<NumericTable &>(sketchLevelSizesTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchLevelSizesBlock)
+    const int * const states = sketchLevelSizesBlock.get();
+
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock)
+    const algorithmFPType * const quantileOrders = quantileOrdersBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+    algorithmFPType * const quantiles = quantilesBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, 2, sketchMaxSize);
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(2 * sketchMaxSize);
+    daal::TlsMem<int, cpu> tlsLevels(sketchMaxSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+        algorithmFPType * const buffer = tlsBuffer.local();
+        int * const levels             = tlsLevels.local();
+        DAAL_CHECK_THR(buffer && levels, services::ErrorMemoryAllocationFailed);
+
+        Sketch<algorithmFPType, cpu> sketch(sketchSize, buffer, nullptr);
+        sketch.load(values + iFeature * sketchMaxSize, states + iFeature * stateSize);
+        const Status s =
+            sketch.computeQuantiles(quantileOrders, nQuantileOrders, quantiles + iFeature * nQuantileOrders, buffer + sketchMaxSize, levels);
+        DAAL_CHECK_STATUS_THR(s);
+    });
+    return safeStat.detach();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(data_management::DataCollection * partialResultsCollection,
+                                                                                   NumericTable & sketchValuesTable,
+                                                                                   NumericTable & sketchLevelSizesTable, const Parameter * par)
+{
+    const size_t nFeatures     = sketchValuesTable.getNumberOfRows();
+    const size_t nBlocks       = partialResultsCollection->size();
+    const size_t sketchSize    = par->sketchSize;
+    const size_t sketchMaxSize = getSketchMaxSize(sketchSize);
+    const size_t stateSize     = getSketchStateSize();
+
+    WriteRows<algorithmFPType, cpu> sketchValuesBlock(sketchValuesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchValuesBlock)
+    algorithmFPType * const values = sketchValuesBlock.get();
+
+    WriteRows<int, cpu> sketchLevelSizesBlock(sketchLevelSizesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchLevelSizesBlock)
+    int * const states = sketchLevelSizesBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, 4, sketchMaxSize);
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(4 * sketchMaxSize);
+
+    /* The sketches of a feature from all the local nodes are merged into the sketch of the feature on the master node */
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+        algorithmFPType * const buffer = tlsBuffer.local();
+        DAAL_CHECK_THR(buffer, services::ErrorMemoryAllocationFailed);
+
+        Sketch<algorithmFPType, cpu> sketch(sketchSize, buffer, buffer + 2 * sketchMaxSize);
+        sketch.load(values + iFeature * sketchMaxSize, states + iFeature * stateSize);
+
+        for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+        {
+            PartialResult * partialResult = static_cast<PartialResult *>((*partialResultsCollection)[iBlock].get());
+
+            ReadRows<algorithmFPType, cpu> localValuesBlock(partialResult->get(sketchValues).get(), iFeature, 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(localValuesBlock);
+            ReadRows<int, cpu> localLevelSizesBlock(partialResult->get(sketchLevelSizes).get(), iFeature, 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(localLevelSizesBlock);
+
+            const Status s = sketch.merge(localValuesBlock.get(), localLevelSizesBlock.get());
+            DAAL_CHECK_STATUS_THR(s);
+        }
+        sketch.store(values + iFeature * sketchMaxSize, states + iFeature * stateSize);
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+
+} // namespace quantiles
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
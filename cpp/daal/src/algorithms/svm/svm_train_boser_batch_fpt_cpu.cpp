@@ -21,6 +21,9 @@
 //--
 */
 
+#include "src/externals/service_ittnotify.h"
+DAAL_ITTNOTIFY_DOMAIN(svm.train.boser);
+
 #include "src/algorithms/svm/svm_train_batch_container.h"
 #include "src/algorithms/svm/svm_train_boser_kernel.h"
 #include "src/algorithms/svm/svm_train_boser_impl.i"
@@ -208,6 +208,290 @@ protected:
     TArray<algorithmFPType, cpu> _cache;
 };
 
+/**
+ * LRU cache: kernel function values are cached for the PART of the training set.
+ * Cache lines hold rows of the kernel matrix; the least recently used line is evicted first.
+ * Lookup and eviction are sequential, cache lines are filled and gathered in parallel
+ * into disjoint memory so that repeated working set rows are never recomputed.
+ * The cache is not thread-safe: getRowsBlock must be called by one thread at a time,
+ * and the returned block stays valid until the next call.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMCache<thunder, lruCache, algorithmFPType, cpu> : public SVMCacheIface<thunder, algorithmFPType, cpu>
+{
+    using super    = SVMCacheIface<thunder, algorithmFPType, cpu>;
+    using thisType = SVMCache<thunder, lruCache, algorithmFPType, cpu>;
+    using super::_kernel;
+    using super::_lineSize;
+    using super::_cacheSize;
+
+public:
+    ~SVMCache() {}
+
+    DAAL_NEW_DELETE();
+
+    /**
+     * \param[in]  cacheSize  Number of cache lines, must be not less than blockSize
+     * \param[in]  blockSize  Number of rows requested in one call of getRowsBlock (size of the working set)
+     * \param[in]  lineSize   Number of elements in the cache line (number of observations)
+     */
+    static SVMCachePtr<thunder, algorithmFPType, cpu> create(const size_t cacheSize, const size_t blockSize, const size_t lineSize,
+                                                             const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel,
+                                                             services::Status & status)
+    {
+        DAAL_ASSERT(cacheSize >= blockSize);
+        services::SharedPtr<thisType> res = services::SharedPtr<thisType>(new thisType(cacheSize, blockSize, lineSize, xTable, kernel));
+        if (!res)
+        {
+            status.add(ErrorMemoryAllocationFailed);
+        }
+        else
+        {
+            status = res->init();
+            if (!status)
+            {
+                res.reset();
+            }
+        }
+        return SVMCachePtr<thunder, algorithmFPType, cpu>(res);
+    }
+
+    services::Status getRowsBlock(const uint32_t * indices, algorithmFPType *& block) override
+    {
+        services::Status status;
+        size_t nMisses = 0;
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(cache.lookup);
+
+            int * const rowToLine      = _rowToLine.get();
+            uint32_t * const lineToRow = _lineToRow.get();
+            uint32_t * const blockLine = _blockLines.get();
+            uint32_t * const missRows  = _missIndices.get();
+
+            /* Hits are moved to the head of the list first so that they can not be evicted by the misses of the same block */
+            for (size_t i = 0; i < _blockSize; ++i)
+            {
+                const int line = rowToLine[indices[i]];
+                if (line >= 0)
+                {
+                    blockLine[i] = uint32_t(line);
+                    moveToHead(uint32_t(line));
+                }
+                else
+                {
+                    blockLine[i] = _noLine;
+                }
+            }
+            for (size_t i = 0; i < _blockSize; ++i)
+            {
+                if (blockLine[i] != _noLine) continue;
+                const uint32_t rowIndex = indices[i];
+                if (rowToLine[rowIndex] >= 0)
+                {
+                    /* Duplicated index in the block: the line is already scheduled for computation */
+                    blockLine[i] = uint32_t(rowToLine[rowIndex]);
+                    continue;
+                }
+                const uint32_t line = _tail;
+                if (lineToRow[line] != _noLine) rowToLine[lineToRow[line]] = -1;
+                lineToRow[line]     = rowIndex;
+                rowToLine[rowIndex] = int(line);
+                moveToHead(line);
+
+                blockLine[i]        = line;
+                missRows[nMisses]   = rowIndex;
+                _missLines[nMisses] = line;
+                ++nMisses;
+            }
+            _nHits += _blockSize - nMisses;
+            _nMisses += nMisses;
+        }
+
+        if (nMisses > 0)
+        {
+            DAAL_CHECK_STATUS(status, computeMisses(nMisses));
+        }
+
+        DAAL_CHECK_STATUS(status, gatherBlock());
+        block = _block.get();
+        return status;
+    }
+
+    /* Rows of the previous working set stay in the cache, so they are gathered on the next request */
+    services::Status copyLastToFirst() override { return services::Status(); }
+
+    size_t getHits() const { return _nHits; }
+    size_t getMisses() const { return _nMisses; }
+
+protected:
+    SVMCache(const size_t cacheSize, const size_t blockSize, const size_t lineSize, const NumericTablePtr & xTable,
+             const kernel_function::KernelIfacePtr & kernel)
+        : super(cacheSize, lineSize, kernel),
+          _blockSize(blockSize),
+          _nComputeRows(0),
+          _head(0),
+          _tail(0),
+          _nHits(0),
+          _nMisses(0),
+          _xTable(xTable)
+    {}
+
+    services::Status init()
+    {
+        _cache.reset(_lineSize * _cacheSize);
+        DAAL_CHECK_MALLOC(_cache.get());
+        _block.reset(_lineSize * _blockSize);
+        DAAL_CHECK_MALLOC(_block.get());
+        _kernelValues.reset(_lineSize * _blockSize);
+        DAAL_CHECK_MALLOC(_kernelValues.get());
+
+        _rowToLine.reset(_lineSize);
+        DAAL_CHECK_MALLOC(_rowToLine.get());
+        _lineToRow.reset(_cacheSize);
+        DAAL_CHECK_MALLOC(_lineToRow.get());
+        _prev.reset(_cacheSize);
+        DAAL_CHECK_MALLOC(_prev.get());
+        _next.reset(_cacheSize);
+        DAAL_CHECK_MALLOC(_next.get());
+        _blockLines.reset(_blockSize);
+        DAAL_CHECK_MALLOC(_blockLines.get());
+        _missIndices.reset(_blockSize);
+        DAAL_CHECK_MALLOC(_missIndices.get());
+        _missLines.reset(_blockSize);
+        DAAL_CHECK_MALLOC(_missLines.get());
+
+        int * const rowToLine = _rowToLine.get();
+        for (size_t i = 0; i < _lineSize; ++i)
+        {
+            rowToLine[i] = -1;
+        }
+        /* All lines are free and linked in the order of their indices */
+        for (size_t i = 0; i < _cacheSize; ++i)
+        {
+            _lineToRow[i] = _noLine;
+            _prev[i]      = i == 0 ? _noLine : uint32_t(i - 1);
+            _next[i]      = i + 1 == _cacheSize ? _noLine : uint32_t(i + 1);
+        }
+        _head = 0;
+        _tail = uint32_t(_cacheSize - 1);
+        return services::Status();
+    }
+
+    void moveToHead(const uint32_t line)
+    {
+        if (line == _head) return;
+        const uint32_t prev = _prev[line];
+        const uint32_t next = _next[line];
+        _next[prev]         = next;
+        if (next != _noLine)
+            _prev[next] = prev;
+        else
+            _tail = prev;
+        _prev[line]  = _noLine;
+        _next[line]  = _head;
+        _prev[_head] = line;
+        _head        = line;
+    }
+
+    services::Status reinit(const size_t nRows)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(cache.reinit);
+
+        services::Status status;
+        auto cacheTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_kernelValues.get(), _lineSize, nRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        SubDataTaskBase<algorithmFPType, cpu> * task = nullptr;
+        if (_xTable->getDataLayout() == NumericTableIface::csrArray)
+        {
+            task = SubDataTaskCSR<algorithmFPType, cpu>::create(_xTable, nRows);
+        }
+        else
+        {
+            task = SubDataTaskDense<algorithmFPType, cpu>::create(_xTable->getNumberOfColumns(), nRows);
+        }
+        DAAL_CHECK_MALLOC(task);
+        _blockTask = SubDataTaskBasePtr<algorithmFPType, cpu>(task);
+
+        _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+        _kernel->getInput()->set(kernel_function::X, _blockTask->getTableData());
+        _kernel->getInput()->set(kernel_function::Y, _xTable);
+
+        kernel_function::ResultPtr shRes(new kernel_function::Result());
+        shRes->set(kernel_function::values, cacheTable);
+        _kernel->setResult(shRes);
+
+        _nComputeRows = nRows;
+        return status;
+    }
+
+    services::Status computeMisses(const size_t nMisses)
+    {
+        services::Status status;
+        if (nMisses != _nComputeRows)
+        {
+            DAAL_CHECK_STATUS(status, reinit(nMisses));
+        }
+
+        DAAL_CHECK_STATUS(status, _blockTask->copyDataByIndices(_missIndices.get(), _xTable));
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(cacheCompute);
+            DAAL_CHECK_STATUS(status, _kernel->computeNoThrow());
+        }
+
+        DAAL_ITTNOTIFY_SCOPED_TASK(cache.store);
+        const algorithmFPType * const kernelValues = _kernelValues.get();
+        algorithmFPType * const cache              = _cache.get();
+        const uint32_t * const missLines           = _missLines.get();
+        const size_t lineSize                      = _lineSize;
+        SafeStatus safeStat;
+        daal::threader_for(nMisses, nMisses, [&](const size_t i) {
+            DAAL_CHECK_THR(!services::internal::daal_memcpy_s(cache + missLines[i] * lineSize, lineSize * sizeof(algorithmFPType),
+                                                              kernelValues + i * lineSize, lineSize * sizeof(algorithmFPType)),
+                           services::ErrorMemoryCopyFailedInternal);
+        });
+        return safeStat.detach();
+    }
+
+    services::Status gatherBlock()
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(cache.gather);
+        const algorithmFPType * const cache = _cache.get();
+        algorithmFPType * const block       = _block.get();
+        const uint32_t * const blockLines   = _blockLines.get();
+        const size_t lineSize               = _lineSize;
+        SafeStatus safeStat;
+        daal::threader_for(_blockSize, _blockSize, [&](const size_t i) {
+            DAAL_CHECK_THR(!services::internal::daal_memcpy_s(block + i * lineSize, lineSize * sizeof(algorithmFPType),
+                                                              cache + blockLines[i] * lineSize, lineSize * sizeof(algorithmFPType)),
+                           services::ErrorMemoryCopyFailedInternal);
+        });
+        return safeStat.detach();
+    }
+
+protected:
+    static const uint32_t _noLine = uint32_t(-1);
+
+    const size_t _blockSize;                    /*!< Number of rows requested in one call of getRowsBlock */
+    size_t _nComputeRows;                       /*!< Number of rows the kernel is configured to compute */
+    uint32_t _head;                             /*!< Most recently used cache line */
+    uint32_t _tail;                             /*!< Least recently used cache line */
+    size_t _nHits;                              /*!< Number of rows found in the cache */
+    size_t _nMisses;                            /*!< Number of rows computed by the kernel */
+    const NumericTablePtr & _xTable;
+    SubDataTaskBasePtr<algorithmFPType, cpu> _blockTask;
+    TArray<algorithmFPType, cpu> _cache;        /*!< Cache lines */
+    TArray<algorithmFPType, cpu> _block;        /*!< Kernel values of the requested rows */
+    TArray<algorithmFPType, cpu> _kernelValues; /*!< Kernel values of the rows missing in the cache */
+    TArray<int, cpu> _rowToLine;                /*!< Index of the cache line for each observation, -1 if it is not cached */
+    TArray<uint32_t, cpu> _lineToRow;           /*!< Index of the observation stored in each cache line */
+    TArray<uint32_t, cpu> _prev;                /*!< LRU list: previous (more recently used) line */
+    TArray<uint32_t, cpu> _next;                /*!< LRU list: next (less recently used) line */
+    TArray<uint32_t, cpu> _blockLines;          /*!< Cache line for each row of the requested block */
+    TArray<uint32_t, cpu> _missIndices;         /*!< Observations to be computed */
+    TArray<uint32_t, cpu> _missLines;           /*!< Cache lines to store the computed observations */
+};
+
 } // namespace internal
 } // namespace training
 } // namespace svm
@@ -141,18 +141,20 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu>::com
     TArray<char, cpu> I(nWS);
     DAAL_CHECK_MALLOC(I.get());
 
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors * sizeof(algorithmFPType), nVectors);
-    if (cacheSize >= nVectors * nVectors * sizeof(algorithmFPType))
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors, sizeof(algorithmFPType));
+    const size_t lineSizeInBytes = nVectors * sizeof(algorithmFPType);
+    /* Number of kernel matrix rows that fit into the cache; the whole kernel matrix is cached if it fits */
+    const size_t nCacheLines = services::internal::min<cpu, size_t>(cacheSize / lineSizeInBytes, nVectors);
+    if (nCacheLines >= nWS)
     {
-        const size_t defaultCacheSize = nWS;
-        // TODO: support the simple cache for thunder method
-        cachePtr = SVMCache<thunder, noCache, algorithmFPType, cpu>::create(defaultCacheSize, nVectors, xTable, kernel, status);
+        cachePtr = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(nCacheLines, nWS, nVectors, xTable, kernel, status);
     }
     else
     {
         const size_t defaultCacheSize = nWS;
         cachePtr                      = SVMCache<thunder, noCache, algorithmFPType, cpu>::create(defaultCacheSize, nVectors, xTable, kernel, status);
     }
+    DAAL_CHECK_STATUS_VAR(status);
 
     size_t iter = 0;
     for (; iter < maxIterations; ++iter)
@@ -0,0 +1,441 @@
+/** file csv_parallel_parser.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data_source/internal/csv_parallel_parser.h"
+#include "services/daal_memory.h"
+#include "src/services/service_arrays.h"
+#include "services/internal/utilities.h"
+#include "src/threading/threading.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <cstring>
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+namespace
+{
+/* Read-only memory mapping of the whole file */
+class MappedFile : public Base
+{
+public:
+    MappedFile();
+    virtual ~MappedFile();
+
+    services::Status open(const char * fileName);
+    void close();
+
+    const char * data() const { return _data; }
+    size_t size() const { return _size; }
+
+private:
+    MappedFile(const MappedFile &);
+    MappedFile & operator=(const MappedFile &);
+
+    const char * _data;
+    size_t _size;
+    void * _fileHandle;
+    void * _mappingHandle;
+};
+
+MappedFile::MappedFile() : _data(nullptr), _size(0), _fileHandle(nullptr), _mappingHandle(nullptr) {}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+services::Status MappedFile::open(const char * fileName)
+{
+    close();
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return services::Status(services::ErrorOnFileOpen);
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return services::Status(services::ErrorOnFileRead);
+    }
+    _fileHandle = file;
+    _size       = (size_t)fileSize.QuadPart;
+    if (!_size) return services::Status();
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+    {
+        close();
+        return services::Status(services::ErrorOnFileRead);
+    }
+    _mappingHandle = mapping;
+    _data          = (const char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!_data)
+    {
+        close();
+        return services::Status(services::ErrorOnFileRead);
+    }
+    return services::Status();
+}
+
+void MappedFile::close()
+{
+    if (_data) UnmapViewOfFile(_data);
+    if (_mappingHandle) CloseHandle((HANDLE)_mappingHandle);
+    if (_fileHandle) CloseHandle((HANDLE)_fileHandle);
+    _data          = nullptr;
+    _size          = 0;
+    _fileHandle    = nullptr;
+    _mappingHandle = nullptr;
+}
+
+#else
+
+services::Status MappedFile::open(const char * fileName)
+{
+    close();
+    const int fd = ::open(fileName, O_RDONLY);
+    if (fd < 0) return services::Status(services::ErrorOnFileOpen);
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        ::close(fd);
+        return services::Status(services::ErrorOnFileRead);
+    }
+    _size = (size_t)fileStat.st_size;
+    if (_size)
+    {
+        void * data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            ::close(fd);
+            close();
+            return services::Status(services::ErrorOnFileRead);
+        }
+        madvise(data, _size, MADV_SEQUENTIAL);
+        _data = (const char *)data;
+    }
+    /* the mapping stays valid after the descriptor is closed */
+    ::close(fd);
+    return services::Status();
+}
+
+void MappedFile::close()
+{
+    if (_data) munmap((void *)_data, _size);
+    _data = nullptr;
+    _size = 0;
+}
+
+#endif
+
+} // namespace
+
+services::SharedPtr<Base> mapFile(const char * fileName, const char *& data, size_t & size, services::Status & status)
+{
+    data = nullptr;
+    size = 0;
+
+    services::SharedPtr<MappedFile> file(new MappedFile());
+    if (!file.get())
+    {
+        status |= services::Status(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<Base>();
+    }
+    status |= file->open(fileName);
+    if (!status) return services::SharedPtr<Base>();
+
+    data = file->data();
+    size = file->size();
+    return file;
+}
+
+namespace
+{
+using daal::services::internal::TArray;
+
+const size_t minChunkSize  = 1 << 18; /* 256 KB of text parsed by a single task at least */
+const size_t minWindowSize = 1 << 22; /* 4 MB of text split into chunks at least */
+const size_t noEmptyLine   = size_t(-1);
+
+const unsigned long long maxExactMantissa = 1ULL << 24; /* Integers up to 2^24 are exactly representable by float */
+const int maxExactExponent                = 10;         /* 10^10 is the largest power of 10 exactly representable by float */
+const float powersOf10[]                  = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/* Parses the number the same way daal_string_to_float does. The mantissa of plain decimal numbers up to 2^24 and the power of 10
+   with decimal exponent within [-10, 10] are exactly representable by float, so their single float product or ratio
+   is correctly rounded. Other tokens are passed to daal_string_to_float */
+float parseFloat(const char * begin, const char * end)
+{
+    const char * p = begin;
+    if (p == end) return 0.0f;
+
+    const bool negative = (*p == '-');
+    if (*p == '-' || *p == '+') ++p;
+
+    unsigned long long mantissa = 0;
+    int nDigits                 = 0;
+    int exponent                = 0;
+    bool hasDigits              = false;
+    for (; p < end && isDigit(*p); ++p)
+    {
+        hasDigits = true;
+        if (nDigits < 19)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            nDigits += (mantissa != 0);
+        }
+        else
+        {
+            ++exponent;
+        }
+    }
+    if (p < end && *p == '.')
+    {
+        for (++p; p < end && isDigit(*p); ++p)
+        {
+            hasDigits = true;
+            if (nDigits < 19)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                nDigits += (mantissa != 0);
+                --exponent;
+            }
+        }
+    }
+    bool isFast = hasDigits;
+    if (isFast && p < end && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+        const bool negativeExp = (p < end && *p == '-');
+        if (p < end && (*p == '-' || *p == '+')) ++p;
+        isFast = (p < end);
+        int exp10 = 0;
+        for (; p < end && isDigit(*p); ++p)
+        {
+            if (exp10 < 10000) exp10 = exp10 * 10 + (*p - '0');
+        }
+        exponent += (negativeExp ? -exp10 : exp10);
+    }
+    isFast = isFast && (p == end) && (mantissa <= maxExactMantissa)
+             && (mantissa == 0 || (exponent >= -maxExactExponent && exponent <= maxExactExponent));
+
+    if (!isFast)
+    {
+        char buffer[256];
+        const size_t size = services::internal::minValue<size_t>(end - begin, sizeof(buffer) - 1);
+        memcpy(buffer, begin, size);
+        buffer[size] = '\0';
+        return services::daal_string_to_float(buffer, 0);
+    }
+
+    if (mantissa == 0) return (negative ? -0.0f : 0.0f);
+    float value = float(mantissa);
+    value       = (exponent < 0 ? value / powersOf10[-exponent] : value * powersOf10[exponent]);
+    return (negative ? -value : value);
+}
+
+/* Returns the end of the line that starts at begin, i.e. the position of '\n' or end */
+inline const char * findLineEnd(const char * begin, const char * end)
+{
+    const char * p = (const char *)memchr(begin, '\n', end - begin);
+    return p ? p : end;
+}
+
+/* The line is empty if it contains line break characters only */
+inline bool isEmptyLine(const char * begin, const char * lineEnd)
+{
+    for (; begin < lineEnd; ++begin)
+    {
+        if (*begin != '\r') return false;
+    }
+    return true;
+}
+
+/* Returns the beginning of the line that follows the line containing pos */
+inline const char * alignToNextLine(const char * pos, const char * end)
+{
+    const char * lineEnd = findLineEnd(pos, end);
+    return (lineEnd < end ? lineEnd + 1 : end);
+}
+
+template <typename FPType>
+void parseLine(const char * begin, const char * end, char delimiter, const int * columnIndices, size_t nTokens, FPType * row)
+{
+    while (end > begin && end[-1] == '\r') --end;
+
+    const char * token = begin;
+    for (size_t i = 0; i < nTokens && token < end; ++i)
+    {
+        const char * tokenEnd = (const char *)memchr(token, delimiter, end - token);
+        if (!tokenEnd) tokenEnd = end;
+        if (columnIndices[i] >= 0) row[columnIndices[i]] = FPType(parseFloat(token, tokenEnd));
+        token = tokenEnd + 1;
+    }
+}
+
+/* Lines of the text window split into chunks that are processed in parallel */
+struct ChunkInfo
+{
+    const char * begin;
+    const char * end;
+    size_t nLines;
+    size_t iFirstEmptyLine;
+    size_t iFirstRow;
+};
+
+} // namespace
+
+template <typename FPType>
+DAAL_EXPORT size_t parseCsvNumericRows(const char * text, size_t textSize, char delimiter, const int * columnIndices, size_t nTokens, FPType * rows,
+                                       size_t nRowColumns, size_t maxRows, size_t & nParsedChars)
+{
+    nParsedChars = 0;
+    if (!text || !textSize || !maxRows) return 0;
+
+    const char * const textEnd = text + textSize;
+    const size_t nThreads      = daal::threader_get_threads_number();
+
+    const char * pos = text;
+    size_t nRows     = 0;
+    bool bStop       = false;
+
+    /* The windows are sized by the average length of the lines seen so far, so that
+       the lines of the text beyond maxRows are not scanned */
+    size_t averageLineSize = alignToNextLine(text, textEnd) - text;
+    while (!bStop && nRows < maxRows && pos < textEnd)
+    {
+        const size_t rowsLeft = maxRows - nRows;
+        const size_t textLeft = textEnd - pos;
+        size_t windowSize     = textLeft;
+        if (rowsLeft < textLeft / averageLineSize)
+        {
+            const size_t expectedSize = rowsLeft * averageLineSize;
+            windowSize                = services::internal::maxValue<size_t>(minWindowSize, expectedSize + expectedSize / 8);
+        }
+        const char * windowEnd = (textLeft <= windowSize) ? textEnd : alignToNextLine(pos + windowSize, textEnd);
+
+        const size_t nChunks = services::internal::minValue<size_t>(4 * nThreads, (windowEnd - pos) / minChunkSize + 1);
+        TArray<ChunkInfo, sse2> chunks(nChunks);
+        if (!chunks.get()) break;
+
+        const size_t chunkSize = (windowEnd - pos) / nChunks + 1;
+        const char * chunkPos  = pos;
+        for (size_t i = 0; i < nChunks; ++i)
+        {
+            chunks[i].begin = chunkPos;
+            const bool bLast = (i + 1 == nChunks) || (size_t(windowEnd - chunkPos) <= chunkSize);
+            chunkPos         = bLast ? windowEnd : alignToNextLine(chunkPos + chunkSize, windowEnd);
+            chunks[i].end    = chunkPos;
+        }
+
+        /* Count the lines of every chunk and find its first empty line */
+        daal::threader_for(nChunks, nChunks, [&](size_t iChunk) {
+            ChunkInfo & chunk     = chunks[iChunk];
+            chunk.nLines          = 0;
+            chunk.iFirstEmptyLine = noEmptyLine;
+            for (const char * line = chunk.begin; line < chunk.end; ++chunk.nLines)
+            {
+                const char * lineEnd = findLineEnd(line, chunk.end);
+                if (chunk.iFirstEmptyLine == noEmptyLine && isEmptyLine(line, lineEnd)) chunk.iFirstEmptyLine = chunk.nLines;
+                line = lineEnd + 1;
+            }
+        });
+
+        size_t nWindowRows    = 0;
+        size_t iStopChunk     = nChunks;
+        size_t nStopChunkRows = 0;
+        for (size_t i = 0; i < nChunks; ++i)
+        {
+            chunks[i].iFirstRow = nRows + nWindowRows;
+            if (chunks[i].iFirstEmptyLine != noEmptyLine && nWindowRows + chunks[i].iFirstEmptyLine < rowsLeft)
+            {
+                /* the empty line stops parsing and is consumed */
+                iStopChunk     = i;
+                nStopChunkRows = chunks[i].iFirstEmptyLine + 1;
+                nWindowRows += chunks[i].iFirstEmptyLine;
+                bStop = true;
+                break;
+            }
+            if (nWindowRows + chunks[i].nLines >= rowsLeft)
+            {
+                iStopChunk     = i;
+                nStopChunkRows = rowsLeft - nWindowRows;
+                nWindowRows    = rowsLeft;
+                break;
+            }
+            nWindowRows += chunks[i].nLines;
+        }
+        const size_t rowsEnd = nRows + nWindowRows;
+        for (size_t i = iStopChunk + 1; i < nChunks; ++i) chunks[i].iFirstRow = rowsEnd;
+
+        daal::threader_for(nChunks, nChunks, [&](size_t iChunk) {
+            const ChunkInfo & chunk = chunks[iChunk];
+            size_t iRow             = chunk.iFirstRow;
+            for (const char * line = chunk.begin; line < chunk.end && iRow < rowsEnd; ++iRow)
+            {
+                const char * lineEnd = findLineEnd(line, chunk.end);
+                parseLine<FPType>(line, lineEnd, delimiter, columnIndices, nTokens, rows + iRow * nRowColumns);
+                line = lineEnd + 1;
+            }
+        });
+
+        if (iStopChunk < nChunks)
+        {
+            const char * line = chunks[iStopChunk].begin;
+            for (size_t i = 0; i < nStopChunkRows; ++i) line = alignToNextLine(line, chunks[iStopChunk].end);
+            pos = line;
+        }
+        else
+        {
+            pos = windowEnd;
+        }
+        if (nWindowRows) averageLineSize = services::internal::maxValue<size_t>((pos - text) / (rowsEnd + bStop), 1);
+        nRows = rowsEnd;
+    }
+
+    nParsedChars = pos - text;
+    return nRows;
+}
+
+template DAAL_EXPORT size_t parseCsvNumericRows<float>(const char * text, size_t textSize, char delimiter, const int * columnIndices, size_t nTokens,
+                                                       float * rows, size_t nRowColumns, size_t maxRows, size_t & nParsedChars);
+template DAAL_EXPORT size_t parseCsvNumericRows<double>(const char * text, size_t textSize, char delimiter, const int * columnIndices, size_t nTokens,
+                                                        double * rows, size_t nRowColumns, size_t maxRows, size_t & nParsedChars);
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
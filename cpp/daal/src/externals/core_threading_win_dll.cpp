@@ -240,6 +240,7 @@ FARPROC load_daal_thr_func(char * ordinal)
 
 typedef void * (*_threaded_malloc_t)(const size_t, const size_t);
 typedef void (*_threaded_free_t)(void *);
+typedef bool (*_threaded_numa_first_touch_t)(void *, const size_t);
 
 typedef void (*_daal_threader_for_t)(int, int, const void *, daal::functype);
 typedef void (*_daal_threader_for_blocked_t)(int, int, const void *, daal::functype2);
@@ -284,8 +285,9 @@ typedef bool (*_thread_pinner_set_pinning_t)(bool p);
 typedef void * (*_getThreadPinner_t)(bool create_pinner, void (*read_topo)(int &, int &, int &, int **), void (*deleter)(void *));
 #endif
 
-static _threaded_malloc_t _threaded_malloc_ptr = NULL;
-static _threaded_free_t _threaded_free_ptr     = NULL;
+static _threaded_malloc_t _threaded_malloc_ptr                     = NULL;
+static _threaded_free_t _threaded_free_ptr                         = NULL;
+static _threaded_numa_first_touch_t _threaded_numa_first_touch_ptr = NULL;
 
 static _daal_threader_for_t _daal_threader_for_ptr                         = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr         = NULL;
@@ -351,6 +353,16 @@ DAAL_EXPORT void _threaded_scalable_free(void * ptr)
     _threaded_free_ptr(ptr);
 }
 
+DAAL_EXPORT bool _threaded_numa_first_touch(void * ptr, const size_t size)
+{
+    load_daal_thr_dll();
+    if (_threaded_numa_first_touch_ptr == NULL)
+    {
+        _threaded_numa_first_touch_ptr = (_threaded_numa_first_touch_t)load_daal_thr_func("_threaded_numa_first_touch");
+    }
+    return _threaded_numa_first_touch_ptr(ptr, size);
+}
+
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
 {
     load_daal_thr_dll();
@@ -105,9 +105,15 @@ private:
 
     #define DAAL_ITTNOTIFY_UNIQUE_ID __LINE__
 
-    #define DAAL_ITTNOTIFY_DOMAIN(name)
-    #define DAAL_ITTNOTIFY_SCOPED_TASK(name) \
-        daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_taks__, DAAL_ITTNOTIFY_UNIQUE_ID) = daal::internal::Profiler::startTask(#name);
+    // There must be only one domain on the translation unit regarding to this macro
+    #define DAAL_ITTNOTIFY_DOMAIN(name)                   \
+        static inline const char * __profiler_domain(int) \
+        {                                                 \
+            return #name;                                 \
+        }
+    #define DAAL_ITTNOTIFY_SCOPED_TASK(name)                                                              \
+        daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_taks__, DAAL_ITTNOTIFY_UNIQUE_ID) = \
+            daal::internal::Profiler::startTask(__profiler_domain(0), #name);
 
 #endif // __DAAL_ITTNOTIFY_ENABLE__
 #endif // __SERVICE_ITTNOTIFY_H__
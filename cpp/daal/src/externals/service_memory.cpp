@@ -31,12 +31,17 @@ void * daal::services::daal_malloc(size_t size, size_t alignment)
 
 void * daal::services::daal_calloc(size_t size, size_t alignment)
 {
-    void * ptr = daal::services::daal_malloc(size, alignment);
+    void * ptr = daal::internal::Service<>::serv_malloc(size, alignment);
     if (ptr == NULL)
     {
         return NULL;
     }
 
+    if (daal::threaded_numa_first_touch(ptr, size))
+    {
+        return ptr;
+    }
+
     char * cptr = (char *)ptr;
 
     for (size_t i = 0; i < size; i++)
@@ -38,21 +38,7 @@ namespace internal
 template <typename T, CpuType cpu>
 T * service_calloc(size_t size, size_t alignment = 64)
 {
-    T * ptr = (T *)daal::services::daal_malloc(size * sizeof(T), alignment);
-    if (ptr == NULL)
-    {
-        return NULL;
-    }
-
-    char * const cptr        = (char *)ptr;
-    const size_t sizeInBytes = size * sizeof(T);
-
-    for (size_t i = 0; i < sizeInBytes; i++)
-    {
-        cptr[i] = '\0';
-    }
-
-    return ptr;
+    return (T *)daal::services::daal_calloc(size * sizeof(T), alignment);
 }
 
 template <typename T, CpuType cpu>
@@ -77,8 +63,13 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
         return NULL;
     }
 
-    char * const cptr        = (char *)ptr;
     const size_t sizeInBytes = size * sizeof(T);
+    if (threaded_numa_first_touch(ptr, sizeInBytes))
+    {
+        return ptr;
+    }
+
+    char * const cptr = (char *)ptr;
 
     for (size_t i = 0; i < sizeInBytes; i++)
     {
@@ -15,18 +15,340 @@
 * limitations under the License.
 *******************************************************************************/
 
+/*
+//++
+//  Implementation of the profiler for time measurement of kernels.
+//  Every thread keeps the stack of its running tasks, the statistics of its
+//  finished tasks and the ring buffer of the last finished tasks. The data of
+//  all the threads is merged at exit.
+//--
+*/
+
 #include "src/externals/service_profiler.h"
+#include "src/algorithms/service_threading.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 namespace daal
 {
 namespace internal
 {
+namespace
+{
+const size_t profilerRingCapacity  = size_t(1) << 16; /* number of the last finished tasks recorded by a thread */
+const size_t profilerStatsCapacity = size_t(1) << 10; /* number of distinct tasks per thread, power of 2 */
+const size_t profilerMaxDepth      = 128;             /* tasks nested deeper are not measured */
+
+struct ProfilerEvent
+{
+    const char * domain;
+    const char * name;
+    int64_t start;
+    int64_t end;
+    size_t depth;
+};
+
+struct ProfilerStat
+{
+    const char * domain;
+    const char * name;
+    size_t count;
+    int64_t total;
+    int64_t self;     /* total minus the time of the nested tasks */
+    int64_t topLevel; /* time of the calls that are not nested into a task of the same domain */
+    int64_t min;
+    int64_t max;
+};
+
+struct ProfilerFrame
+{
+    const char * domain;
+    const char * name;
+    int64_t start;
+    int64_t children;
+};
+
+inline int64_t profilerNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char * profilerTraceFile()
+{
+    const char * const value = ::getenv("DAAL_PROFILER_TRACE");
+    return (value && value[0]) ? value : nullptr;
+}
+
+bool profilerEnabled()
+{
+    const char * const value = ::getenv("DAAL_PROFILER");
+    return (value && value[0] && ::strcmp(value, "0")) || profilerTraceFile();
+}
+
+class ThreadProfile
+{
+public:
+    explicit ThreadProfile(size_t id) : _id(id), _nEvents(0), _depth(0)
+    {
+        ::memset(_stats, 0, sizeof(_stats));
+        _events = new ProfilerEvent[profilerRingCapacity];
+    }
+
+    ~ThreadProfile() { delete[] _events; }
+
+    void start(const char * domain, const char * name)
+    {
+        if (_depth < profilerMaxDepth)
+        {
+            ProfilerFrame & frame = _stack[_depth];
+            frame.domain          = domain;
+            frame.name            = name;
+            frame.children        = 0;
+            frame.start           = profilerNow();
+        }
+        ++_depth;
+    }
+
+    void end()
+    {
+        if (!_depth) return;
+        --_depth;
+        if (_depth >= profilerMaxDepth) return;
+        const int64_t now           = profilerNow();
+        const ProfilerFrame & frame = _stack[_depth];
+        const int64_t duration      = now - frame.start;
+        const bool bTopLevel        = !_depth || (_stack[_depth - 1].domain != frame.domain && ::strcmp(_stack[_depth - 1].domain, frame.domain));
+        if (_depth) _stack[_depth - 1].children += duration;
+
+        ProfilerEvent & event = _events[_nEvents++ % profilerRingCapacity];
+        event.domain          = frame.domain;
+        event.name            = frame.name;
+        event.start           = frame.start;
+        event.end             = now;
+        event.depth           = _depth;
+
+        ProfilerStat * const stat = findStat(frame.domain, frame.name);
+        if (!stat) return;
+        if (!stat->count || stat->min > duration) stat->min = duration;
+        if (stat->max < duration) stat->max = duration;
+        ++stat->count;
+        stat->total += duration;
+        stat->self += duration - frame.children;
+        if (bTopLevel) stat->topLevel += duration;
+    }
+
+    size_t id() const { return _id; }
+    size_t numberOfEvents() const { return _nEvents < profilerRingCapacity ? _nEvents : profilerRingCapacity; }
+    const ProfilerEvent & event(size_t i) const { return _events[(_nEvents - numberOfEvents() + i) % profilerRingCapacity]; }
+    const ProfilerStat * stats() const { return _stats; }
+
+private:
+    /* names of the tasks are string literals, so the search is by the address */
+    ProfilerStat * findStat(const char * domain, const char * name)
+    {
+        size_t i = ((size_t(name) >> 3) ^ (size_t(domain) >> 5)) & (profilerStatsCapacity - 1);
+        for (size_t n = 0; n < profilerStatsCapacity; ++n, i = (i + 1) & (profilerStatsCapacity - 1))
+        {
+            ProfilerStat & stat = _stats[i];
+            if (stat.name == name && stat.domain == domain) return &stat;
+            if (!stat.name)
+            {
+                stat.name   = name;
+                stat.domain = domain;
+                return &stat;
+            }
+        }
+        return nullptr;
+    }
+
+    const size_t _id;
+    ProfilerEvent * _events;
+    size_t _nEvents;
+    ProfilerFrame _stack[profilerMaxDepth];
+    size_t _depth;
+    ProfilerStat _stats[profilerStatsCapacity];
+};
+
+/* Keeps the profiles of all the threads and writes the report at exit */
+class ProfilerRegistry
+{
+public:
+    static ProfilerRegistry & get()
+    {
+        static ProfilerRegistry registry;
+        return registry;
+    }
+
+    ~ProfilerRegistry()
+    {
+        if (_nProfiles)
+        {
+            report();
+            const char * const traceFile = profilerTraceFile();
+            if (traceFile) writeTrace(traceFile);
+        }
+        for (size_t i = 0; i < _nProfiles; ++i) delete _profiles[i];
+        delete[] _profiles;
+    }
+
+    ThreadProfile * add()
+    {
+        AUTOLOCK(_mutex);
+        if (_nProfiles == _capacity)
+        {
+            const size_t capacity     = _capacity ? 2 * _capacity : 64;
+            ThreadProfile ** profiles = new ThreadProfile *[capacity];
+            for (size_t i = 0; i < _nProfiles; ++i) profiles[i] = _profiles[i];
+            delete[] _profiles;
+            _profiles = profiles;
+            _capacity = capacity;
+        }
+        _profiles[_nProfiles] = new ThreadProfile(_nProfiles);
+        return _profiles[_nProfiles++];
+    }
+
+private:
+    ProfilerRegistry() : _profiles(nullptr), _nProfiles(0), _capacity(0) {}
+
+    static int compareByTotal(const void * a, const void * b)
+    {
+        const int64_t ta = static_cast<const ProfilerStat *>(a)->total;
+        const int64_t tb = static_cast<const ProfilerStat *>(b)->total;
+        return (ta < tb) - (tb < ta);
+    }
+
+    /* Merges the statistics of the tasks with the same domain and name collected by the threads */
+    size_t mergeStats(ProfilerStat * merged, bool bByDomain) const
+    {
+        size_t nMerged = 0;
+        for (size_t iProfile = 0; iProfile < _nProfiles; ++iProfile)
+        {
+            const ProfilerStat * const stats = _profiles[iProfile]->stats();
+            for (size_t i = 0; i < profilerStatsCapacity; ++i)
+            {
+                const ProfilerStat & stat = stats[i];
+                if (!stat.count || (bByDomain && !stat.topLevel)) continue;
+                size_t j = 0;
+                for (; j < nMerged && (::strcmp(merged[j].domain, stat.domain) || (!bByDomain && ::strcmp(merged[j].name, stat.name))); ++j)
+                    ;
+                if (j == nMerged)
+                {
+                    merged[nMerged++] = stat;
+                    if (bByDomain) merged[j].total = stat.topLevel;
+                    continue;
+                }
+                ProfilerStat & m = merged[j];
+                if (m.min > stat.min) m.min = stat.min;
+                if (m.max < stat.max) m.max = stat.max;
+                m.count += stat.count;
+                m.total += bByDomain ? stat.topLevel : stat.total;
+                m.self += stat.self;
+                m.topLevel += stat.topLevel;
+            }
+        }
+        ::qsort(merged, nMerged, sizeof(ProfilerStat), compareByTotal);
+        return nMerged;
+    }
+
+    void report() const
+    {
+        ProfilerStat * merged = new ProfilerStat[_nProfiles * profilerStatsCapacity];
+
+        const size_t nDomains = mergeStats(merged, true);
+        ::fprintf(stderr, "DAAL profiler: time by domain (not nested tasks)\n");
+        ::fprintf(stderr, "%-48s %14s\n", "domain", "total ms");
+        for (size_t i = 0; i < nDomains; ++i) ::fprintf(stderr, "%-48s %14.3f\n", merged[i].domain, double(merged[i].total) * 1e-6);
+
+        const size_t nTasks = mergeStats(merged, false);
+        ::fprintf(stderr, "DAAL profiler: time by task\n");
+        ::fprintf(stderr, "%-40s %-40s %10s %14s %14s %12s %12s\n", "domain", "task", "calls", "total ms", "self ms", "min us", "max us");
+        for (size_t i = 0; i < nTasks; ++i)
+        {
+            const ProfilerStat & stat = merged[i];
+            ::fprintf(stderr, "%-40s %-40s %10lu %14.3f %14.3f %12.3f %12.3f\n", stat.domain, stat.name, (unsigned long)stat.count,
+                      double(stat.total) * 1e-6, double(stat.self) * 1e-6, double(stat.min) * 1e-3, double(stat.max) * 1e-3);
+        }
+        delete[] merged;
+    }
+
+    void writeTrace(const char * traceFile) const
+    {
+        FILE * const file = ::fopen(traceFile, "w");
+        if (!file)
+        {
+            ::fprintf(stderr, "DAAL profiler: cannot open %s\n", traceFile);
+            return;
+        }
+        int64_t origin = 0;
+        bool bFirst    = true;
+        for (size_t iProfile = 0; iProfile < _nProfiles; ++iProfile)
+        {
+            const ThreadProfile & profile = *_profiles[iProfile];
+            for (size_t i = 0; i < profile.numberOfEvents(); ++i)
+            {
+                if (bFirst || origin > profile.event(i).start) origin = profile.event(i).start;
+                bFirst = false;
+            }
+        }
+        ::fprintf(file, "{\"traceEvents\":[");
+        bFirst = true;
+        for (size_t iProfile = 0; iProfile < _nProfiles; ++iProfile)
+        {
+            const ThreadProfile & profile = *_profiles[iProfile];
+            for (size_t i = 0; i < profile.numberOfEvents(); ++i)
+            {
+                const ProfilerEvent & event = profile.event(i);
+                ::fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%lu}", bFirst ? "" : ",",
+                          event.name, event.domain, double(event.start - origin) * 1e-3, double(event.end - event.start) * 1e-3,
+                          (unsigned long)profile.id());
+                bFirst = false;
+            }
+        }
+        ::fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+        ::fclose(file);
+    }
+
+    Mutex _mutex;
+    ThreadProfile ** _profiles;
+    size_t _nProfiles;
+    size_t _capacity;
+};
+
+const bool isProfilerEnabled = profilerEnabled();
+thread_local ThreadProfile * threadProfile = nullptr;
+
+inline ThreadProfile * getThreadProfile()
+{
+    if (!threadProfile) threadProfile = ProfilerRegistry::get().add();
+    return threadProfile;
+}
+
+} // namespace
+
 ProfilerTask Profiler::startTask(const char * taskName)
 {
+    return startTask("", taskName);
+}
+
+ProfilerTask Profiler::startTask(const char * domainName, const char * taskName)
+{
+    if (!isProfilerEnabled) return ProfilerTask(nullptr);
+    getThreadProfile()->start(domainName, taskName);
     return ProfilerTask(taskName);
 }
 
-void Profiler::endTask(const char * taskName) {}
+void Profiler::endTask(const char * taskName)
+{
+    if (isProfilerEnabled && taskName) getThreadProfile()->end();
+}
+
+bool Profiler::isEnabled()
+{
+    return isProfilerEnabled;
+}
 
 ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
 
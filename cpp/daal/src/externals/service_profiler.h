@@ -21,6 +21,9 @@
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
 namespace daal
 {
 namespace internal
@@ -35,13 +38,27 @@ private:
     const char * _taskName;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
+// Built-in profiler of the library. It is disabled unless the DAAL_PROFILER environment variable is set
+// to a value other than 0, in this case the aggregated statistics of the tasks are printed to stderr at exit.
+// The DAAL_PROFILER_TRACE environment variable enables the profiler and sets the file to write the tasks
+// recorded by the threads to in the Chrome trace event format (chrome://tracing, Perfetto).
+// The class can be redefined in the benchmarks.
 class Profiler
 {
 public:
     static ProfilerTask startTask(const char * taskName);
+    static ProfilerTask startTask(const char * domainName, const char * taskName);
     static void endTask(const char * taskName);
+    static bool isEnabled();
 };
 
 } // namespace internal
 } // namespace daal
+
+// Name of the domain of the profiler tasks when there is no DAAL_ITTNOTIFY_DOMAIN in the translation unit
+inline const char * __profiler_domain(...)
+{
+    return "";
+}
+
+#endif
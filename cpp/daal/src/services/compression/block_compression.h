@@ -0,0 +1,265 @@
+/* file: block_compression.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Framing of the input data into the blocks compressed and decompressed in parallel.
+//  Each compressed block consists of a header with two sections: 1) uncompressed data size (4 bytes)
+//  and 2) compressed data size (4 bytes), followed by the compressed data. The block is stored
+//  uncompressed if both sizes in its header are equal.
+//--
+*/
+
+#ifndef __BLOCK_COMPRESSION_H__
+#define __BLOCK_COMPRESSION_H__
+
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+#include "services/daal_memory.h"
+#include "src/services/service_arrays.h"
+#include "src/threading/threading.h"
+#include <climits>
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+using daal::services::internal::TArray;
+
+const size_t blockHeaderBytes = 8;
+const size_t maxBlockSize     = (size_t)1 << 30;
+
+/* Errors reported by the block compression of a particular method */
+struct BlockCompressionErrors
+{
+    services::ErrorID internal;       /* Internal error of the method */
+    services::ErrorID dataFormat;     /* Compressed block is corrupted */
+    services::ErrorID lessThenHeader; /* Compressed stream ends inside the header of a block */
+    services::ErrorID notFullBlock;   /* Compressed stream ends inside the data of a block */
+};
+
+inline unsigned int readBlockHeader32(const byte * p)
+{
+    return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+inline void writeBlockHeader32(byte * p, unsigned int value)
+{
+    p[0] = (byte)(value);
+    p[1] = (byte)(value >> 8);
+    p[2] = (byte)(value >> 16);
+    p[3] = (byte)(value >> 24);
+}
+
+/**
+ *  Compresses the input data split into the blocks of blockSize bytes. The blocks are compressed independently and in parallel.
+ *  Codec provides the following methods callable from several threads at once:
+ *  - size_t bound(size_t size): maximal size of the compressed block of the given size,
+ *  - size_t compress(const byte * src, size_t srcSize, byte * dst, size_t dstCapacity): size of the compressed block, 0 on failure.
+ *
+ *  \param[in]  codec     Compression method of the blocks
+ *  \param[in]  in        Input data
+ *  \param[in]  inLen     Size of the input data in bytes
+ *  \param[in]  blockSize Size in bytes of the blocks the input data is split into
+ *  \param[in]  errorIds  Errors reported by the method
+ *  \param[out] errors    Collection of errors
+ *  \param[out] outLen    Size of the compressed data in bytes
+ *  \return Compressed data allocated with daal_malloc, NULL on failure
+ */
+template <typename Codec>
+byte * compressBlocks(Codec & codec, const byte * in, size_t inLen, size_t blockSize, const BlockCompressionErrors & errorIds,
+                      services::ErrorCollection & errors, size_t & outLen)
+{
+    outLen                         = 0;
+    const size_t nBlocks           = (inLen + blockSize - 1) / blockSize;
+    const size_t maxCompressedSize = blockHeaderBytes + codec.bound(blockSize);
+    if (nBlocks > (size_t)INT_MAX || nBlocks > ((size_t)-1) / maxCompressedSize)
+    {
+        errors.add(errorIds.internal);
+        return NULL;
+    }
+
+    TArray<byte, sse2> blocks(nBlocks * maxCompressedSize);
+    TArray<size_t, sse2> offsets(nBlocks + 1);
+    if (!blocks.get() || !offsets.get())
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return NULL;
+    }
+
+    /* Blocks are compressed independently, each one into its own slot of the maximal compressed size */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
+        const size_t start = i * blockSize;
+        const size_t size  = (inLen - start < blockSize) ? inLen - start : blockSize;
+        byte * dst         = blocks.get() + i * maxCompressedSize;
+
+        size_t compressedSize = codec.compress(in + start, size, dst + blockHeaderBytes, maxCompressedSize - blockHeaderBytes);
+        if (compressedSize == 0 || compressedSize >= size)
+        {
+            for (size_t j = 0; j < size; j++) dst[blockHeaderBytes + j] = in[start + j];
+            compressedSize = size;
+        }
+        writeBlockHeader32(dst, (unsigned int)size);
+        writeBlockHeader32(dst + 4, (unsigned int)compressedSize);
+        offsets[i + 1] = blockHeaderBytes + compressedSize;
+    });
+
+    offsets[0] = 0;
+    for (size_t i = 0; i < nBlocks; i++) offsets[i + 1] += offsets[i];
+
+    byte * packed = (byte *)daal::services::daal_malloc(offsets[nBlocks]);
+    if (packed == NULL)
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return NULL;
+    }
+
+    /* Compressed blocks are packed into the output one after another */
+    int result = 0;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
+        const size_t size = offsets[i + 1] - offsets[i];
+        if (daal::services::internal::daal_memcpy_s(packed + offsets[i], size, blocks.get() + i * maxCompressedSize, size)) result = 1;
+    });
+    if (result)
+    {
+        daal::services::daal_free(packed);
+        errors.add(services::ErrorMemoryCopyFailedInternal);
+        return NULL;
+    }
+
+    outLen = offsets[nBlocks];
+    return packed;
+}
+
+/**
+ *  Decompresses the blocks of the compressed data in parallel after the headers of all the blocks are validated.
+ *  Codec provides the following method callable from several threads at once:
+ *  - bool decompress(const byte * src, size_t srcSize, byte * dst, size_t dstSize):
+ *    true if the block is decompressed into exactly dstSize bytes, false if the data is corrupted.
+ *
+ *  \param[in]  codec       Compression method of the blocks
+ *  \param[in]  in          Compressed data
+ *  \param[in]  inLen       Size of the compressed data in bytes
+ *  \param[out] out         Output data block, the decompressed data is written there directly if it fits
+ *  \param[in]  outCapacity Size of the output data block in bytes
+ *  \param[in]  errorIds    Errors reported by the method
+ *  \param[out] errors      Collection of errors
+ *  \param[out] buff        Decompressed data allocated with daal_malloc if it does not fit into the output, NULL otherwise
+ *  \param[out] outLen      Size of the decompressed data in bytes
+ */
+template <typename Codec>
+void decompressBlocks(Codec & codec, const byte * in, size_t inLen, byte * out, size_t outCapacity, const BlockCompressionErrors & errorIds,
+                      services::ErrorCollection & errors, byte *& buff, size_t & outLen)
+{
+    buff   = NULL;
+    outLen = 0;
+
+    /* Headers are validated and counted before any block is decompressed */
+    size_t nBlocks = 0;
+    size_t total   = 0;
+    for (size_t pos = 0; pos < inLen; nBlocks++)
+    {
+        if (inLen - pos < blockHeaderBytes)
+        {
+            errors.add(errorIds.lessThenHeader);
+            return;
+        }
+        const size_t size           = readBlockHeader32(in + pos);
+        const size_t compressedSize = readBlockHeader32(in + pos + 4);
+        if (size == 0 || compressedSize == 0 || compressedSize > size)
+        {
+            errors.add(errorIds.dataFormat);
+            return;
+        }
+        if (inLen - pos - blockHeaderBytes < compressedSize)
+        {
+            errors.add(errorIds.notFullBlock);
+            return;
+        }
+        pos += blockHeaderBytes + compressedSize;
+        total += size;
+    }
+    if (nBlocks > (size_t)INT_MAX)
+    {
+        errors.add(errorIds.internal);
+        return;
+    }
+
+    TArray<size_t, sse2> inOffsets(nBlocks);
+    TArray<size_t, sse2> outOffsets(nBlocks);
+    TArray<byte, sse2> isCorrupted(nBlocks);
+    if (!inOffsets.get() || !outOffsets.get() || !isCorrupted.get())
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    for (size_t i = 0, pos = 0, outPos = 0; i < nBlocks; i++)
+    {
+        inOffsets[i]  = pos;
+        outOffsets[i] = outPos;
+        outPos += readBlockHeader32(in + pos);
+        pos += blockHeaderBytes + readBlockHeader32(in + pos + 4);
+    }
+
+    /* Decompressed data is written directly into the output when it fits there */
+    byte * dst = out;
+    if (total > outCapacity)
+    {
+        buff = (byte *)daal::services::daal_malloc(total);
+        if (buff == NULL)
+        {
+            errors.add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        dst = buff;
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
+        const byte * src            = in + inOffsets[i];
+        const size_t size           = readBlockHeader32(src);
+        const size_t compressedSize = readBlockHeader32(src + 4);
+        if (compressedSize == size)
+        {
+            for (size_t j = 0; j < size; j++) dst[outOffsets[i] + j] = src[blockHeaderBytes + j];
+            isCorrupted[i] = 0;
+        }
+        else
+        {
+            isCorrupted[i] = !codec.decompress(src + blockHeaderBytes, compressedSize, dst + outOffsets[i], size);
+        }
+    });
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        if (isCorrupted[i])
+        {
+            if (buff) daal::services::daal_free(buff);
+            buff = NULL;
+            errors.add(errorIds.dataFormat);
+            return;
+        }
+    }
+    outLen = total;
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -0,0 +1,462 @@
+/* file: lz4compression.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LZ4 (de-)compression method.
+//--
+*/
+
+#include "data_management/compression/lz4compression.h"
+#include "src/services/compression/block_compression.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace
+{
+/* Constants of the LZ4 block format */
+const size_t lz4MinMatch     = 4;
+const size_t lz4LastLiterals = 5;  /* Last bytes of the block are always stored as literals */
+const size_t lz4MatchLimit   = 12; /* Last match starts at least this number of bytes before the end of the block */
+const size_t lz4MaxOffset    = 65535;
+const size_t lz4HashLog      = 12;
+const size_t lz4SkipTrigger  = 6; /* Search step grows after 2^lz4SkipTrigger misses in a row to pass incompressible data faster */
+
+const internal::BlockCompressionErrors lz4Errors = { services::ErrorLz4Internal, services::ErrorLz4DataFormat,
+                                                     services::ErrorLz4DataFormatLessThenHeader, services::ErrorLz4DataFormatNotFullBlock };
+
+inline unsigned int read32(const byte * p)
+{
+    return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+inline size_t lz4Hash(unsigned int sequence)
+{
+    return (size_t)((sequence * 2654435761U) >> (32 - lz4HashLog));
+}
+
+inline size_t lz4CompressBound(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+inline byte * lz4WriteLength(byte * op, size_t length)
+{
+    for (; length >= 255; length -= 255) *op++ = 255;
+    *op++ = (byte)length;
+    return op;
+}
+
+inline byte * lz4WriteLiterals(byte * op, byte * token, const byte * literals, size_t nLiterals)
+{
+    *token = (byte)((nLiterals < 15 ? nLiterals : 15) << 4);
+    if (nLiterals >= 15) op = lz4WriteLength(op, nLiterals - 15);
+    for (size_t i = 0; i < nLiterals; i++) op[i] = literals[i];
+    return op + nLiterals;
+}
+
+/**
+ *  Compresses the block into the LZ4 block format with the greedy search of matches in the hash table of the recent positions
+ *  \return Size of the compressed data, at most lz4CompressBound(srcSize)
+ */
+size_t lz4CompressBlock(const byte * src, size_t srcSize, byte * dst)
+{
+    /* Positions in the block are stored incremented by one, zero marks the empty entry */
+    unsigned int hashTable[(size_t)1 << lz4HashLog];
+    for (size_t i = 0; i < ((size_t)1 << lz4HashLog); i++) hashTable[i] = 0;
+
+    byte * op     = dst;
+    size_t anchor = 0;
+    if (srcSize > lz4MatchLimit)
+    {
+        const size_t ipLimit    = srcSize - lz4MatchLimit;
+        const size_t matchLimit = srcSize - lz4LastLiterals;
+        size_t ip               = 0;
+        size_t nMisses          = 0;
+        while (ip <= ipLimit)
+        {
+            const unsigned int sequence = read32(src + ip);
+            const size_t h              = lz4Hash(sequence);
+            const size_t candidate      = hashTable[h];
+            hashTable[h]                = (unsigned int)(ip + 1);
+
+            if (!candidate || ip + 1 - candidate > lz4MaxOffset || read32(src + candidate - 1) != sequence)
+            {
+                ip += 1 + (nMisses++ >> lz4SkipTrigger);
+                continue;
+            }
+            nMisses = 0;
+
+            size_t ref = candidate - 1;
+            while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1])
+            {
+                ip--;
+                ref--;
+            }
+            size_t length = lz4MinMatch;
+            while (ip + length < matchLimit && src[ip + length] == src[ref + length]) length++;
+
+            byte * token        = op++;
+            op                  = lz4WriteLiterals(op, token, src + anchor, ip - anchor);
+            const size_t offset = ip - ref;
+            *op++               = (byte)(offset);
+            *op++               = (byte)(offset >> 8);
+            const size_t extra  = length - lz4MinMatch;
+            *token |= (byte)(extra < 15 ? extra : 15);
+            if (extra >= 15) op = lz4WriteLength(op, extra - 15);
+
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    byte * token = op++;
+    op           = lz4WriteLiterals(op, token, src + anchor, srcSize - anchor);
+    return (size_t)(op - dst);
+}
+
+/**
+ *  Decompresses the block in the LZ4 block format with the bounds checks of the input and output
+ *  \return True if the block is decompressed into exactly dstSize bytes, false if the data is corrupted
+ */
+bool lz4DecompressBlock(const byte * src, size_t srcSize, byte * dst, size_t dstSize)
+{
+    size_t ip = 0;
+    size_t op = 0;
+    while (ip < srcSize)
+    {
+        const size_t token = src[ip++];
+
+        size_t nLiterals = token >> 4;
+        if (nLiterals == 15)
+        {
+            byte s = 255;
+            while (s == 255)
+            {
+                if (ip >= srcSize) return false;
+                s = src[ip++];
+                nLiterals += s;
+            }
+        }
+        if (nLiterals > srcSize - ip || nLiterals > dstSize - op) return false;
+        for (size_t i = 0; i < nLiterals; i++) dst[op + i] = src[ip + i];
+        ip += nLiterals;
+        op += nLiterals;
+
+        /* The last sequence of the block contains literals only */
+        if (ip == srcSize) break;
+
+        if (srcSize - ip < 2) return false;
+        const size_t offset = (size_t)src[ip] | ((size_t)src[ip + 1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t length = (token & 15) + lz4MinMatch;
+        if ((token & 15) == 15)
+        {
+            byte s = 255;
+            while (s == 255)
+            {
+                if (ip >= srcSize) return false;
+                s = src[ip++];
+                length += s;
+            }
+        }
+        if (length > dstSize - op) return false;
+
+        /* The match may overlap the bytes being written, so it is copied forward byte by byte */
+        const byte * match = dst + op - offset;
+        for (size_t i = 0; i < length; i++) dst[op + i] = match[i];
+        op += length;
+    }
+    return (op == dstSize);
+}
+
+/* LZ4 block format codec of the block compression */
+struct Lz4BlockCodec
+{
+    size_t bound(size_t size) const { return lz4CompressBound(size); }
+    size_t compress(const byte * src, size_t srcSize, byte * dst, size_t) const { return lz4CompressBlock(src, srcSize, dst); }
+    bool decompress(const byte * src, size_t srcSize, byte * dst, size_t dstSize) const { return lz4DecompressBlock(src, srcSize, dst, dstSize); }
+};
+
+} // namespace
+
+Compressor<lz4>::Compressor() : data_management::CompressorImpl()
+{
+    _next_in         = NULL;
+    _avail_in        = 0;
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _isInitialized   = false;
+}
+
+void Compressor<lz4>::initialize()
+{
+    _isInitialized = true;
+}
+
+Compressor<lz4>::~Compressor()
+{
+    finalizeCompression();
+}
+
+void Compressor<lz4>::finalizeCompression()
+{
+    if (_internalBuff != NULL)
+    {
+        daal::services::daal_free(_internalBuff);
+    }
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _next_in         = NULL;
+    _avail_in        = 0;
+}
+
+void Compressor<lz4>::setInputDataBlock(byte * in, size_t len, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        initialize();
+    }
+
+    finalizeCompression();
+    checkInputParams(in, len);
+    if (parameter.blockSize == 0 || parameter.blockSize > internal::maxBlockSize)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+    }
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    _avail_in = len;
+    _next_in  = in + off;
+}
+
+void Compressor<lz4>::compressBlocks()
+{
+    Lz4BlockCodec codec;
+    _internalBuff =
+        internal::compressBlocks(codec, (const byte *)_next_in, _avail_in, parameter.blockSize, lz4Errors, *this->_errors, _internalBuffLen);
+    if (_internalBuff == NULL)
+    {
+        return;
+    }
+
+    _internalBuffOff = 0;
+    _next_in         = NULL;
+    _avail_in        = 0;
+}
+
+void Compressor<lz4>::run(byte * out, size_t outLen, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+
+    checkOutputParams(out, outLen);
+    if (this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    this->_isOutBlockFull   = 0;
+    this->_usedOutBlockSize = 0;
+
+    if (_avail_in > 0)
+    {
+        compressBlocks();
+        if (this->_errors->size() != 0)
+        {
+            finalizeCompression();
+            return;
+        }
+    }
+
+    const size_t leftSize = _internalBuffLen - _internalBuffOff;
+    const size_t copySize = (outLen < leftSize) ? outLen : leftSize;
+    if (copySize > 0)
+    {
+        int result = daal::services::internal::daal_memcpy_s(out + off, outLen, (byte *)_internalBuff + _internalBuffOff, copySize);
+        if (result)
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+    }
+
+    _internalBuffOff += copySize;
+    this->_usedOutBlockSize = copySize;
+    if (_internalBuffOff < _internalBuffLen)
+    {
+        this->_isOutBlockFull = 1;
+    }
+    else
+    {
+        finalizeCompression();
+    }
+}
+
+Decompressor<lz4>::Decompressor() : data_management::DecompressorImpl()
+{
+    _next_in         = NULL;
+    _avail_in        = 0;
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _isInitialized   = false;
+}
+
+void Decompressor<lz4>::initialize()
+{
+    _isInitialized = true;
+}
+
+Decompressor<lz4>::~Decompressor()
+{
+    finalizeCompression();
+}
+
+void Decompressor<lz4>::finalizeCompression()
+{
+    if (_internalBuff != NULL)
+    {
+        daal::services::daal_free(_internalBuff);
+    }
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _next_in         = NULL;
+    _avail_in        = 0;
+}
+
+void Decompressor<lz4>::setInputDataBlock(byte * in, size_t len, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        initialize();
+    }
+
+    finalizeCompression();
+    checkInputParams(in, len);
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    if (len <= internal::blockHeaderBytes)
+    {
+        this->_errors->add(services::ErrorLz4DataFormatLessThenHeader);
+        return;
+    }
+
+    _avail_in = len;
+    _next_in  = in + off;
+}
+
+void Decompressor<lz4>::decompressBlocks(byte * out, size_t outLen)
+{
+    Lz4BlockCodec codec;
+    byte * buff  = NULL;
+    size_t total = 0;
+    internal::decompressBlocks(codec, (const byte *)_next_in, _avail_in, out, outLen, lz4Errors, *this->_errors, buff, total);
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    if (buff == NULL)
+    {
+        this->_usedOutBlockSize = total;
+    }
+    else
+    {
+        _internalBuff    = buff;
+        _internalBuffLen = total;
+        _internalBuffOff = 0;
+    }
+    _next_in  = NULL;
+    _avail_in = 0;
+}
+
+void Decompressor<lz4>::run(byte * out, size_t outLen, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+
+    checkOutputParams(out, outLen);
+    if (this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    this->_isOutBlockFull   = 0;
+    this->_usedOutBlockSize = 0;
+
+    if (_internalBuffOff == _internalBuffLen && _avail_in > 0)
+    {
+        decompressBlocks(out + off, outLen);
+        if (this->_errors->size() != 0)
+        {
+            finalizeCompression();
+            return;
+        }
+    }
+
+    const size_t leftSize = _internalBuffLen - _internalBuffOff;
+    const size_t availOut = outLen - this->_usedOutBlockSize;
+    const size_t copySize = (availOut < leftSize) ? availOut : leftSize;
+    if (copySize > 0)
+    {
+        int result = daal::services::internal::daal_memcpy_s(out + off + this->_usedOutBlockSize, availOut,
+                                                             (byte *)_internalBuff + _internalBuffOff, copySize);
+        if (result)
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+    }
+
+    _internalBuffOff += copySize;
+    this->_usedOutBlockSize += copySize;
+    if (_internalBuffOff < _internalBuffLen)
+    {
+        this->_isOutBlockFull = 1;
+    }
+    else
+    {
+        finalizeCompression();
+    }
+}
+
+} // namespace data_management
+} // namespace daal
@@ -0,0 +1,70 @@
+/* file: zstd_library.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Single translation unit build of the Zstandard library 1.5.7 located in the zstd directory
+//  (BSD license, see zstd/LICENSE). Only the single-threaded compression and decompression of
+//  the frames are built. The symbols of the library are hidden, so they do not clash with another
+//  copy of Zstandard loaded into the application.
+//--
+*/
+
+#define ZSTD_LEGACY_SUPPORT 0
+#define ZSTD_DISABLE_ASM    1
+#define ZSTD_TRACE          0
+#define DEBUGLEVEL          0
+#define XXH_NAMESPACE       ZSTD_
+#define XXH_PRIVATE_API
+#define XXH_INLINE_ALL
+
+/* Public functions of the library are hidden as well as the internal ones */
+#define ZSTDLIB_VISIBLE
+#define ZSTDERRORLIB_VISIBLE
+
+#if defined(__GNUC__)
+    #pragma GCC visibility push(hidden)
+#endif
+
+#include "src/services/compression/zstd/common/debug.c"
+#include "src/services/compression/zstd/common/entropy_common.c"
+#include "src/services/compression/zstd/common/error_private.c"
+#include "src/services/compression/zstd/common/fse_decompress.c"
+#include "src/services/compression/zstd/common/zstd_common.c"
+
+#include "src/services/compression/zstd/compress/fse_compress.c"
+#include "src/services/compression/zstd/compress/hist.c"
+#include "src/services/compression/zstd/compress/huf_compress.c"
+#include "src/services/compression/zstd/compress/zstd_compress_literals.c"
+#include "src/services/compression/zstd/compress/zstd_compress_sequences.c"
+#include "src/services/compression/zstd/compress/zstd_compress_superblock.c"
+#include "src/services/compression/zstd/compress/zstd_preSplit.c"
+#include "src/services/compression/zstd/compress/zstd_compress.c"
+#include "src/services/compression/zstd/compress/zstd_double_fast.c"
+#include "src/services/compression/zstd/compress/zstd_fast.c"
+#include "src/services/compression/zstd/compress/zstd_lazy.c"
+#include "src/services/compression/zstd/compress/zstd_ldm.c"
+#include "src/services/compression/zstd/compress/zstd_opt.c"
+
+#include "src/services/compression/zstd/decompress/huf_decompress.c"
+#include "src/services/compression/zstd/decompress/zstd_ddict.c"
+#include "src/services/compression/zstd/decompress/zstd_decompress.c"
+#include "src/services/compression/zstd/decompress/zstd_decompress_block.c"
+
+#if defined(__GNUC__)
+    #pragma GCC visibility pop
+#endif
@@ -0,0 +1,368 @@
+/* file: zstdcompression.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Zstandard (de-)compression method.
+//--
+*/
+
+#include "data_management/compression/zstdcompression.h"
+#include "src/services/compression/block_compression.h"
+#include "src/services/compression/zstd/zstd.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace
+{
+const int zstdDefaultLevel = 3;
+
+const internal::BlockCompressionErrors zstdErrors = { services::ErrorZstdInternal, services::ErrorZstdDataFormat,
+                                                      services::ErrorZstdDataFormatLessThenHeader, services::ErrorZstdDataFormatNotFullBlock };
+
+/* Zstandard frame codec of the block compression, the compression contexts are reused by the blocks compressed in the same thread.
+   The frames carry the checksum of their content, so the corrupted blocks are detected on decompression */
+class ZstdBlockCodec
+{
+public:
+    ZstdBlockCodec(CompressionLevel level)
+        : _level(level == defaultLevel ? zstdDefaultLevel : int(level) + 1), _contexts([=]() -> ZSTD_CCtx * { return createContext(_level); })
+    {}
+
+    ~ZstdBlockCodec()
+    {
+        _contexts.reduce([](ZSTD_CCtx * ctx) -> void { ZSTD_freeCCtx(ctx); });
+    }
+
+    size_t bound(size_t size) const { return ZSTD_compressBound(size); }
+
+    /* Returns 0 if the block is not compressed, then it is stored uncompressed */
+    size_t compress(const byte * src, size_t srcSize, byte * dst, size_t dstCapacity)
+    {
+        ZSTD_CCtx * const ctx = _contexts.local();
+        if (!ctx) return 0;
+        const size_t result = ZSTD_compress2(ctx, dst, dstCapacity, src, srcSize);
+        return ZSTD_isError(result) ? 0 : result;
+    }
+
+private:
+    static ZSTD_CCtx * createContext(int level)
+    {
+        ZSTD_CCtx * ctx = ZSTD_createCCtx();
+        if (ctx
+            && (ZSTD_isError(ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, level))
+                || ZSTD_isError(ZSTD_CCtx_setParameter(ctx, ZSTD_c_checksumFlag, 1))))
+        {
+            ZSTD_freeCCtx(ctx);
+            ctx = NULL;
+        }
+        return ctx;
+    }
+
+    int _level;
+    daal::tls<ZSTD_CCtx *> _contexts;
+};
+
+class ZstdBlockDecodec
+{
+public:
+    ZstdBlockDecodec() : _contexts([=]() -> ZSTD_DCtx * { return ZSTD_createDCtx(); }) {}
+
+    ~ZstdBlockDecodec()
+    {
+        _contexts.reduce([](ZSTD_DCtx * ctx) -> void { ZSTD_freeDCtx(ctx); });
+    }
+
+    bool decompress(const byte * src, size_t srcSize, byte * dst, size_t dstSize)
+    {
+        ZSTD_DCtx * const ctx = _contexts.local();
+        if (!ctx) return false;
+        const size_t result = ZSTD_decompressDCtx(ctx, dst, dstSize, src, srcSize);
+        return !ZSTD_isError(result) && result == dstSize;
+    }
+
+private:
+    daal::tls<ZSTD_DCtx *> _contexts;
+};
+
+} // namespace
+
+Compressor<zstd>::Compressor() : data_management::CompressorImpl()
+{
+    _next_in         = NULL;
+    _avail_in        = 0;
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _isInitialized   = false;
+}
+
+void Compressor<zstd>::initialize()
+{
+    _isInitialized = true;
+}
+
+Compressor<zstd>::~Compressor()
+{
+    finalizeCompression();
+}
+
+void Compressor<zstd>::finalizeCompression()
+{
+    if (_internalBuff != NULL)
+    {
+        daal::services::daal_free(_internalBuff);
+    }
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _next_in         = NULL;
+    _avail_in        = 0;
+}
+
+void Compressor<zstd>::setInputDataBlock(byte * in, size_t len, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        initialize();
+    }
+
+    finalizeCompression();
+    checkInputParams(in, len);
+    if (parameter.blockSize == 0 || parameter.blockSize > internal::maxBlockSize || parameter.level < defaultLevel
+        || parameter.level > lastCompressionLevel)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+    }
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    _avail_in = len;
+    _next_in  = in + off;
+}
+
+void Compressor<zstd>::compressBlocks()
+{
+    ZstdBlockCodec codec(parameter.level);
+    _internalBuff =
+        internal::compressBlocks(codec, (const byte *)_next_in, _avail_in, parameter.blockSize, zstdErrors, *this->_errors, _internalBuffLen);
+    if (_internalBuff == NULL)
+    {
+        return;
+    }
+
+    _internalBuffOff = 0;
+    _next_in         = NULL;
+    _avail_in        = 0;
+}
+
+void Compressor<zstd>::run(byte * out, size_t outLen, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        this->_errors->add(services::ErrorZstdInternal);
+        return;
+    }
+
+    checkOutputParams(out, outLen);
+    if (this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    this->_isOutBlockFull   = 0;
+    this->_usedOutBlockSize = 0;
+
+    if (_avail_in > 0)
+    {
+        compressBlocks();
+        if (this->_errors->size() != 0)
+        {
+            finalizeCompression();
+            return;
+        }
+    }
+
+    const size_t leftSize = _internalBuffLen - _internalBuffOff;
+    const size_t copySize = (outLen < leftSize) ? outLen : leftSize;
+    if (copySize > 0)
+    {
+        int result = daal::services::internal::daal_memcpy_s(out + off, outLen, (byte *)_internalBuff + _internalBuffOff, copySize);
+        if (result)
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+    }
+
+    _internalBuffOff += copySize;
+    this->_usedOutBlockSize = copySize;
+    if (_internalBuffOff < _internalBuffLen)
+    {
+        this->_isOutBlockFull = 1;
+    }
+    else
+    {
+        finalizeCompression();
+    }
+}
+
+Decompressor<zstd>::Decompressor() : data_management::DecompressorImpl()
+{
+    _next_in         = NULL;
+    _avail_in        = 0;
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _isInitialized   = false;
+}
+
+void Decompressor<zstd>::initialize()
+{
+    _isInitialized = true;
+}
+
+Decompressor<zstd>::~Decompressor()
+{
+    finalizeCompression();
+}
+
+void Decompressor<zstd>::finalizeCompression()
+{
+    if (_internalBuff != NULL)
+    {
+        daal::services::daal_free(_internalBuff);
+    }
+    _internalBuff    = NULL;
+    _internalBuffOff = 0;
+    _internalBuffLen = 0;
+    _next_in         = NULL;
+    _avail_in        = 0;
+}
+
+void Decompressor<zstd>::setInputDataBlock(byte * in, size_t len, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        initialize();
+    }
+
+    finalizeCompression();
+    checkInputParams(in, len);
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    if (len <= internal::blockHeaderBytes)
+    {
+        this->_errors->add(services::ErrorZstdDataFormatLessThenHeader);
+        return;
+    }
+
+    _avail_in = len;
+    _next_in  = in + off;
+}
+
+void Decompressor<zstd>::decompressBlocks(byte * out, size_t outLen)
+{
+    ZstdBlockDecodec codec;
+    byte * buff  = NULL;
+    size_t total = 0;
+    internal::decompressBlocks(codec, (const byte *)_next_in, _avail_in, out, outLen, zstdErrors, *this->_errors, buff, total);
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    if (buff == NULL)
+    {
+        this->_usedOutBlockSize = total;
+    }
+    else
+    {
+        _internalBuff    = buff;
+        _internalBuffLen = total;
+        _internalBuffOff = 0;
+    }
+    _next_in  = NULL;
+    _avail_in = 0;
+}
+
+void Decompressor<zstd>::run(byte * out, size_t outLen, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        this->_errors->add(services::ErrorZstdInternal);
+        return;
+    }
+
+    checkOutputParams(out, outLen);
+    if (this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    this->_isOutBlockFull   = 0;
+    this->_usedOutBlockSize = 0;
+
+    if (_internalBuffOff == _internalBuffLen && _avail_in > 0)
+    {
+        decompressBlocks(out + off, outLen);
+        if (this->_errors->size() != 0)
+        {
+            finalizeCompression();
+            return;
+        }
+    }
+
+    const size_t leftSize = _internalBuffLen - _internalBuffOff;
+    const size_t availOut = outLen - this->_usedOutBlockSize;
+    const size_t copySize = (availOut < leftSize) ? availOut : leftSize;
+    if (copySize > 0)
+    {
+        int result = daal::services::internal::daal_memcpy_s(out + off + this->_usedOutBlockSize, availOut,
+                                                             (byte *)_internalBuff + _internalBuffOff, copySize);
+        if (result)
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+    }
+
+    _internalBuffOff += copySize;
+    this->_usedOutBlockSize += copySize;
+    if (_internalBuffOff < _internalBuffLen)
+    {
+        this->_isOutBlockFull = 1;
+    }
+    else
+    {
+        finalizeCompression();
+    }
+}
+
+} // namespace data_management
+} // namespace daal
@@ -70,6 +70,9 @@
     DECLARE_DAAL_STRING_CONST(cosineDistance)                    \
     DECLARE_DAAL_STRING_CONST(quantiles)                         \
     DECLARE_DAAL_STRING_CONST(quantileOrders)                    \
+    DECLARE_DAAL_STRING_CONST(sketchSize)                        \
+    DECLARE_DAAL_STRING_CONST(sketchValues)                      \
+    DECLARE_DAAL_STRING_CONST(sketchLevelSizes)                  \
     DECLARE_DAAL_STRING_CONST(covariance)                        \
     DECLARE_DAAL_STRING_CONST(correlation)                       \
     DECLARE_DAAL_STRING_CONST(mean)                              \
@@ -149,6 +152,8 @@
     DECLARE_DAAL_STRING_CONST(kernelFunction)                    \
     DECLARE_DAAL_STRING_CONST(training)                          \
     DECLARE_DAAL_STRING_CONST(prediction)                        \
+    DECLARE_DAAL_STRING_CONST(predictionContributions)           \
+    DECLARE_DAAL_STRING_CONST(predictionInteractions)            \
     DECLARE_DAAL_STRING_CONST(labels)                            \
     DECLARE_DAAL_STRING_CONST(predictedLabels)                   \
     DECLARE_DAAL_STRING_CONST(probabilities)                     \
@@ -221,6 +226,8 @@
     DECLARE_DAAL_STRING_CONST(partialAssignments)                \
     DECLARE_DAAL_STRING_CONST(partialCandidatesDistances)        \
     DECLARE_DAAL_STRING_CONST(partialCandidatesCentroids)        \
+    DECLARE_DAAL_STRING_CONST(partialLowerBounds)                \
+    DECLARE_DAAL_STRING_CONST(partialBoundsCentroids)            \
     DECLARE_DAAL_STRING_CONST(assignments)                       \
     DECLARE_DAAL_STRING_CONST(partialClustersNumber)             \
     DECLARE_DAAL_STRING_CONST(gamma)                             \
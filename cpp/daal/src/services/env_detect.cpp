@@ -28,6 +28,7 @@
 #include "src/services/service_defines.h"
 #include "src/externals/service_service.h"
 #include "src/threading/threading.h"
+#include "src/services/service_scratch_arena.h"
 #include "services/error_indexes.h"
 
 #include "src/services/service_topo.h"
@@ -197,3 +198,14 @@ DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool ena
 #endif
     return;
 }
+
+DAAL_EXPORT void daal::services::Environment::enableNumaAwareAllocation(const bool enableNumaAwareAllocationFlag)
+{
+    initNumberOfThreads();
+    daal::threader_env()->setNumaAwareAllocation(enableNumaAwareAllocationFlag);
+}
+
+DAAL_EXPORT void daal::services::Environment::releaseScratchMemory()
+{
+    daal::services::internal::scratch_trim();
+}
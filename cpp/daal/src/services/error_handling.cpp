@@ -781,6 +781,7 @@ void ErrorMessageCollection::parseResourceFile()
 
     // KMeans errors: -6400..-6599
     add(ErrorKMeansNumberOfClustersIsTooLarge, "Number of clusters exceeds the number of points");
+    add(ErrorKMeansCategoricalFeaturesAreNotSupported, "Categorical features are not supported by the computation method");
 
     // Linear Rergession errors: -6600..-6799
     add(ErrorLinearRegressionInternal, "Linear Regression internal error");
@@ -864,6 +865,16 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
 
+    add(ErrorLz4Internal, "LZ4 internal error");
+    add(ErrorLz4DataFormat, "Input compressed stream is in wrong format or corrupted");
+    add(ErrorLz4DataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
+    add(ErrorLz4DataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+
+    add(ErrorZstdInternal, "Zstd internal error");
+    add(ErrorZstdDataFormat, "Input compressed stream is in wrong format or corrupted");
+    add(ErrorZstdDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
+    add(ErrorZstdDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
 
@@ -20,6 +20,7 @@
 
 #include "src/services/service_utils.h"
 #include "src/externals/service_memory.h"
+#include "src/services/service_scratch_arena.h"
 #include "src/services/service_type_traits.h"
 
 namespace daal
@@ -95,6 +96,14 @@ struct ScalableCalloc
     static void deallocate(T * ptr) { service_scalable_free<T, cpu>(ptr); }
 };
 
+/* Takes the memory from the scratch arena of the calling thread, see service_scratch_arena.h */
+template <typename T, CpuType cpu>
+struct ScratchMalloc
+{
+    static T * allocate(size_t n) { return service_scratch_malloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scratch_free<T, cpu>(ptr); }
+};
+
 /* CPU specific deleters */
 
 template <typename T, CpuType cpu>
@@ -0,0 +1,268 @@
+/* file: service_scratch_arena.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the per-thread scratch memory arena.
+//--
+*/
+
+#include "src/services/service_scratch_arena.h"
+#include "services/daal_memory.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace
+{
+const size_t scratchMinChunkSize    = size_t(1) << 20; /* size of the first chunk of the arena */
+const size_t scratchMaxBlockSize    = size_t(1) << 24; /* larger blocks are taken from the scalable allocator */
+const size_t scratchMaxRetainedSize = size_t(1) << 24; /* memory kept by the arena of a thread between the scopes */
+const size_t scratchMaxChunks       = 32;
+
+/* Stored right before every block returned by scratch_malloc() */
+struct ScratchBlockHeader
+{
+    ScratchArena * arena; /* nullptr for the blocks of the scalable allocator */
+    char * raw;           /* beginning of the block in the chunk or the pointer returned by the scalable allocator */
+    size_t size;
+};
+
+inline char * alignUp(char * ptr, size_t alignment)
+{
+    return (char *)((size_t(ptr) + alignment - 1) & ~(alignment - 1));
+}
+
+inline size_t getAlignment(size_t alignment)
+{
+    return alignment < sizeof(void *) ? sizeof(void *) : alignment;
+}
+
+} // namespace
+
+class ScratchArena
+{
+public:
+    ScratchArena() : _nChunks(0), _iChunk(0), _offset(0), _depth(0), _busy(false), _nextChunkSize(scratchMinChunkSize), _prev(nullptr), _next(nullptr)
+    {
+        AUTOLOCK(registryMutex());
+        _next = head();
+        if (_next) _next->_prev = this;
+        head() = this;
+    }
+
+    ~ScratchArena()
+    {
+        {
+            AUTOLOCK(registryMutex());
+            if (_prev)
+                _prev->_next = _next;
+            else
+                head() = _next;
+            if (_next) _next->_prev = _prev;
+        }
+        freeChunks();
+    }
+
+    static ScratchArena & local()
+    {
+        static thread_local ScratchArena arena;
+        return arena;
+    }
+
+    /* The outermost scope marks the arena busy, so trim() does not release its chunks while they are in use */
+    void open(size_t & chunk, size_t & offset)
+    {
+        if (!_depth)
+        {
+            AUTOLOCK(_mutex);
+            _busy = true;
+        }
+        chunk  = _iChunk;
+        offset = _offset;
+        ++_depth;
+    }
+
+    void close(size_t chunk, size_t offset)
+    {
+        _iChunk = chunk;
+        _offset = offset;
+        if (--_depth) return;
+
+        AUTOLOCK(_mutex);
+        _busy = false;
+
+        /* All the memory is free, so the chunks are replaced by the single one on the next allocation */
+        if (_nChunks > 1 || (_nChunks == 1 && _chunks[0].size > scratchMaxRetainedSize))
+        {
+            size_t total = 0;
+            for (size_t i = 0; i < _nChunks; ++i) total += _chunks[i].size;
+            _nextChunkSize = total < scratchMaxRetainedSize ? total : scratchMaxRetainedSize;
+            freeChunks();
+        }
+    }
+
+    /* Releases the chunks of the arenas of all the threads that have no open scope */
+    static void trim()
+    {
+        AUTOLOCK(registryMutex());
+        for (ScratchArena * arena = head(); arena; arena = arena->_next)
+        {
+            AUTOLOCK(arena->_mutex);
+            if (arena->_busy) continue;
+            arena->freeChunks();
+            arena->_nextChunkSize = scratchMinChunkSize;
+        }
+    }
+
+    void * allocate(size_t size, size_t alignment)
+    {
+        if (!_depth || size > scratchMaxBlockSize) return nullptr;
+        for (;;)
+        {
+            if (_iChunk == _nChunks && !addChunk(size + alignment + sizeof(ScratchBlockHeader))) return nullptr;
+
+            Chunk & chunk    = _chunks[_iChunk];
+            char * const ptr = alignUp(chunk.data + _offset + sizeof(ScratchBlockHeader), alignment);
+            if (ptr + size <= chunk.data + chunk.size)
+            {
+                ScratchBlockHeader * const header = (ScratchBlockHeader *)ptr - 1;
+                header->arena                     = this;
+                header->raw                       = chunk.data + _offset;
+                header->size                      = size;
+                _offset                           = ptr + size - chunk.data;
+                return ptr;
+            }
+            ++_iChunk;
+            _offset = 0;
+        }
+    }
+
+    /* Memory of the block is reused by the next allocation only if the block is the last allocated one */
+    void deallocate(char * ptr, const ScratchBlockHeader & header)
+    {
+        if (!_depth || _iChunk == _nChunks) return;
+        const Chunk & chunk = _chunks[_iChunk];
+        if (ptr + header.size == chunk.data + _offset && header.raw >= chunk.data) _offset = header.raw - chunk.data;
+    }
+
+private:
+    struct Chunk
+    {
+        char * data;
+        size_t size;
+    };
+
+    /* Registry of the arenas of all the threads used by trim() */
+    static Mutex & registryMutex()
+    {
+        static Mutex mutex;
+        return mutex;
+    }
+
+    static ScratchArena *& head()
+    {
+        static ScratchArena * arena = nullptr;
+        return arena;
+    }
+
+    bool addChunk(size_t minSize)
+    {
+        if (_nChunks == scratchMaxChunks) return false;
+        size_t size = _nChunks ? 2 * _chunks[_nChunks - 1].size : _nextChunkSize;
+        if (size < minSize) size = minSize;
+        char * const data = (char *)daal_malloc(size, 64);
+        if (!data) return false;
+        _chunks[_nChunks].data = data;
+        _chunks[_nChunks].size = size;
+        ++_nChunks;
+        return true;
+    }
+
+    void freeChunks()
+    {
+        for (size_t i = 0; i < _nChunks; ++i) daal_free(_chunks[i].data);
+        _nChunks = 0;
+        _iChunk  = 0;
+        _offset  = 0;
+    }
+
+    Chunk _chunks[scratchMaxChunks];
+    size_t _nChunks;
+    size_t _iChunk; /* chunk the next block is taken from */
+    size_t _offset; /* offset of the free memory in the chunk */
+    size_t _depth;  /* number of the open scopes */
+    bool _busy;     /* the thread has an open scope, guarded by _mutex */
+    size_t _nextChunkSize;
+    Mutex _mutex;
+    ScratchArena * _prev;
+    ScratchArena * _next;
+};
+
+void * scratch_malloc(size_t size, size_t alignment)
+{
+    alignment  = getAlignment(alignment);
+    void * ptr = ScratchArena::local().allocate(size, alignment);
+    if (ptr) return ptr;
+
+    char * const raw = (char *)threaded_scalable_malloc(size + alignment + sizeof(ScratchBlockHeader), alignment);
+    if (!raw) return nullptr;
+    char * const res                  = alignUp(raw + sizeof(ScratchBlockHeader), alignment);
+    ScratchBlockHeader * const header = (ScratchBlockHeader *)res - 1;
+    header->arena                     = nullptr;
+    header->raw                       = raw;
+    header->size                      = size;
+    return res;
+}
+
+void scratch_free(void * ptr)
+{
+    if (!ptr) return;
+    const ScratchBlockHeader & header = *((ScratchBlockHeader *)ptr - 1);
+    if (!header.arena)
+    {
+        threaded_scalable_free(header.raw);
+        return;
+    }
+    /* Blocks of the arenas of other threads are released by their scopes */
+    ScratchArena & arena = ScratchArena::local();
+    if (header.arena == &arena) arena.deallocate((char *)ptr, header);
+}
+
+void scratch_trim()
+{
+    ScratchArena::trim();
+}
+
+ScratchArenaScope::ScratchArenaScope() : _arena(&ScratchArena::local())
+{
+    _arena->open(_chunk, _offset);
+}
+
+ScratchArenaScope::~ScratchArenaScope()
+{
+    _arena->close(_chunk, _offset);
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
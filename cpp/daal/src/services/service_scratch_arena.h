@@ -0,0 +1,91 @@
+/* file: service_scratch_arena.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the per-thread scratch memory arena.
+//
+//  Every thread owns an arena: a list of large chunks with a bump pointer.
+//  ScratchArenaScope remembers the position of the bump pointer of the calling
+//  thread and restores it on destruction, so all the scratch memory allocated
+//  by the thread inside the scope is released at once and is reused by the
+//  next scope without calls to the system allocator.
+//
+//  Scratch memory is intended for the temporaries of a kernel that do not
+//  outlive the scope where they were allocated, e.g. the buffers of compute()
+//  or the per-block buffers of a parallel loop body. If the calling thread has
+//  no open scope, the request is too large or the arena cannot grow, the memory
+//  is taken from the scalable allocator. scratch_free() may be called from any
+//  thread for both kinds of the blocks.
+//
+//  Between the scopes an arena keeps at most 16 MB of the chunks to avoid the
+//  calls to the system allocator in the next scope. scratch_trim() releases
+//  this memory of all the threads that have no open scope.
+//--
+*/
+
+#ifndef __SERVICE_SCRATCH_ARENA_H__
+#define __SERVICE_SCRATCH_ARENA_H__
+
+#include "services/daal_defines.h"
+#include "services/env_detect.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+class ScratchArena;
+
+void * scratch_malloc(size_t size, size_t alignment = 64);
+void scratch_free(void * ptr);
+void scratch_trim();
+
+/* Scope of the scratch memory of the calling thread. Scopes can be nested. */
+class ScratchArenaScope
+{
+public:
+    ScratchArenaScope();
+    ~ScratchArenaScope();
+
+    ScratchArenaScope(const ScratchArenaScope &) = delete;
+    ScratchArenaScope & operator=(const ScratchArenaScope &) = delete;
+
+private:
+    ScratchArena * _arena;
+    size_t _chunk;
+    size_t _offset;
+};
+
+template <typename T, CpuType cpu>
+T * service_scratch_malloc(size_t size, size_t alignment = 64)
+{
+    return (T *)scratch_malloc(size * sizeof(T), alignment);
+}
+
+template <typename T, CpuType cpu>
+void service_scratch_free(T * ptr)
+{
+    scratch_free(ptr);
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
@@ -200,6 +200,22 @@ inline float infToBigValue(float arg)
     }
 }
 
+/* Returns true if the double input is NaN */
+template <CpuType cpu>
+inline bool isNaN(double arg)
+{
+    const _daal_dp_union_t * const u = (const _daal_dp_union_t *)&arg;
+    return (u->bits.exponent == 0x7FF) && (u->bits.hi_significand || u->bits.lo_significand);
+}
+
+/* Returns true if the float input is NaN */
+template <CpuType cpu>
+inline bool isNaN(float arg)
+{
+    const _daal_sp_union_t * const u = (const _daal_sp_union_t *)&arg;
+    return (u->bits.exponent == 0xFF) && u->bits.significand;
+}
+
 template <CpuType cpu, typename T>
 inline const T & min(const T & a, const T & b)
 {
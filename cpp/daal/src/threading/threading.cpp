@@ -36,6 +36,10 @@
     #include <tbb/task_arena.h>
     #include "services/daal_atomic_int.h"
 
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12000
+        #define DAAL_TBB_NUMA_SUPPORT
+    #endif
+
 using namespace daal::services;
 #else
     #include "src/externals/service_service.h"
@@ -59,6 +63,85 @@ DAAL_EXPORT void _threaded_scalable_free(void * ptr)
 #endif
 }
 
+#if defined(DAAL_TBB_NUMA_SUPPORT)
+/* Task arenas bound to the NUMA nodes of the system, created at the first use */
+class NumaArenas
+{
+public:
+    static NumaArenas & get()
+    {
+        static NumaArenas arenas;
+        return arenas;
+    }
+
+    ~NumaArenas()
+    {
+        for (size_t i = 0; i < _nArenas; ++i) delete _arenas[i];
+        delete[] _arenas;
+    }
+
+    size_t size() const { return _nArenas; }
+    tbb::task_arena & operator[](size_t i) { return *_arenas[i]; }
+
+private:
+    NumaArenas() : _arenas(nullptr), _nArenas(0)
+    {
+        const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+        /* single node system or the topology is not available (no tbbbind library) */
+        if (nodes.size() < 2) return;
+        _arenas = new tbb::task_arena *[nodes.size()];
+        for (size_t i = 0; i < nodes.size(); ++i) _arenas[i] = new tbb::task_arena(tbb::task_arena::constraints(nodes[i]));
+        _nArenas = nodes.size();
+    }
+
+    tbb::task_arena ** _arenas;
+    size_t _nArenas;
+};
+#endif
+
+DAAL_EXPORT bool _threaded_numa_first_touch(void * ptr, const size_t size)
+{
+#if defined(DAAL_TBB_NUMA_SUPPORT)
+    /* the borders between the parts of the buffer are aligned to the pages */
+    const size_t pageSize  = 4096;
+    const size_t blockSize = 64 * pageSize;
+    NumaArenas & arenas    = NumaArenas::get();
+    const size_t nNodes    = arenas.size();
+    if (nNodes < 2 || size < nNodes * blockSize || _daal_is_in_parallel()) return false;
+
+    char * const begin = static_cast<char *>(ptr);
+    auto border        = [&](size_t iNode) -> char * {
+        if (iNode == 0) return begin;
+        if (iNode == nNodes) return begin + size;
+        const size_t address = size_t(begin) + size / nNodes * iNode;
+        return reinterpret_cast<char *>(address - address % pageSize);
+    };
+
+    /* the i-th part of the buffer is zeroed by the threads of the arena bound to the i-th node */
+    tbb::task_group * groups = new tbb::task_group[nNodes];
+    for (size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        arenas[iNode].execute([&, iNode]() {
+            groups[iNode].run([&, iNode]() {
+                char * const nodeBegin = border(iNode);
+                const size_t nodeSize  = border(iNode + 1) - nodeBegin;
+                const size_t nBlocks   = (nodeSize + blockSize - 1) / blockSize;
+                tbb::parallel_for(size_t(0), nBlocks, [&](size_t iBlock) {
+                    char * const blockBegin = nodeBegin + iBlock * blockSize;
+                    const size_t n          = (iBlock + 1 == nBlocks) ? nodeSize - iBlock * blockSize : blockSize;
+                    for (size_t i = 0; i < n; ++i) blockBegin[i] = 0;
+                });
+            });
+        });
+    }
+    for (size_t iNode = 0; iNode < nNodes; ++iNode) arenas[iNode].execute([&, iNode]() { groups[iNode].wait(); });
+    delete[] groups;
+    return true;
+#else
+    return false;
+#endif
+}
+
 DAAL_EXPORT void _daal_tbb_task_scheduler_free(void *& globalControl)
 {
 #if defined(__DO_TBB_LAYER__)
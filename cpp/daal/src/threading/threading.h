@@ -72,6 +72,7 @@ extern "C"
 
     DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment);
     DAAL_EXPORT void _threaded_scalable_free(void * ptr);
+    DAAL_EXPORT bool _threaded_numa_first_touch(void * ptr, const size_t size);
 }
 
 namespace daal
@@ -94,12 +95,15 @@ inline void threaded_scalable_free(void * ptr)
 class ThreaderEnvironment
 {
 public:
-    ThreaderEnvironment() : _numberOfThreads(_daal_threader_get_max_threads()) {}
+    ThreaderEnvironment() : _numberOfThreads(_daal_threader_get_max_threads()), _numaAwareAllocation(false) {}
     size_t getNumberOfThreads() const { return _numberOfThreads; }
     void setNumberOfThreads(size_t value) { _numberOfThreads = value; }
+    bool getNumaAwareAllocation() const { return _numaAwareAllocation; }
+    void setNumaAwareAllocation(bool value) { _numaAwareAllocation = value; }
 
 private:
     size_t _numberOfThreads;
+    bool _numaAwareAllocation;
 };
 
 inline ThreaderEnvironment * threader_env()
@@ -107,6 +111,18 @@ inline ThreaderEnvironment * threader_env()
     return static_cast<ThreaderEnvironment *>(_daal_threader_env());
 }
 
+/* Size in bytes of the smallest buffer that is distributed between the NUMA nodes in the NUMA-aware allocation mode */
+const size_t numaFirstTouchThreshold = size_t(1) << 22;
+
+/* In the NUMA-aware allocation mode zeroes the freshly allocated buffer in parallel from the threads of all NUMA nodes,
+ * so that its pages are distributed between the nodes in contiguous parts.
+ * Only the buffers that have to be zeroed anyway are passed here, the loops that later process them are not bound to the nodes.
+ * Returns true if the buffer was zeroed */
+inline bool threaded_numa_first_touch(void * ptr, const size_t size)
+{
+    return (size >= numaFirstTouchThreshold) && threader_env()->getNumaAwareAllocation() && _threaded_numa_first_touch(ptr, size);
+}
+
 inline size_t threader_get_threads_number()
 {
     return threader_env()->getNumberOfThreads();
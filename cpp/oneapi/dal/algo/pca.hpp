@@ -17,3 +17,5 @@
 #pragma once
 
 #include "oneapi/dal/algo/pca/train.hpp"
+#include "oneapi/dal/algo/pca/partial_train.hpp"
+#include "oneapi/dal/algo/pca/finalize_train.hpp"
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "daal/algorithms/kernel/kernel.h"
+#include "daal/algorithms/kernel/covariance/covariance_kernel.h"
+#include "daal/algorithms/kernel/pca/pca_dense_correlation_batch_kernel.h"
+
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/algo/pca/backend/cpu/finalize_train_kernel.hpp"
+
+namespace dal {
+namespace decomposition {
+namespace pca {
+namespace backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_pca = daal::algorithms::pca;
+namespace daal_cov = daal::algorithms::covariance;
+namespace interop  = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_online_kernel_t = daal_cov::internal::CovarianceDenseOnlineKernel<Float, daal_cov::defaultDense, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_pca_cor_kernel_t = daal_pca::internal::PCACorrelationKernel<daal::batch, Float, Cpu>;
+
+template <typename Float>
+static train_result call_daal_kernel(const context_cpu& ctx,
+                                     const descriptor_base& desc,
+                                     const partial_train_result& input) {
+    const int64_t column_count = input.get_partial_crossproduct().get_column_count();
+    const int64_t component_count = desc.get_component_count();
+
+    auto arr_n_rows = row_accessor<const Float>{ input.get_partial_n_rows() }.pull();
+    auto arr_crossproduct = row_accessor<const Float>{ input.get_partial_crossproduct() }.pull();
+    auto arr_sum = row_accessor<const Float>{ input.get_partial_sum() }.pull();
+    array<Float> arr_cor { column_count * column_count };
+    array<Float> arr_means { 1 * column_count };
+    array<Float> arr_eigvec { component_count * column_count };
+    array<Float> arr_eigval { 1 * component_count };
+    array<Float> arr_vars { 1 * component_count };
+
+    const auto daal_n_rows       = interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1);
+    const auto daal_crossproduct = interop::convert_to_daal_homogen_table(arr_crossproduct, column_count, column_count);
+    const auto daal_sum          = interop::convert_to_daal_homogen_table(arr_sum, 1, column_count);
+    const auto daal_cor          = interop::convert_to_daal_homogen_table(arr_cor, column_count, column_count);
+    const auto daal_means        = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+    const auto daal_eigenvectors = interop::convert_to_daal_homogen_table(arr_eigvec, component_count, column_count);
+    const auto daal_eigenvalues  = interop::convert_to_daal_homogen_table(arr_eigval, 1, component_count);
+    const auto daal_variances    = interop::convert_to_daal_homogen_table(arr_vars, 1, component_count);
+
+    daal_cov::Parameter daal_parameter;
+    daal_parameter.outputMatrixType = daal_cov::correlationMatrix;
+
+    interop::call_daal_kernel_finalize_compute<Float, daal_cov_online_kernel_t>(
+        ctx,
+        daal_n_rows.get(),
+        daal_crossproduct.get(),
+        daal_sum.get(),
+        daal_cor.get(),
+        daal_means.get(),
+        &daal_parameter);
+
+    // Eigen-decomposition of the correlation matrix accumulated over all the chunks,
+    // the same as batch training does for the correlation computed from the whole data.
+    // The kernel flips the signs of the eigenvectors the same way as in batch training
+    // when the descriptor asks for deterministic results
+    constexpr bool is_correlation = true;
+    constexpr uint64_t results_to_compute = 0;
+
+    interop::call_daal_kernel<Float, daal_pca_cor_kernel_t>(
+        ctx,
+        is_correlation,
+        desc.get_is_deterministic(),
+        *daal_cor,
+        static_cast<daal_cov::BatchImpl*>(nullptr),
+        results_to_compute,
+        *daal_eigenvectors,
+        *daal_eigenvalues,
+        *daal_means,
+        *daal_variances);
+
+    return train_result()
+        .set_model(model().set_eigenvectors(homogen_table_builder{ column_count, arr_eigvec }.build()))
+        .set_eigenvalues(homogen_table_builder{ component_count, arr_eigval }.build());
+}
+
+template <typename Float>
+static train_result finalize_train(const context_cpu& ctx,
+                                   const descriptor_base& desc,
+                                   const partial_train_result& input) {
+    return call_daal_kernel<Float>(ctx, desc, input);
+}
+
+template <typename Float>
+struct finalize_train_kernel_cpu<Float, method::cov> {
+    train_result operator()(const context_cpu& ctx,
+                            const descriptor_base& desc,
+                            const partial_train_result& input) const {
+        return finalize_train<Float>(ctx, desc, input);
+    }
+};
+
+template struct finalize_train_kernel_cpu<float, method::cov>;
+template struct finalize_train_kernel_cpu<double, method::cov>;
+
+} // namespace backend
+} // namespace pca
+} // namespace decomposition
+} // namespace dal
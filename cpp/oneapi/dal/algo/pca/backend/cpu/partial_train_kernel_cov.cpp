@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "daal/algorithms/kernel/kernel.h"
+#include "daal/algorithms/kernel/covariance/covariance_kernel.h"
+
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/algo/pca/backend/cpu/partial_train_kernel.hpp"
+
+namespace dal {
+namespace decomposition {
+namespace pca {
+namespace backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace interop  = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_online_kernel_t = daal_cov::internal::CovarianceDenseOnlineKernel<Float, daal_cov::defaultDense, Cpu>;
+
+template <typename Float>
+static array<Float> pull_prior_result(const table& prior, int64_t element_count) {
+    if (!prior.has_data()) {
+        return array<Float>{ element_count, Float(0) };
+    }
+    return row_accessor<const Float>{ prior }.pull();
+}
+
+template <typename Float>
+static partial_train_result call_daal_kernel(const context_cpu& ctx,
+                                             const descriptor_base& desc,
+                                             const partial_train_input& input) {
+    const auto data = input.get_data();
+    const auto prior_result = input.get_prior_result();
+    const int64_t column_count = data.get_column_count();
+
+    // Accumulation starts from the copy of prior state, so prior result stays intact
+    auto arr_n_rows = pull_prior_result<Float>(prior_result.get_partial_n_rows(), 1);
+    auto arr_crossproduct = pull_prior_result<Float>(prior_result.get_partial_crossproduct(), column_count * column_count);
+    auto arr_sum = pull_prior_result<Float>(prior_result.get_partial_sum(), column_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_n_rows       = interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1);
+    const auto daal_crossproduct = interop::convert_to_daal_homogen_table(arr_crossproduct, column_count, column_count);
+    const auto daal_sum          = interop::convert_to_daal_homogen_table(arr_sum, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+
+    interop::call_daal_kernel<Float, daal_cov_online_kernel_t>(
+        ctx,
+        daal_data.get(),
+        daal_n_rows.get(),
+        daal_crossproduct.get(),
+        daal_sum.get(),
+        &daal_parameter);
+
+    return partial_train_result()
+        .set_partial_n_rows(homogen_table_builder{ 1, arr_n_rows }.build())
+        .set_partial_crossproduct(homogen_table_builder{ column_count, arr_crossproduct }.build())
+        .set_partial_sum(homogen_table_builder{ column_count, arr_sum }.build());
+}
+
+template <typename Float>
+static partial_train_result partial_train(const context_cpu& ctx,
+                                          const descriptor_base& desc,
+                                          const partial_train_input& input) {
+    return call_daal_kernel<Float>(ctx, desc, input);
+}
+
+template <typename Float>
+struct partial_train_kernel_cpu<Float, method::cov> {
+    partial_train_result operator()(const context_cpu& ctx,
+                                    const descriptor_base& desc,
+                                    const partial_train_input& input) const {
+        return partial_train<Float>(ctx, desc, input);
+    }
+};
+
+template struct partial_train_kernel_cpu<float, method::cov>;
+template struct partial_train_kernel_cpu<double, method::cov>;
+
+} // namespace backend
+} // namespace pca
+} // namespace decomposition
+} // namespace dal
@@ -40,21 +40,18 @@ template <typename Float>
 static train_result call_daal_kernel(const context_cpu& ctx,
                                      const descriptor_base& desc,
                                      const table& data) {
-    const int64_t row_count = data.get_row_count();
     const int64_t column_count = data.get_column_count();
     const int64_t component_count = desc.get_component_count();
 
-    auto arr_data = row_accessor<const Float>{ data }.pull();
     array<Float> arr_eigvec { column_count * component_count };
     array<Float> arr_eigval { 1 * component_count };
     array<Float> arr_means { 1 * component_count };
     array<Float> arr_vars { 1 * component_count };
 
     // TODO: read-only access performed with deep copy of data since daal numeric tables are mutable.
-    // Need to create special immutable homogen table on daal interop side
-
-    // TODO: data is table, not a homogen_table. Think better about accessor - is it enough to have just a row_accessor?
-    const auto daal_data = interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    // Need to create special immutable homogen table on daal interop side.
+    // Arrow tables are the exception: their columns are shared with daal without copying
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
     const auto daal_eigenvectors = interop::convert_to_daal_homogen_table(arr_eigvec, column_count, component_count);
     const auto daal_eigenvalues  = interop::convert_to_daal_homogen_table(arr_eigval, 1, component_count);
     const auto daal_means        = interop::convert_to_daal_homogen_table(arr_means, 1, component_count);
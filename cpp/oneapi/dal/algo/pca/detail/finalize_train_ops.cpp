@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/algo/pca/detail/finalize_train_ops.hpp"
+#include "oneapi/dal/algo/pca/backend/cpu/finalize_train_kernel.hpp"
+
+namespace dal {
+namespace decomposition {
+namespace pca {
+namespace detail {
+
+template <typename Float, typename Method>
+struct finalize_train_ops_dispatcher<default_execution_context, Float, Method> {
+    train_result operator()(const default_execution_context& ctx,
+                            const descriptor_base& desc,
+                            const partial_train_result& input) const {
+        using kernel_dispatcher_t = dal::backend::kernel_dispatcher<
+            backend::finalize_train_kernel_cpu<Float, Method>>;
+        return kernel_dispatcher_t()(ctx, desc, input);
+    }
+};
+
+#define INSTANTIATE(F, M) \
+  template struct finalize_train_ops_dispatcher<default_execution_context, F, M>;
+
+INSTANTIATE(float, method::cov)
+INSTANTIATE(double, method::cov)
+
+} // namespace detail
+} // namespace pca
+} // namespace decomposition
+} // namespace dal
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/pca.hpp"
+#include "oneapi/dal/data/accessor.hpp"
+
+using namespace dal;
+using namespace dal::decomposition;
+using std::int64_t;
+
+static constexpr int64_t row_count = 6;
+static constexpr int64_t column_count = 3;
+
+static const float data[] = {
+    1.f,  2.f,  3.f,
+    1.f,  -1.f, 0.f,
+    4.f,  5.f,  6.f,
+    1.f,  2.f,  5.f,
+    -4.f, 3.f,  0.f,
+    2.f,  -3.f, 1.f
+};
+
+static pca::train_result train_by_chunks(const pca::descriptor<>& desc, int64_t rows_in_chunk) {
+    pca::partial_train_result partial_result;
+    for (int64_t first_row = 0; first_row < row_count; first_row += rows_in_chunk) {
+        const int64_t chunk_row_count = std::min(rows_in_chunk, row_count - first_row);
+        const auto chunk = homogen_table{ chunk_row_count, column_count,
+                                          data + first_row * column_count };
+        partial_result = partial_train(desc, partial_result, chunk);
+    }
+    return finalize_train(desc, partial_result);
+}
+
+static void compare_tables(const table& expected, const table& actual) {
+    ASSERT_EQ(expected.get_row_count(), actual.get_row_count());
+    ASSERT_EQ(expected.get_column_count(), actual.get_column_count());
+
+    const auto expected_arr = row_accessor<const float>(expected).pull();
+    const auto actual_arr = row_accessor<const float>(actual).pull();
+    for (int64_t i = 0; i < expected_arr.get_size(); i++) {
+        ASSERT_NEAR(expected_arr[i], actual_arr[i], 1e-4f);
+    }
+}
+
+TEST(pca_partial_train_test, finalize_train_matches_train) {
+    const auto desc = pca::descriptor<>()
+        .set_component_count(column_count)
+        .set_is_deterministic(true);
+
+    const auto batch_result = train(desc, homogen_table{ row_count, column_count, data });
+
+    for (int64_t rows_in_chunk : { 1, 2, 4, 6 }) {
+        const auto online_result = train_by_chunks(desc, rows_in_chunk);
+
+        compare_tables(batch_result.get_eigenvalues(), online_result.get_eigenvalues());
+        compare_tables(batch_result.get_eigenvectors(), online_result.get_eigenvectors());
+    }
+}
+
+TEST(pca_partial_train_test, partial_train_keeps_previous_result) {
+    const auto desc = pca::descriptor<>()
+        .set_component_count(column_count)
+        .set_is_deterministic(true);
+
+    const auto first_chunk = homogen_table{ 3, column_count, data };
+    const auto second_chunk = homogen_table{ 3, column_count, data + 3 * column_count };
+
+    const auto first_result = partial_train(desc, pca::partial_train_result{}, first_chunk);
+    const auto expected_crossproduct = row_accessor<const float>(first_result.get_partial_crossproduct()).pull();
+
+    partial_train(desc, first_result, second_chunk);
+
+    const auto crossproduct = row_accessor<const float>(first_result.get_partial_crossproduct()).pull();
+    for (int64_t i = 0; i < crossproduct.get_size(); i++) {
+        ASSERT_FLOAT_EQ(expected_crossproduct[i], crossproduct[i]);
+    }
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/algo/pca/partial_train_types.hpp"
+
+namespace dal {
+namespace decomposition {
+namespace pca {
+
+class detail::partial_train_input_impl : public base {
+  public:
+    partial_train_input_impl(const partial_train_result& prior_result, const table& data)
+        : prior_result(prior_result),
+          data(data) {}
+
+    partial_train_result prior_result;
+    table data;
+};
+
+class detail::partial_train_result_impl : public base {
+  public:
+    table partial_n_rows;
+    table partial_crossproduct;
+    table partial_sum;
+};
+
+using detail::partial_train_input_impl;
+using detail::partial_train_result_impl;
+
+partial_train_input::partial_train_input(const table& data)
+    : impl_(new partial_train_input_impl(partial_train_result{}, data)) {}
+
+partial_train_input::partial_train_input(const partial_train_result& prior_result, const table& data)
+    : impl_(new partial_train_input_impl(prior_result, data)) {}
+
+partial_train_result partial_train_input::get_prior_result() const {
+    return impl_->prior_result;
+}
+
+table partial_train_input::get_data() const {
+    return impl_->data;
+}
+
+void partial_train_input::set_prior_result_impl(const partial_train_result& value) {
+    impl_->prior_result = value;
+}
+
+void partial_train_input::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+partial_train_result::partial_train_result() : impl_(new partial_train_result_impl{}) {}
+
+table partial_train_result::get_partial_n_rows() const {
+    return impl_->partial_n_rows;
+}
+
+table partial_train_result::get_partial_crossproduct() const {
+    return impl_->partial_crossproduct;
+}
+
+table partial_train_result::get_partial_sum() const {
+    return impl_->partial_sum;
+}
+
+void partial_train_result::set_partial_n_rows_impl(const table& value) {
+    impl_->partial_n_rows = value;
+}
+
+void partial_train_result::set_partial_crossproduct_impl(const table& value) {
+    impl_->partial_crossproduct = value;
+}
+
+void partial_train_result::set_partial_sum_impl(const table& value) {
+    impl_->partial_sum = value;
+}
+
+} // namespace pca
+} // namespace decomposition
+} // namespace dal
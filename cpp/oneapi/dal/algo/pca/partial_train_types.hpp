@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/pca/common.hpp"
+
+namespace dal {
+namespace decomposition {
+namespace pca {
+
+namespace detail {
+class partial_train_input_impl;
+class partial_train_result_impl;
+} // namespace detail
+
+class partial_train_result {
+  public:
+    partial_train_result();
+
+    table get_partial_n_rows() const;
+    table get_partial_crossproduct() const;
+    table get_partial_sum() const;
+
+    auto& set_partial_n_rows(const table& value) {
+        set_partial_n_rows_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_crossproduct(const table& value) {
+        set_partial_crossproduct_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_sum(const table& value) {
+        set_partial_sum_impl(value);
+        return *this;
+    }
+
+  private:
+    void set_partial_n_rows_impl(const table&);
+    void set_partial_crossproduct_impl(const table&);
+    void set_partial_sum_impl(const table&);
+
+    dal::detail::pimpl<detail::partial_train_result_impl> impl_;
+};
+
+class partial_train_input : public base {
+  public:
+    partial_train_input(const table& data);
+    partial_train_input(const partial_train_result& prior_result, const table& data);
+
+    partial_train_result get_prior_result() const;
+    table get_data() const;
+
+    auto& set_prior_result(const partial_train_result& value) {
+        set_prior_result_impl(value);
+        return *this;
+    }
+
+    auto& set_data(const table& data) {
+        set_data_impl(data);
+        return *this;
+    }
+
+  private:
+    void set_prior_result_impl(const partial_train_result& value);
+    void set_data_impl(const table& data);
+
+    dal::detail::pimpl<detail::partial_train_input_impl> impl_;
+};
+
+} // namespace pca
+} // namespace decomposition
+} // namespace dal
@@ -55,6 +55,14 @@ inline auto call_daal_kernel(const context_cpu& ctx, Args&&... args) {
     });
 }
 
+template <typename Float, template <typename, daal::CpuType> typename CpuKernel, typename... Args>
+inline auto call_daal_kernel_finalize_compute(const context_cpu& ctx, Args&&... args) {
+    return dal::backend::dispatch_by_cpu(ctx, [&](const auto cpu) {
+        constexpr daal::CpuType daal_cpu_type = get_daal_cpu_type(cpu);
+        return CpuKernel<Float, daal_cpu_type>().finalizeCompute(args...);
+    });
+}
+
 } // namespace interop
 } // namespace backend
 } // namespace dal
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "daal/include/data_management/data/homogen_numeric_table.h"
+#include "daal/include/data_management/data/soa_numeric_table.h"
 
 #include "oneapi/dal/data/table_builder.hpp"
 #include "oneapi/dal/data/accessor.hpp"
@@ -37,6 +38,17 @@ struct daal_array_owner {
     array<T> array_;
 };
 
+struct daal_table_owner {
+    explicit daal_table_owner(const table& t)
+        : table_(t) {}
+
+    void operator() (const void*) {
+        table_ = table{};
+    }
+
+    table table_;
+};
+
 template <typename T>
 inline auto allocate_daal_homogen_table(std::int64_t row_count,
                                         std::int64_t column_count) {
@@ -56,6 +68,119 @@ inline auto convert_to_daal_homogen_table(array<T>& data,
         daal_data, column_count, row_count);
 }
 
+// Columns of arrow table are immutable: the table shares them with daal for reading only
+// and rejects the blocks of data requested for writing
+class daal_read_only_soa_table : public daal::data_management::SOANumericTable {
+public:
+    using status_t = daal::services::Status;
+    using rw_mode_t = daal::data_management::ReadWriteMode;
+    template <typename T>
+    using block_t = daal::data_management::BlockDescriptor<T>;
+
+    daal_read_only_soa_table(std::int64_t column_count, std::int64_t row_count)
+        : SOANumericTable(column_count, row_count) {}
+
+    status_t getBlockOfRows(size_t row_idx, size_t row_count, rw_mode_t rwflag, block_t<double>& block) override {
+        return get_rows(row_idx, row_count, rwflag, block);
+    }
+    status_t getBlockOfRows(size_t row_idx, size_t row_count, rw_mode_t rwflag, block_t<float>& block) override {
+        return get_rows(row_idx, row_count, rwflag, block);
+    }
+    status_t getBlockOfRows(size_t row_idx, size_t row_count, rw_mode_t rwflag, block_t<int>& block) override {
+        return get_rows(row_idx, row_count, rwflag, block);
+    }
+
+    status_t getBlockOfColumnValues(size_t column_idx, size_t row_idx, size_t row_count,
+                                    rw_mode_t rwflag, block_t<double>& block) override {
+        return get_column(column_idx, row_idx, row_count, rwflag, block);
+    }
+    status_t getBlockOfColumnValues(size_t column_idx, size_t row_idx, size_t row_count,
+                                    rw_mode_t rwflag, block_t<float>& block) override {
+        return get_column(column_idx, row_idx, row_count, rwflag, block);
+    }
+    status_t getBlockOfColumnValues(size_t column_idx, size_t row_idx, size_t row_count,
+                                    rw_mode_t rwflag, block_t<int>& block) override {
+        return get_column(column_idx, row_idx, row_count, rwflag, block);
+    }
+
+private:
+    template <typename T>
+    status_t get_rows(size_t row_idx, size_t row_count, rw_mode_t rwflag, block_t<T>& block) {
+        if (rwflag & daal::data_management::writeOnly) {
+            return status_t(daal::services::ErrorMethodNotImplemented);
+        }
+        return SOANumericTable::getBlockOfRows(row_idx, row_count, rwflag, block);
+    }
+
+    template <typename T>
+    status_t get_column(size_t column_idx, size_t row_idx, size_t row_count,
+                        rw_mode_t rwflag, block_t<T>& block) {
+        if (rwflag & daal::data_management::writeOnly) {
+            return status_t(daal::services::ErrorMethodNotImplemented);
+        }
+        return SOANumericTable::getBlockOfColumnValues(column_idx, row_idx, row_count, rwflag, block);
+    }
+};
+
+template <typename T>
+inline void set_daal_soa_column(daal_read_only_soa_table& daal_table,
+                                const table& data,
+                                const void* column_data,
+                                std::int64_t column_index) {
+    // daal takes the columns as mutable arrays, the table does not give write access to them
+    const auto daal_column = daal::services::SharedPtr<T>(
+        static_cast<T*>(const_cast<void*>(column_data)), daal_table_owner{ data });
+
+    daal_table.setArray(daal_column, column_index);
+}
+
+inline auto convert_to_daal_soa_table(const table& data,
+                                      const detail::arrow_table_impl_iface& impl) {
+    const std::int64_t column_count = data.get_column_count();
+    const auto& features = data.get_metadata().features;
+    auto daal_table = daal::services::SharedPtr<daal_read_only_soa_table>(
+        new daal_read_only_soa_table(column_count, data.get_row_count()));
+
+    for (std::int64_t i = 0; i < column_count; i++) {
+        const void* column_data = impl.get_column_data(i);
+        switch (features[i].dtype) {
+            case data_type::int32:
+                set_daal_soa_column<std::int32_t>(*daal_table, data, column_data, i);
+                break;
+            case data_type::int64:
+                set_daal_soa_column<std::int64_t>(*daal_table, data, column_data, i);
+                break;
+            case data_type::uint32:
+                set_daal_soa_column<std::uint32_t>(*daal_table, data, column_data, i);
+                break;
+            case data_type::uint64:
+                set_daal_soa_column<std::uint64_t>(*daal_table, data, column_data, i);
+                break;
+            case data_type::float32:
+                set_daal_soa_column<float>(*daal_table, data, column_data, i);
+                break;
+            case data_type::float64:
+                set_daal_soa_column<double>(*daal_table, data, column_data, i);
+                break;
+        }
+    }
+
+    return daal_table;
+}
+
+// Arrow columns are shared with daal without copying for reading only and daal materializes
+// the blocks of rows it reads on demand. Data of other tables is converted to homogen table of type T
+template <typename T>
+inline daal::data_management::NumericTablePtr convert_to_daal_table(const table& data) {
+    const auto& impl = detail::get_impl<detail::table_impl_iface>(data);
+    if (auto arrow_impl = dynamic_cast<const detail::arrow_table_impl_iface*>(&impl)) {
+        return convert_to_daal_soa_table(data, *arrow_impl);
+    }
+
+    auto arr_data = row_accessor<const T>{ data }.pull();
+    return convert_to_daal_homogen_table(arr_data, data.get_row_count(), data.get_column_count());
+}
+
 } // namespace interop
 } // namespace backend
 } // namespace dal
@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/data/backend/arrow_table_impl.hpp"
+#include "oneapi/dal/data/backend/convert.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace dal::backend {
+
+using std::int32_t;
+using std::int64_t;
+
+static data_type get_arrow_data_type(const char* format) {
+    if (!format || format[0] == '\0' || format[1] != '\0') {
+        throw std::invalid_argument("unsupported arrow column type");
+    }
+
+    switch (format[0]) {
+        case 'i': return data_type::int32;
+        case 'l': return data_type::int64;
+        case 'I': return data_type::uint32;
+        case 'L': return data_type::uint64;
+        case 'f': return data_type::float32;
+        case 'g': return data_type::float64;
+        default: throw std::invalid_argument("unsupported arrow column type");
+    }
+}
+
+static bool has_nulls(const ArrowArray& column, int64_t offset, int64_t length) {
+    const auto validity = static_cast<const byte_t*>(column.buffers[0]);
+    if (column.null_count == 0 || validity == nullptr) {
+        return false;
+    }
+
+    // Null count of the producer covers the whole column, so the bitmap is checked for the used rows only
+    for (int64_t i = offset; i < offset + length; i++) {
+        if (((validity[i >> 3] >> (i & 7)) & 1) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int64_t get_checked_row_count(const range& rows, int64_t row_count) {
+    const int64_t end_idx = (rows.end_idx < 0) ? row_count + rows.end_idx + 1 : rows.end_idx;
+    if (rows.start_idx < 0 || rows.start_idx > end_idx || end_idx > row_count) {
+        throw std::out_of_range("row range is out of the arrow table");
+    }
+    return end_idx - rows.start_idx;
+}
+
+arrow_table_impl::arrow_table_impl(ArrowArray* record_batch, const ArrowSchema* schema) {
+    if (!record_batch || !record_batch->release || !schema) {
+        throw std::invalid_argument("arrow record batch is released");
+    }
+    if (std::strcmp(schema->format, "+s") != 0 || schema->n_children != record_batch->n_children) {
+        throw std::invalid_argument("arrow schema does not describe the record batch");
+    }
+
+    row_count_ = record_batch->length;
+    column_count_ = record_batch->n_children;
+    meta_ = table_metadata{ column_count_, feature_info{}, data_layout::column_major };
+    columns_.reset(column_count_);
+
+    for (int64_t i = 0; i < column_count_; i++) {
+        const ArrowArray& column = *record_batch->children[i];
+        const data_type dtype = get_arrow_data_type(schema->children[i]->format);
+
+        if (column.n_buffers != 2 || column.length < record_batch->offset + row_count_) {
+            throw std::invalid_argument("arrow column does not match the record batch");
+        }
+
+        const int64_t offset = column.offset + record_batch->offset;
+        if (has_nulls(column, offset, row_count_)) {
+            throw std::invalid_argument("arrow columns with null values are not supported");
+        }
+
+        meta_.features[i] = feature_info{ dtype };
+        columns_[i] = static_cast<const byte_t*>(column.buffers[1]) + offset * get_data_type_size(dtype);
+    }
+
+    // Moves the batch as the C data interface requires: the structure of the caller is marked as released
+    record_batch_ = detail::shared<ArrowArray>(new ArrowArray(*record_batch), [](ArrowArray* batch) {
+        if (batch->release) {
+            batch->release(batch);
+        }
+        delete batch;
+    });
+    record_batch->release = nullptr;
+}
+
+template <typename T>
+void arrow_table_impl::pull_rows(array<T>& block, const range& rows) const {
+    const int64_t p = get_column_count();
+    const int64_t row_count = get_checked_row_count(rows, get_row_count());
+    const int64_t block_size = row_count * p;
+    const data_type block_dtype = make_data_type<T>();
+
+    if (p == 1 && block_dtype == meta_.features[0].dtype) {
+        auto col_data = reinterpret_cast<const T*>(columns_[0]);
+        block.reset_not_owning(col_data + rows.start_idx, block_size);
+        return;
+    }
+
+    if (!block.is_data_owner() || block.get_capacity() < block_size) {
+        block.reset(block_size);
+    } else if (block.get_size() < block_size) {
+        block.resize(block_size);
+    }
+
+    // Columns are gathered into the rows of the block one at a time,
+    // so only the requested rows are materialized
+    T* block_data = block.get_mutable_data();
+    for (int64_t j = 0; j < p; j++) {
+        const data_type dtype = meta_.features[j].dtype;
+        const int64_t type_size = get_data_type_size(dtype);
+        backend::convert_vector(columns_[j] + rows.start_idx * type_size, block_data + j,
+                                dtype, block_dtype,
+                                type_size, sizeof(T)*p,
+                                row_count);
+    }
+}
+
+template <typename T>
+void arrow_table_impl::push_back_rows(const array<T>&, const range&) {
+    throw std::runtime_error("arrow table is immutable");
+}
+
+template <typename T>
+void arrow_table_impl::pull_column(array<T>& block, int64_t idx, const range& rows) const {
+    if (idx < 0 || idx >= column_count_) {
+        throw std::out_of_range("arrow column index is out of range");
+    }
+    const int64_t block_size = get_checked_row_count(rows, get_row_count());
+    const data_type block_dtype = make_data_type<T>();
+    const data_type dtype = meta_.features[idx].dtype;
+
+    if (block_dtype == dtype) {
+        auto col_data = reinterpret_cast<const T*>(columns_[idx]);
+        block.reset_not_owning(col_data + rows.start_idx, block_size);
+    } else {
+        if (!block.is_data_owner() || block.get_capacity() < block_size) {
+            block.reset(block_size);
+        } else if (block.get_size() < block_size) {
+            block.resize(block_size);
+        }
+
+        auto src_ptr = columns_[idx] + rows.start_idx * get_data_type_size(dtype);
+        backend::convert_vector(src_ptr, block.get_mutable_data(),
+                                dtype, block_dtype, block_size);
+    }
+}
+
+template <typename T>
+void arrow_table_impl::push_back_column(const array<T>&, int64_t, const range&) {
+    throw std::runtime_error("arrow table is immutable");
+}
+
+template void arrow_table_impl::pull_rows(array<float>&, const range&) const;
+template void arrow_table_impl::pull_rows(array<double>&, const range&) const;
+template void arrow_table_impl::pull_rows(array<int32_t>&, const range&) const;
+
+template void arrow_table_impl::push_back_rows(const array<float>&, const range&);
+template void arrow_table_impl::push_back_rows(const array<double>&, const range&);
+template void arrow_table_impl::push_back_rows(const array<int32_t>&, const range&);
+
+template void arrow_table_impl::pull_column(array<float>& a, int64_t idx, const range& r) const;
+template void arrow_table_impl::pull_column(array<double>& a, int64_t idx, const range& r) const;
+template void arrow_table_impl::pull_column(array<int32_t>& a, int64_t idx, const range& r) const;
+
+template void arrow_table_impl::push_back_column(const array<float>& a, int64_t idx, const range& r);
+template void arrow_table_impl::push_back_column(const array<double>& a, int64_t idx, const range& r);
+template void arrow_table_impl::push_back_column(const array<int32_t>& a, int64_t idx, const range& r);
+
+} // namespace dal::backend
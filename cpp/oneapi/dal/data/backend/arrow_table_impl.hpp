@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/data/arrow_c_data_interface.hpp"
+#include "oneapi/dal/data/common_helpers.hpp"
+#include "oneapi/dal/data/table_metadata.hpp"
+
+#include <stdexcept>
+
+namespace dal::backend {
+
+// Read-only view of the Arrow record batch exported via the C data interface.
+// Column buffers are referenced as is, row blocks are materialized on pull only
+class arrow_table_impl {
+public:
+    // Empty table without columns and rows
+    arrow_table_impl()
+        : row_count_(0),
+          column_count_(0) {}
+
+    // Takes ownership of the record batch: the batch is released together with the last copy of the table.
+    // The schema is only read by the constructor and stays owned by the caller
+    arrow_table_impl(ArrowArray* record_batch, const ArrowSchema* schema);
+
+    std::int64_t get_column_count() const {
+        return column_count_;
+    }
+
+    std::int64_t get_row_count() const {
+        return row_count_;
+    }
+
+    const table_metadata& get_metadata() const {
+        return meta_;
+    }
+
+    const void* get_column_data(std::int64_t idx) const {
+        if (idx < 0 || idx >= column_count_) {
+            throw std::out_of_range("arrow column index is out of range");
+        }
+        return columns_[idx];
+    }
+
+    template <typename T>
+    void pull_rows(array<T>& a, const range& r) const;
+
+    template <typename T>
+    void push_back_rows(const array<T>& a, const range& r);
+
+    template <typename T>
+    void pull_column(array<T>& a, std::int64_t idx, const range& r) const;
+
+    template <typename T>
+    void push_back_column(const array<T>& a, std::int64_t idx, const range& r);
+
+private:
+    std::int64_t row_count_;
+    std::int64_t column_count_;
+    table_metadata meta_;
+    array<const byte_t*> columns_;
+    detail::shared<ArrowArray> record_batch_;
+};
+
+} // namespace dal::backend
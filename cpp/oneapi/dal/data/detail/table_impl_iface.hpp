@@ -33,4 +33,9 @@ public:
     virtual const void* get_data() const = 0;
 };
 
+class arrow_table_impl_iface : public table_impl_iface {
+public:
+    virtual const void* get_column_data(std::int64_t idx) const = 0;
+};
+
 } // namespace dal::detail
@@ -20,8 +20,8 @@
 
 namespace dal::detail {
 
-template <typename TableImpl>
-class table_impl_wrapper : public table_impl_iface,
+template <typename TableImpl, typename TableImplIface = table_impl_iface>
+class table_impl_wrapper : public TableImplIface,
                            public base {
 public:
     table_impl_wrapper(TableImpl&& obj)
@@ -91,7 +91,7 @@ public:
         return impl_;
     }
 
-private:
+protected:
     TableImpl impl_;
 };
 
@@ -175,4 +175,15 @@ private:
     Impl impl_;
 };
 
+template <typename Impl>
+class arrow_table_impl_wrapper : public table_impl_wrapper<Impl, arrow_table_impl_iface> {
+public:
+    arrow_table_impl_wrapper(Impl&& obj)
+        : table_impl_wrapper<Impl, arrow_table_impl_iface>(std::move(obj)) { }
+
+    virtual const void* get_column_data(std::int64_t idx) const override {
+        return this->impl_.get_column_data(idx);
+    }
+};
+
 } // namespace dal::detail
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "oneapi/dal/data/backend/arrow_table_impl.hpp"
 #include "oneapi/dal/data/backend/empty_table_impl.hpp"
 #include "oneapi/dal/data/backend/homogen_table_impl.hpp"
 #include "oneapi/dal/data/table.hpp"
@@ -68,4 +69,21 @@ template homogen_table::homogen_table(int64_t, int64_t, const float*, data_layou
 template homogen_table::homogen_table(int64_t, int64_t, const double*, data_layout);
 template homogen_table::homogen_table(int64_t, int64_t, const std::int32_t*, data_layout);
 
+arrow_table::arrow_table()
+    : arrow_table(backend::arrow_table_impl{}) {}
+
+// Moved-from table stays an empty arrow table, so its arrow interface remains valid
+arrow_table::arrow_table(arrow_table&& t)
+    : table(t) {
+    t = arrow_table{};
+}
+
+arrow_table& arrow_table::operator=(arrow_table&& t) {
+    table::operator=(std::move(t));
+    return *this;
+}
+
+arrow_table::arrow_table(ArrowArray* record_batch, const ArrowSchema* schema)
+    : arrow_table(backend::arrow_table_impl(record_batch, schema)) {}
+
 } // namespace dal
@@ -18,6 +18,7 @@
 
 #include <type_traits>
 
+#include "oneapi/dal/data/arrow_c_data_interface.hpp"
 #include "oneapi/dal/data/detail/table_impl_wrapper.hpp"
 #include "oneapi/dal/util/type_traits.hpp"
 
@@ -88,4 +89,39 @@ private:
         : table(impl) {}
 };
 
+class arrow_table : public table {
+    friend detail::pimpl_accessor;
+    using pimpl = detail::pimpl<detail::arrow_table_impl_iface>;
+
+public:
+    arrow_table();
+    arrow_table(const arrow_table&) = default;
+    arrow_table(arrow_table&&);
+
+    template <typename Impl,
+              typename = std::enable_if_t<is_arrow_table_impl_v<std::decay_t<Impl>>>>
+    arrow_table(Impl&& impl) {
+        init_impl(new detail::arrow_table_impl_wrapper(std::forward<Impl>(impl)));
+    }
+
+    // Wraps the columns of the record batch without copying. The table takes ownership of
+    // the record batch (it is marked as released for the caller), the schema stays owned by the caller
+    arrow_table(ArrowArray* record_batch, const ArrowSchema* schema);
+
+    arrow_table& operator=(const arrow_table&) = default;
+    arrow_table& operator=(arrow_table&&);
+
+    template <typename DataType>
+    const DataType* get_column_data(std::int64_t column_index) const {
+        using impl_t = detail::arrow_table_impl_iface;
+
+        auto& impl = detail::get_impl<impl_t>(*this);
+        return reinterpret_cast<const DataType*>(impl.get_column_data(column_index));
+    }
+
+private:
+    arrow_table(const pimpl& impl)
+        : table(impl) {}
+};
+
 } // namespace dal
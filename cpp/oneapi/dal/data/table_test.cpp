@@ -352,3 +352,166 @@ TEST(homogen_table_test, can_read_table_data_via_row_accessor_and_array_outside)
         ASSERT_EQ(data_ptr[i], data[i]);
     }
 }
+
+// Record batch with float32 and float64 columns exported via the Arrow C data interface
+struct arrow_record_batch {
+    arrow_record_batch(std::int64_t offset = 0) {
+        float_buffers[1] = float_column;
+        double_buffers[1] = double_column;
+
+        columns[0] = ArrowArray{ 4, 0, 0, 2, 0, float_buffers, nullptr, nullptr, release_child, nullptr };
+        columns[1] = ArrowArray{ 4, 0, 0, 2, 0, double_buffers, nullptr, nullptr, release_child, nullptr };
+        column_ptrs[0] = &columns[0];
+        column_ptrs[1] = &columns[1];
+        batch = ArrowArray{ 4 - offset, 0, offset, 1, 2, batch_buffers, column_ptrs, nullptr, release, this };
+
+        column_schemas[0] = ArrowSchema{ "f", "x", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+        column_schemas[1] = ArrowSchema{ "g", "y", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+        column_schema_ptrs[0] = &column_schemas[0];
+        column_schema_ptrs[1] = &column_schemas[1];
+        schema = ArrowSchema{ "+s", "", nullptr, 0, 2, column_schema_ptrs, nullptr, nullptr, nullptr };
+    }
+
+    static void release_child(ArrowArray* a) {
+        a->release = nullptr;
+    }
+
+    static void release(ArrowArray* a) {
+        static_cast<arrow_record_batch*>(a->private_data)->release_count++;
+        a->release = nullptr;
+    }
+
+    float float_column[4] = { 1.f, 2.f, 3.f, 4.f };
+    double double_column[4] = { 10., 20., 30., 40. };
+    const void* float_buffers[2] = { nullptr, nullptr };
+    const void* double_buffers[2] = { nullptr, nullptr };
+    const void* batch_buffers[1] = { nullptr };
+
+    ArrowArray columns[2];
+    ArrowArray* column_ptrs[2];
+    ArrowArray batch;
+
+    ArrowSchema column_schemas[2];
+    ArrowSchema* column_schema_ptrs[2];
+    ArrowSchema schema;
+
+    int release_count = 0;
+};
+
+TEST(arrow_table_test, can_construct_table_without_copy) {
+    arrow_record_batch rb;
+    arrow_table t { &rb.batch, &rb.schema };
+
+    ASSERT_TRUE(t.has_data());
+    ASSERT_EQ(4, t.get_row_count());
+    ASSERT_EQ(2, t.get_column_count());
+    ASSERT_EQ(data_layout::column_major, t.get_metadata().layout);
+    ASSERT_EQ(data_type::float32, t.get_metadata().features[0].dtype);
+    ASSERT_EQ(data_type::float64, t.get_metadata().features[1].dtype);
+
+    ASSERT_EQ(rb.float_column, t.get_column_data<float>(0));
+    ASSERT_EQ(rb.double_column, t.get_column_data<double>(1));
+    ASSERT_EQ(nullptr, rb.batch.release);
+}
+
+TEST(arrow_table_test, can_construct_empty_table) {
+    arrow_table t;
+
+    ASSERT_FALSE(t.has_data());
+    ASSERT_EQ(0, t.get_row_count());
+    ASSERT_EQ(0, t.get_column_count());
+    ASSERT_EQ(0, t.get_metadata().features.get_size());
+    ASSERT_THROW(t.get_column_data<float>(0), std::out_of_range);
+}
+
+TEST(arrow_table_test, can_construct_table_with_move) {
+    arrow_record_batch rb;
+    arrow_table t1 { &rb.batch, &rb.schema };
+    arrow_table t2 = std::move(t1);
+
+    ASSERT_FALSE(t1.has_data());
+    ASSERT_THROW(t1.get_column_data<float>(0), std::out_of_range);
+
+    ASSERT_EQ(4, t2.get_row_count());
+    ASSERT_EQ(rb.float_column, t2.get_column_data<float>(0));
+}
+
+TEST(arrow_table_test, can_release_record_batch_with_last_table_reference) {
+    arrow_record_batch rb;
+    {
+        arrow_table t1 { &rb.batch, &rb.schema };
+        table t2 = t1;
+        t1 = arrow_table{};
+        ASSERT_EQ(0, rb.release_count);
+    }
+    ASSERT_EQ(1, rb.release_count);
+}
+
+TEST(arrow_table_test, can_read_column_via_column_accessor_without_copy) {
+    arrow_record_batch rb;
+    arrow_table t { &rb.batch, &rb.schema };
+
+    auto col = column_accessor<const double>(t).pull(1, {1, 3});
+
+    ASSERT_EQ(2, col.get_size());
+    ASSERT_FALSE(col.is_data_owner());
+    ASSERT_EQ(rb.double_column + 1, col.get_data());
+}
+
+TEST(arrow_table_test, can_read_rows_via_row_accessor) {
+    arrow_record_batch rb;
+    arrow_table t { &rb.batch, &rb.schema };
+
+    auto rows_block = row_accessor<const double>(t).pull({1, 3});
+
+    ASSERT_EQ(4, rows_block.get_size());
+    ASSERT_TRUE(rows_block.is_data_owner());
+    ASSERT_DOUBLE_EQ(2., rows_block[0]);
+    ASSERT_DOUBLE_EQ(20., rows_block[1]);
+    ASSERT_DOUBLE_EQ(3., rows_block[2]);
+    ASSERT_DOUBLE_EQ(30., rows_block[3]);
+}
+
+TEST(arrow_table_test, can_read_sliced_record_batch) {
+    arrow_record_batch rb { 2 };
+    arrow_table t { &rb.batch, &rb.schema };
+
+    ASSERT_EQ(2, t.get_row_count());
+    ASSERT_EQ(rb.float_column + 2, t.get_column_data<float>(0));
+
+    auto rows_block = row_accessor<const float>(t).pull();
+
+    ASSERT_EQ(4, rows_block.get_size());
+    ASSERT_FLOAT_EQ(3.f, rows_block[0]);
+    ASSERT_FLOAT_EQ(30.f, rows_block[1]);
+    ASSERT_FLOAT_EQ(4.f, rows_block[2]);
+    ASSERT_FLOAT_EQ(40.f, rows_block[3]);
+}
+
+TEST(arrow_table_test, cannot_read_rows_out_of_range) {
+    arrow_record_batch rb;
+    arrow_table t { &rb.batch, &rb.schema };
+
+    ASSERT_THROW(row_accessor<const float>(t).pull({ 2, 5 }), std::out_of_range);
+    ASSERT_THROW(row_accessor<const float>(t).pull({ -1, 2 }), std::out_of_range);
+    ASSERT_THROW(row_accessor<const float>(t).pull({ 3, 1 }), std::out_of_range);
+    ASSERT_EQ(0, row_accessor<const float>(t).pull({ 4, 4 }).get_size());
+}
+
+TEST(arrow_table_test, cannot_read_column_out_of_range) {
+    arrow_record_batch rb;
+    arrow_table t { &rb.batch, &rb.schema };
+
+    ASSERT_THROW(column_accessor<const float>(t).pull(2), std::out_of_range);
+    ASSERT_THROW(column_accessor<const float>(t).pull(-1), std::out_of_range);
+    ASSERT_THROW(column_accessor<const double>(t).pull(1, { 0, 5 }), std::out_of_range);
+}
+
+TEST(arrow_table_test, cannot_construct_table_with_null_values) {
+    arrow_record_batch rb;
+    const std::uint8_t validity[] = { 0b1101 };
+    rb.float_buffers[0] = validity;
+    rb.columns[0].null_count = 1;
+
+    ASSERT_THROW((arrow_table{ &rb.batch, &rb.schema }), std::invalid_argument);
+}
@@ -78,4 +78,14 @@ struct is_homogen_table_impl {
 template <typename T>
 inline constexpr bool is_homogen_table_impl_v = is_homogen_table_impl<T>::value;
 
+template <typename T>
+struct is_arrow_table_impl {
+    INSTANTIATE_HAS_METHOD_DEFAULT_CHECKER(const void*, get_column_data, (std::int64_t) const);
+
+    static constexpr bool value = is_table_impl_v<T> && has_method_get_column_data_v<T>;
+};
+
+template <typename T>
+inline constexpr bool is_arrow_table_impl_v = is_arrow_table_impl<T>::value;
+
 } // namespace dal
@@ -0,0 +1,232 @@
+/* file: assoc_rules_fpgrowth_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of association rules mining with the FP-Growth method in the
+!    batch processing mode.
+!
+!    The program recounts the supports of the found large item sets and the
+!    confidences of the found rules over the transactions, and checks that all
+!    large item sets of one and two items are found.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-ASSOC_RULES_FPGROWTH_BATCH"></a>
+ * \example assoc_rules_fpgrowth_batch.cpp
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/apriori.csv";
+
+/* FP-Growth algorithm parameters */
+const double minSupport    = 0.001; /* Minimum support */
+const double minConfidence = 0.7;   /* Minimum confidence */
+
+/* Largest allowed difference between the found and the recounted confidences of the rules */
+const double tolerance = 1e-5;
+
+typedef vector<vector<int> > ItemSets;
+
+ItemSets readTransactions(const NumericTablePtr & data);
+ItemSets readItemSets(const NumericTablePtr & table, size_t nItemSets);
+size_t getSupport(const ItemSets & transactions, const vector<int> & itemSet);
+size_t countSmallLargeItemSets(const ItemSets & transactions, size_t minSupportCount);
+size_t checkItemSets(const ItemSets & transactions, const association_rules::ResultPtr & res, size_t minSupportCount);
+size_t checkRules(const ItemSets & transactions, const association_rules::ResultPtr & res);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to mine association rules using the FP-Growth method */
+    association_rules::Batch<double, association_rules::fpGrowth> algorithm;
+
+    algorithm.input.set(association_rules::data, dataSource.getNumericTable());
+
+    algorithm.parameter.minSupport    = minSupport;
+    algorithm.parameter.minConfidence = minConfidence;
+
+    /* Find large item sets in the frequent pattern tree and construct association rules */
+    algorithm.compute();
+
+    association_rules::ResultPtr res = algorithm.getResult();
+
+    printAprioriItemsets(res->get(association_rules::largeItemsets), res->get(association_rules::largeItemsetsSupport));
+    printAprioriRules(res->get(association_rules::antecedentItemsets), res->get(association_rules::consequentItemsets),
+                      res->get(association_rules::confidence));
+
+    /* Transaction identifiers are numbered from zero, so the item sets of the transactions are listed by the identifiers */
+    const ItemSets transactions  = readTransactions(dataSource.getNumericTable());
+    const size_t minSupportCount = size_t(ceil(minSupport * transactions.size()));
+
+    size_t nErrors = checkItemSets(transactions, res, minSupportCount);
+    nErrors += checkRules(transactions, res);
+
+    if (nErrors)
+    {
+        cout << "ERROR: " << nErrors << " large item sets or rules found by the FP-Growth method do not match the transactions" << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/* Returns the number of large item sets with wrong supports, and the number of the missing large item sets of one and two items */
+size_t checkItemSets(const ItemSets & transactions, const association_rules::ResultPtr & res, size_t minSupportCount)
+{
+    const NumericTablePtr supportTable = res->get(association_rules::largeItemsetsSupport);
+    const size_t nItemSets             = supportTable->getNumberOfRows();
+    const ItemSets itemSets            = readItemSets(res->get(association_rules::largeItemsets), nItemSets);
+
+    BlockDescriptor<int> supportBlock;
+    supportTable->getBlockOfRows(0, nItemSets, readOnly, supportBlock);
+    const int * support = supportBlock.getBlockPtr();
+
+    size_t nErrors = 0, nSmallItemSets = 0;
+    for (size_t i = 0; i < nItemSets; i++)
+    {
+        const vector<int> & itemSet = itemSets[support[2 * i]];
+        const size_t itemSetSupport = getSupport(transactions, itemSet);
+        if (itemSetSupport != size_t(support[2 * i + 1]) || itemSetSupport < minSupportCount) nErrors++;
+        if (itemSet.size() <= 2) nSmallItemSets++;
+    }
+
+    supportTable->releaseBlockOfRows(supportBlock);
+
+    /* All the found item sets are large and have distinct identifiers, so none is missing if the numbers are equal */
+    const size_t nExpectedSmallItemSets = countSmallLargeItemSets(transactions, minSupportCount);
+    return nErrors + (nExpectedSmallItemSets > nSmallItemSets ? nExpectedSmallItemSets - nSmallItemSets : nSmallItemSets - nExpectedSmallItemSets);
+}
+
+/* Returns the number of rules which confidences differ from the recounted ones or are less than the minimum confidence */
+size_t checkRules(const ItemSets & transactions, const association_rules::ResultPtr & res)
+{
+    const NumericTablePtr confidenceTable = res->get(association_rules::confidence);
+    const size_t nRules                   = confidenceTable->getNumberOfRows();
+    const ItemSets antecedents            = readItemSets(res->get(association_rules::antecedentItemsets), nRules);
+    const ItemSets consequents            = readItemSets(res->get(association_rules::consequentItemsets), nRules);
+
+    BlockDescriptor<double> confidenceBlock;
+    confidenceTable->getBlockOfRows(0, nRules, readOnly, confidenceBlock);
+
+    size_t nErrors = 0;
+    for (size_t i = 0; i < nRules; i++)
+    {
+        vector<int> itemSet(antecedents[i]);
+        itemSet.insert(itemSet.end(), consequents[i].begin(), consequents[i].end());
+        sort(itemSet.begin(), itemSet.end());
+
+        const double confidence = double(getSupport(transactions, itemSet)) / double(getSupport(transactions, antecedents[i]));
+        if (fabs(confidence - confidenceBlock.getBlockPtr()[i]) > tolerance || confidence < minConfidence) nErrors++;
+    }
+
+    confidenceTable->releaseBlockOfRows(confidenceBlock);
+    return nErrors;
+}
+
+/* Returns the number of large item sets of one and two items counted over all pairs of items of the transactions */
+size_t countSmallLargeItemSets(const ItemSets & transactions, size_t minSupportCount)
+{
+    int nItems = 0;
+    for (size_t t = 0; t < transactions.size(); t++)
+    {
+        if (!transactions[t].empty()) nItems = max(nItems, transactions[t].back() + 1);
+    }
+
+    vector<size_t> support(size_t(nItems) * nItems, 0);
+    for (size_t t = 0; t < transactions.size(); t++)
+    {
+        const vector<int> & items = transactions[t];
+        for (size_t i = 0; i < items.size(); i++)
+        {
+            for (size_t j = i; j < items.size(); j++) support[items[i] * nItems + items[j]]++;
+        }
+    }
+
+    size_t nLarge = 0;
+    for (size_t i = 0; i < support.size(); i++)
+    {
+        if (support[i] >= minSupportCount) nLarge++;
+    }
+    return nLarge;
+}
+
+/* Returns the number of transactions that contain all items of the sorted item set */
+size_t getSupport(const ItemSets & transactions, const vector<int> & itemSet)
+{
+    size_t support = 0;
+    for (size_t t = 0; t < transactions.size(); t++)
+    {
+        if (includes(transactions[t].begin(), transactions[t].end(), itemSet.begin(), itemSet.end())) support++;
+    }
+    return support;
+}
+
+/* Reads the table of pairs (item set identifier, item) into the sorted item sets */
+ItemSets readItemSets(const NumericTablePtr & table, size_t nItemSets)
+{
+    const size_t nRows = table->getNumberOfRows();
+
+    BlockDescriptor<int> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+
+    ItemSets itemSets(nItemSets);
+    for (size_t i = 0; i < nRows; i++) itemSets[block.getBlockPtr()[2 * i]].push_back(block.getBlockPtr()[2 * i + 1]);
+    for (size_t i = 0; i < nItemSets; i++) sort(itemSets[i].begin(), itemSets[i].end());
+
+    table->releaseBlockOfRows(block);
+    return itemSets;
+}
+
+ItemSets readTransactions(const NumericTablePtr & data)
+{
+    const size_t nRows = data->getNumberOfRows();
+
+    BlockDescriptor<int> block;
+    data->getBlockOfRows(0, nRows, readOnly, block);
+
+    ItemSets transactions;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const size_t transactionId = block.getBlockPtr()[2 * i];
+        if (transactionId >= transactions.size()) transactions.resize(transactionId + 1);
+        transactions[transactionId].push_back(block.getBlockPtr()[2 * i + 1]);
+    }
+    for (size_t t = 0; t < transactions.size(); t++) sort(transactions[t].begin(), transactions[t].end());
+
+    data->releaseBlockOfRows(block);
+    return transactions;
+}
@@ -0,0 +1,157 @@
+/* file: block_compression.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the LZ4 and Zstandard compressors splitting the data
+!    into several blocks compressed in parallel
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-BLOCK_COMPRESSION"></a>
+ * \example block_compression.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace data_management;
+
+string datasetFileName = "../data/batch/logitboost_train.csv";
+
+const size_t blockSize        = 4096;  /* Size of the blocks compressed in parallel */
+const size_t maxDataBlockSize = 16384; /* Maximum size of an output data block */
+const size_t noiseSize        = 65536; /* Size of the incompressible data */
+
+/* Runs the compressor or the decompressor over the input until all the output is produced */
+template <typename Method>
+bool runAll(Method & method, vector<daal::byte> & in, vector<daal::byte> & out)
+{
+    out.clear();
+    method.setInputDataBlock(in.data(), in.size(), 0);
+    if (method.getErrors()->size() != 0) return false;
+
+    vector<daal::byte> outputBlock(maxDataBlockSize);
+    do
+    {
+        method.run(outputBlock.data(), maxDataBlockSize, 0);
+        out.insert(out.end(), outputBlock.begin(), outputBlock.begin() + method.getUsedOutputDataBlockSize());
+    } while (method.isOutputDataBlockFull());
+
+    return method.getErrors()->size() == 0;
+}
+
+template <CompressionMethod method>
+bool roundTrip(vector<daal::byte> & data, vector<daal::byte> & compressed)
+{
+    Compressor<method> compressor;
+    compressor.parameter.blockSize = blockSize;
+
+    vector<daal::byte> received;
+    Decompressor<method> decompressor;
+    if (!runAll(compressor, data, compressed) || !runAll(decompressor, compressed, received)) return false;
+
+    return received.size() == data.size()
+           && getCRC32(received.data(), 0, received.size()) == getCRC32(data.data(), 0, data.size());
+}
+
+template <CompressionMethod method>
+bool isRejected(vector<daal::byte> & corrupted)
+{
+    vector<daal::byte> received;
+    Decompressor<method> decompressor;
+    return !runAll(decompressor, corrupted, received);
+}
+
+template <CompressionMethod method>
+bool check(const string & methodName, vector<daal::byte> & text, vector<daal::byte> & noise)
+{
+    vector<daal::byte> compressedText, compressedNoise;
+
+    /* Text data is split into several blocks, each one compressed */
+    if (!roundTrip<method>(text, compressedText) || compressedText.size() >= text.size())
+    {
+        cout << "ERROR: " << methodName << " round trip of the text data failed" << endl;
+        return false;
+    }
+
+    /* Incompressible blocks are stored uncompressed after the block headers */
+    const size_t nBlocks = (noiseSize + blockSize - 1) / blockSize;
+    if (!roundTrip<method>(noise, compressedNoise) || compressedNoise.size() != noiseSize + 8 * nBlocks)
+    {
+        cout << "ERROR: " << methodName << " round trip of the incompressible data failed" << endl;
+        return false;
+    }
+
+    /* Truncated stream */
+    vector<daal::byte> corrupted(compressedText.begin(), compressedText.end() - 3);
+    if (!isRejected<method>(corrupted))
+    {
+        cout << "ERROR: " << methodName << " decompressor accepted the truncated data" << endl;
+        return false;
+    }
+
+    /* Compressed size in the header of the first block exceeds its uncompressed size */
+    corrupted.assign(compressedText.begin(), compressedText.end());
+    corrupted[7] = 0xff;
+    if (!isRejected<method>(corrupted))
+    {
+        cout << "ERROR: " << methodName << " decompressor accepted the corrupted block header" << endl;
+        return false;
+    }
+
+    cout << "OK: " << methodName << " compressed " << text.size() << " bytes of text into " << compressedText.size() << " bytes and "
+         << noise.size() << " bytes of noise into " << compressedNoise.size() << " bytes" << endl;
+    return true;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    daal::byte * data;
+    const size_t dataSize = readTextFile(datasetFileName, &data);
+    vector<daal::byte> text(data, data + dataSize);
+    delete[] data;
+
+    /* Pseudo-random bytes do not compress */
+    vector<daal::byte> noise(noiseSize);
+    unsigned int state = 777;
+    for (size_t i = 0; i < noiseSize; i++)
+    {
+        state    = state * 1103515245u + 12345u;
+        noise[i] = (daal::byte)(state >> 24);
+    }
+
+    if (!check<lz4>("LZ4", text, noise)) return 1;
+    if (!check<zstd>("Zstandard", text, noise)) return 1;
+
+    /* Zstandard frames carry the checksum of their content, so a damaged compressed block is detected */
+    vector<daal::byte> compressed;
+    roundTrip<zstd>(text, compressed);
+    compressed[compressed.size() / 2] ^= 0x5a;
+    if (!isRejected<zstd>(compressed))
+    {
+        cout << "ERROR: Zstandard decompressor accepted the corrupted block" << endl;
+        return 1;
+    }
+
+    return 0;
+}
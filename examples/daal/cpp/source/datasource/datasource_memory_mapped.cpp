@@ -0,0 +1,104 @@
+/* file: datasource_memory_mapped.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of loading a .csv file mapped into memory and parsed in parallel
+!    compared with the data loaded by the sequential reader of the file
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASOURCE_MEMORY_MAPPED"></a>
+ * \example datasource_memory_mapped.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/qr.csv";
+
+const size_t nRowsInBlock = 3000;
+
+const CsvDataSourceOptions sequentialOptions = CsvDataSourceOptions::allocateNumericTable | CsvDataSourceOptions::createDictionaryFromContext;
+const CsvDataSourceOptions mappedOptions     = CsvDataSourceOptions::allocateNumericTable | CsvDataSourceOptions::createDictionaryFromContext
+                                           | CsvDataSourceOptions::memoryMapFile;
+
+/* Returns true if the tables contain bitwise equal values */
+bool isEqual(const NumericTablePtr & expected, const NumericTablePtr & actual)
+{
+    const size_t nRows = expected->getNumberOfRows();
+    const size_t nCols = expected->getNumberOfColumns();
+    if (actual->getNumberOfRows() != nRows || actual->getNumberOfColumns() != nCols) return false;
+
+    BlockDescriptor<float> expectedBlock, actualBlock;
+    expected->getBlockOfRows(0, nRows, readOnly, expectedBlock);
+    actual->getBlockOfRows(0, nRows, readOnly, actualBlock);
+    const bool result = (memcmp(expectedBlock.getBlockPtr(), actualBlock.getBlockPtr(), nRows * nCols * sizeof(float)) == 0);
+    expected->releaseBlockOfRows(expectedBlock);
+    actual->releaseBlockOfRows(actualBlock);
+    return result;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Load the whole file by the sequential reader and by the parallel parser of the mapped file */
+    FileDataSource<CSVFeatureManager> sequentialDataSource(datasetFileName, sequentialOptions);
+    FileDataSource<CSVFeatureManager> mappedDataSource(datasetFileName, mappedOptions);
+
+    sequentialDataSource.loadDataBlock();
+    mappedDataSource.loadDataBlock();
+
+    printNumericTable(mappedDataSource.getNumericTable(), "First 5 rows of the mapped file:", 5, 10);
+
+    if (!isEqual(sequentialDataSource.getNumericTable(), mappedDataSource.getNumericTable()))
+    {
+        cout << "ERROR: data loaded from the mapped file differs from the data loaded sequentially" << endl;
+        return 1;
+    }
+
+    /* Load the file block by block, the last block is incomplete */
+    FileDataSource<CSVFeatureManager> sequentialBlocks(datasetFileName, sequentialOptions);
+    FileDataSource<CSVFeatureManager> mappedBlocks(datasetFileName, mappedOptions);
+
+    size_t nLoadedRows = 0;
+    while (mappedBlocks.getStatus() != DataSourceIface::endOfData)
+    {
+        const size_t nRows = mappedBlocks.loadDataBlock(nRowsInBlock);
+        if (sequentialBlocks.loadDataBlock(nRowsInBlock) != nRows
+            || !isEqual(sequentialBlocks.getNumericTable(), mappedBlocks.getNumericTable()))
+        {
+            cout << "ERROR: block of the mapped file starting at row " << nLoadedRows << " differs from the block loaded sequentially" << endl;
+            return 1;
+        }
+        nLoadedRows += nRows;
+    }
+
+    if (nLoadedRows != sequentialDataSource.getNumericTable()->getNumberOfRows())
+    {
+        cout << "ERROR: " << nLoadedRows << " rows are loaded from the mapped file block by block" << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+/* file: dbscan_dense_kdtree_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense DBSCAN clustering in the batch processing mode with
+!    the neighborhood queries answered by the k-d tree.
+!
+!    The program checks the found core observations and clusters against the
+!    definitions of DBSCAN evaluated over all pairs of observations.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DBSCAN_KDTREE_BATCH"></a>
+ * \example dbscan_dense_kdtree_batch.cpp
+ */
+
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/dbscan_dense.csv";
+
+/* DBSCAN algorithm parameters */
+const float epsilon          = 0.04f;
+const size_t minObservations = 45;
+
+bool checkClusters(const NumericTablePtr & data, const dbscan::ResultPtr & result);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm object for the DBSCAN algorithm that uses the k-d tree to find the neighbors of the observations */
+    dbscan::Batch<float, dbscan::kdTreeDense> algorithm(epsilon, minObservations);
+
+    algorithm.input.set(dbscan::data, dataSource.getNumericTable());
+    algorithm.parameter().resultsToCompute = dbscan::computeCoreIndices;
+
+    algorithm.compute();
+
+    /* Print the clusterization results */
+    printNumericTable(algorithm.getResult()->get(dbscan::nClusters), "Number of clusters:");
+    printNumericTable(algorithm.getResult()->get(dbscan::assignments), "Assignments of first 20 observations:", 20);
+
+    if (!checkClusters(dataSource.getNumericTable(), algorithm.getResult())) return 1;
+
+    /* In the memory saving mode the k-d tree is built once and queried for one observation at a time */
+    algorithm.parameter().memorySavingMode = true;
+    algorithm.compute();
+
+    if (!checkClusters(dataSource.getNumericTable(), algorithm.getResult())) return 1;
+
+    return 0;
+}
+
+/* Checks the result against the neighborhoods of the observations computed over all pairs of observations:
+   - an observation is a core one if it has at least minObservations neighbors, the observation itself included,
+   - the neighboring core observations belong to the same cluster,
+   - a border observation belongs to the cluster of one of its core neighbors, a noise observation has no core neighbors */
+bool checkClusters(const NumericTablePtr & data, const dbscan::ResultPtr & result)
+{
+    const size_t nRows     = data->getNumberOfRows();
+    const size_t nFeatures = data->getNumberOfColumns();
+    const float epsilonP   = epsilon * epsilon;
+
+    const NumericTablePtr assignmentsTable = result->get(dbscan::assignments);
+    const NumericTablePtr coreIndicesTable = result->get(dbscan::coreIndices);
+    const size_t nCoreIndices              = coreIndicesTable->getNumberOfRows();
+
+    BlockDescriptor<float> dataBlock;
+    BlockDescriptor<int> assignmentsBlock, coreIndicesBlock, nClustersBlock;
+    data->getBlockOfRows(0, nRows, readOnly, dataBlock);
+    assignmentsTable->getBlockOfRows(0, nRows, readOnly, assignmentsBlock);
+    coreIndicesTable->getBlockOfRows(0, nCoreIndices, readOnly, coreIndicesBlock);
+    result->get(dbscan::nClusters)->getBlockOfRows(0, 1, readOnly, nClustersBlock);
+
+    const float * x         = dataBlock.getBlockPtr();
+    const int * assignments = assignmentsBlock.getBlockPtr();
+    const int nClusters     = nClustersBlock.getBlockPtr()[0];
+
+    vector<bool> isCore(nRows, false);
+    for (size_t i = 0; i < nCoreIndices; i++) isCore[coreIndicesBlock.getBlockPtr()[i]] = true;
+
+    size_t nErrors = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        size_t nNeighbors    = 0;
+        bool hasCoreNeighbor = false;
+        bool isInCoreCluster = false;
+        for (size_t j = 0; j < nRows; j++)
+        {
+            float distance = 0.0f;
+            for (size_t k = 0; k < nFeatures; k++)
+            {
+                const float diff = x[i * nFeatures + k] - x[j * nFeatures + k];
+                distance += diff * diff;
+            }
+            if (distance > epsilonP) continue;
+
+            nNeighbors++;
+            if (!isCore[j]) continue;
+
+            hasCoreNeighbor = true;
+            isInCoreCluster |= (assignments[i] == assignments[j]);
+            if (isCore[i] && assignments[i] != assignments[j]) nErrors++;
+        }
+
+        if (isCore[i] != (nNeighbors >= minObservations)) nErrors++;
+        if (assignments[i] < -1 || assignments[i] >= nClusters) nErrors++;
+        if (assignments[i] == -1 ? hasCoreNeighbor : !isInCoreCluster) nErrors++;
+    }
+
+    data->releaseBlockOfRows(dataBlock);
+    assignmentsTable->releaseBlockOfRows(assignmentsBlock);
+    coreIndicesTable->releaseBlockOfRows(coreIndicesBlock);
+    result->get(dbscan::nClusters)->releaseBlockOfRows(nClustersBlock);
+
+    if (nErrors)
+    {
+        cout << "ERROR: " << nErrors << " violations of the DBSCAN definitions are found in the clusterization results" << endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,225 @@
+/* file: df_cls_dense_compiled_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest classification in the batch processing mode
+!    with the prediction on the compiled layout of the trees.
+!
+!    The layout is built by the first prediction for the model and is reused by
+!    the next predictions of the same algorithm object. The program predicts the
+!    test data set as a whole and in parts and checks that the class
+!    probabilities sum up to one and that the predicted class is the most
+!    probable one.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_CLS_DENSE_COMPILED_BATCH"></a>
+ * \example df_cls_dense_compiled_batch.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::decision_forest::classification;
+
+/* Input data set parameters */
+string trainDatasetFileName               = "../data/batch/df_classification_train.csv";
+string testDatasetFileName                = "../data/batch/df_classification_test.csv";
+const size_t categoricalFeaturesIndices[] = { 2 };
+const size_t nFeatures                    = 3; /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees   = 50;
+const size_t nClasses = 5; /* Number of classes */
+
+/* Number of observations in the parts of the test data set predicted one by one */
+const size_t nRowsInPart = 100;
+
+/* Largest allowed difference of the sum of the class probabilities from one */
+const float tolerance = 1e-5f;
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+void setCategoricalFeatures(const NumericTablePtr & data);
+NumericTablePtr getRows(const NumericTablePtr & data, size_t iFirstRow, size_t nRows);
+size_t checkProbabilities(const classifier::prediction::ResultPtr & result);
+size_t countDifferentLabels(const NumericTablePtr & labels, size_t iFirstRow, const NumericTablePtr & partLabels);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData, trainLabels, testData, testLabels;
+    loadData(trainDatasetFileName, trainData, trainLabels);
+    loadData(testDatasetFileName, testData, testLabels);
+
+    /* Create an algorithm object to train the decision forest classification model */
+    training::Batch<> trainAlgorithm(nClasses);
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainLabels);
+    trainAlgorithm.parameter().nTrees          = nTrees;
+    trainAlgorithm.parameter().featuresPerNode = nFeatures;
+    trainAlgorithm.compute();
+
+    decision_forest::classification::ModelPtr model = trainAlgorithm.getResult()->get(classifier::training::model);
+
+    /* Create an algorithm object to predict the classes on the compiled layout of the trees */
+    prediction::Batch<float, prediction::compiledDense> algorithm(nClasses);
+    algorithm.input.set(classifier::prediction::model, model);
+    algorithm.parameter().votingMethod = prediction::weighted;
+    algorithm.parameter().resultsToEvaluate |= static_cast<DAAL_UINT64>(classifier::computeClassProbabilities);
+
+    /* The first prediction for the model compiles its trees */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.compute();
+
+    classifier::prediction::ResultPtr result = algorithm.getResult();
+    NumericTablePtr labels                   = result->get(classifier::prediction::prediction);
+    printNumericTable(labels, "Decision forest prediction results (first 10 rows):", 10);
+    printNumericTable(result->get(classifier::prediction::probabilities), "Decision forest probabilities results (first 10 rows):", 10);
+    printNumericTable(testLabels, "Ground truth (first 10 rows):", 10);
+
+    size_t nErrors = checkProbabilities(result);
+
+    /* The next predictions for the same model reuse the compiled trees */
+    const size_t nRows = testData->getNumberOfRows();
+    for (size_t iFirstRow = 0; iFirstRow < nRows; iFirstRow += nRowsInPart)
+    {
+        const size_t nPartRows = (iFirstRow + nRowsInPart < nRows ? nRowsInPart : nRows - iFirstRow);
+        algorithm.input.set(classifier::prediction::data, getRows(testData, iFirstRow, nPartRows));
+        algorithm.compute();
+
+        nErrors += checkProbabilities(algorithm.getResult());
+        nErrors += countDifferentLabels(labels, iFirstRow, algorithm.getResult()->get(classifier::prediction::prediction));
+    }
+
+    /* With the unweighted voting the class probabilities are the shares of the trees voting for the classes */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.parameter().votingMethod = prediction::unweighted;
+    algorithm.compute();
+
+    nErrors += checkProbabilities(algorithm.getResult());
+
+    if (nErrors)
+    {
+        cout << "ERROR: " << nErrors << " observations have inconsistent prediction results" << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/* Returns the number of observations which class probabilities do not sum up to one
+   or which predicted class is less probable than some other class */
+size_t checkProbabilities(const classifier::prediction::ResultPtr & result)
+{
+    const NumericTablePtr labels        = result->get(classifier::prediction::prediction);
+    const NumericTablePtr probabilities = result->get(classifier::prediction::probabilities);
+    const size_t nRows                  = labels->getNumberOfRows();
+
+    BlockDescriptor<int> labelsBlock;
+    BlockDescriptor<float> probabilitiesBlock;
+    labels->getBlockOfRows(0, nRows, readOnly, labelsBlock);
+    probabilities->getBlockOfRows(0, nRows, readOnly, probabilitiesBlock);
+
+    size_t nErrors = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const int label   = labelsBlock.getBlockPtr()[i];
+        const float * p   = probabilitiesBlock.getBlockPtr() + i * nClasses;
+        float sum         = 0.0f;
+        bool isMostLikely = (label >= 0 && label < int(nClasses));
+        for (size_t j = 0; j < nClasses; j++)
+        {
+            sum += p[j];
+            isMostLikely = isMostLikely && (p[j] <= p[label]);
+        }
+        if (!isMostLikely || !(fabs(sum - 1.0f) <= tolerance)) nErrors++;
+    }
+
+    labels->releaseBlockOfRows(labelsBlock);
+    probabilities->releaseBlockOfRows(probabilitiesBlock);
+    return nErrors;
+}
+
+/* Returns the number of observations of the part which labels differ from the labels predicted for the whole data set */
+size_t countDifferentLabels(const NumericTablePtr & labels, size_t iFirstRow, const NumericTablePtr & partLabels)
+{
+    const size_t nRows = partLabels->getNumberOfRows();
+
+    BlockDescriptor<int> labelsBlock, partLabelsBlock;
+    labels->getBlockOfRows(iFirstRow, nRows, readOnly, labelsBlock);
+    partLabels->getBlockOfRows(0, nRows, readOnly, partLabelsBlock);
+
+    size_t nDifferent = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (labelsBlock.getBlockPtr()[i] != partLabelsBlock.getBlockPtr()[i]) nDifferent++;
+    }
+
+    labels->releaseBlockOfRows(labelsBlock);
+    partLabels->releaseBlockOfRows(partLabelsBlock);
+    return nDifferent;
+}
+
+/* Copies the rows of the data set into the new numeric table with the same feature types */
+NumericTablePtr getRows(const NumericTablePtr & data, size_t iFirstRow, size_t nRows)
+{
+    NumericTablePtr part = HomogenNumericTable<>::create(nFeatures, nRows, NumericTable::doAllocate);
+    checkPtr(part.get());
+
+    BlockDescriptor<float> dataBlock, partBlock;
+    data->getBlockOfRows(iFirstRow, nRows, readOnly, dataBlock);
+    part->getBlockOfRows(0, nRows, writeOnly, partBlock);
+
+    for (size_t i = 0; i < nRows * nFeatures; i++) partBlock.getBlockPtr()[i] = dataBlock.getBlockPtr()[i];
+
+    data->releaseBlockOfRows(dataBlock);
+    part->releaseBlockOfRows(partBlock);
+
+    setCategoricalFeatures(part);
+    return part;
+}
+
+void setCategoricalFeatures(const NumericTablePtr & data)
+{
+    NumericTableDictionaryPtr pDictionary = data->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    setCategoricalFeatures(pData);
+}
@@ -0,0 +1,237 @@
+/* file: df_reg_dense_traverse_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest regression in the batch processing mode.
+!
+!    The program trains the decision forest regression models with and without
+!    categorical features and checks that the predicted values match the values
+!    computed by the traversal of the model trees one observation at a time.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_REG_DENSE_TRAVERSE_BATCH"></a>
+ * \example df_reg_dense_traverse_batch.cpp
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::decision_forest::regression;
+
+/* Input data set parameters */
+string trainDatasetFileName               = "../data/batch/df_regression_train.csv";
+string testDatasetFileName                = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees = 10;
+
+/* Largest absolute difference of the predicted values allowed in this example */
+const double tolerance = 1e-4;
+
+/* Tree node in the order of the depth-first traversal of the tree */
+struct Node
+{
+    size_t level;
+    bool isLeaf;
+    size_t featureIndex;
+    double value; /* Split threshold or category of the split node, response of the leaf node */
+};
+
+/** Visitor class implementing TreeNodeVisitor interface, collects the nodes of the tree in the depth-first order */
+class CollectNodesVisitor : public daal::algorithms::tree_utils::regression::TreeNodeVisitor
+{
+public:
+    CollectNodesVisitor(vector<Node> & nodes) : _nodes(nodes) {}
+
+    virtual bool onLeafNode(const daal::algorithms::tree_utils::regression::LeafNodeDescriptor & desc)
+    {
+        Node node = { desc.level, true, 0, desc.response };
+        _nodes.push_back(node);
+        return true;
+    }
+
+    virtual bool onSplitNode(const daal::algorithms::tree_utils::regression::SplitNodeDescriptor & desc)
+    {
+        Node node = { desc.level, false, desc.featureIndex, desc.featureValue };
+        _nodes.push_back(node);
+        return true;
+    }
+
+private:
+    vector<Node> & _nodes;
+};
+
+void loadData(const string & fileName, bool useCategoricalFeatures, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+int checkModel(bool useCategoricalFeatures);
+NumericTablePtr traverseModel(const ModelPtr & model, const NumericTablePtr & data, bool useCategoricalFeatures);
+double predictByTree(const vector<Node> & nodes, const float * x, bool useCategoricalFeatures);
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    /* The models without categorical features are predicted by the blocks of observations traversing the trees in lock-step.
+       The number of the test observations is not a multiple of the block size, so the last block is incomplete */
+    if (checkModel(false)) return 1;
+    if (checkModel(true)) return 1;
+
+    return 0;
+}
+
+int checkModel(bool useCategoricalFeatures)
+{
+    NumericTablePtr trainData, trainDependentVariable;
+    loadData(trainDatasetFileName, useCategoricalFeatures, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the decision forest regression model with the default method */
+    training::Batch<> trainAlgorithm;
+    trainAlgorithm.input.set(training::data, trainData);
+    trainAlgorithm.input.set(training::dependentVariable, trainDependentVariable);
+    trainAlgorithm.parameter().nTrees = nTrees;
+    trainAlgorithm.compute();
+
+    ModelPtr model = trainAlgorithm.getResult()->get(training::model);
+
+    NumericTablePtr testData, testGroundTruth;
+    loadData(testDatasetFileName, useCategoricalFeatures, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of decision forest regression */
+    prediction::Batch<> predictAlgorithm;
+    predictAlgorithm.input.set(prediction::data, testData);
+    predictAlgorithm.input.set(prediction::model, model);
+    predictAlgorithm.compute();
+
+    NumericTablePtr prediction = predictAlgorithm.getResult()->get(prediction::prediction);
+    printNumericTable(prediction, useCategoricalFeatures ? "Decision forest prediction results with categorical features (first 10 rows):" :
+                                                           "Decision forest prediction results (first 10 rows):",
+                      10);
+
+    const double difference = maxAbsDifference(prediction, traverseModel(model, testData, useCategoricalFeatures));
+    cout << "Maximal difference from the values computed by the traversal of the trees: " << difference << endl << endl;
+
+    if (!(difference <= tolerance))
+    {
+        cout << "ERROR: the predicted values differ from the values computed by the traversal of the trees" << endl;
+        return 1;
+    }
+    return 0;
+}
+
+NumericTablePtr traverseModel(const ModelPtr & model, const NumericTablePtr & data, bool useCategoricalFeatures)
+{
+    const size_t nRows     = data->getNumberOfRows();
+    NumericTablePtr result = HomogenNumericTable<>::create(1, nRows, NumericTable::doAllocate, 0.0f);
+
+    BlockDescriptor<float> dataBlock, resultBlock;
+    data->getBlockOfRows(0, nRows, readOnly, dataBlock);
+    result->getBlockOfRows(0, nRows, readWrite, resultBlock);
+
+    for (size_t iTree = 0; iTree < model->getNumberOfTrees(); iTree++)
+    {
+        vector<Node> nodes;
+        CollectNodesVisitor visitor(nodes);
+        model->traverseDFS(iTree, visitor);
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            resultBlock.getBlockPtr()[i] += predictByTree(nodes, dataBlock.getBlockPtr() + i * nFeatures, useCategoricalFeatures);
+        }
+    }
+
+    /* The forest predicts the average of the responses of the trees */
+    for (size_t i = 0; i < nRows; i++) resultBlock.getBlockPtr()[i] /= model->getNumberOfTrees();
+
+    data->releaseBlockOfRows(dataBlock);
+    result->releaseBlockOfRows(resultBlock);
+    return result;
+}
+
+double predictByTree(const vector<Node> & nodes, const float * x, bool useCategoricalFeatures)
+{
+    size_t iNode = 0;
+    while (!nodes[iNode].isLeaf)
+    {
+        const Node & node  = nodes[iNode];
+        bool isCategorical = false;
+        for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+            isCategorical |= useCategoricalFeatures && (categoricalFeaturesIndices[i] == node.featureIndex);
+
+        /* The observation goes to the left child if it has the category of the split or does not exceed the threshold */
+        const double value  = x[node.featureIndex];
+        const bool goesLeft = isCategorical ? (int(value) == int(node.value)) : (value <= node.value);
+
+        /* The left child follows the split node, the right child is the next node of the same level after the left subtree */
+        iNode++;
+        if (!goesLeft)
+        {
+            iNode++;
+            while (nodes[iNode].level != node.level + 1) iNode++;
+        }
+    }
+    return nodes[iNode].value;
+}
+
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs)
+{
+    const size_t nRows = lhs->getNumberOfRows();
+
+    BlockDescriptor<float> lhsBlock, rhsBlock;
+    lhs->getBlockOfRows(0, nRows, readOnly, lhsBlock);
+    rhs->getBlockOfRows(0, nRows, readOnly, rhsBlock);
+
+    double difference = 0.0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const double d = fabs(lhsBlock.getBlockPtr()[i] - rhsBlock.getBlockPtr()[i]);
+        if (d > difference) difference = d;
+    }
+
+    lhs->releaseBlockOfRows(lhsBlock);
+    rhs->releaseBlockOfRows(rhsBlock);
+    return difference;
+}
+
+void loadData(const string & fileName, bool useCategoricalFeatures, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    if (!useCategoricalFeatures) return;
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
@@ -0,0 +1,197 @@
+/* file: df_row_predictor.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest classification and regression prediction
+!    of one observation at a time compared with the batch prediction
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_ROW_PREDICTOR"></a>
+ * \example df_row_predictor.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string clsTrainDatasetFileName = "../data/batch/df_classification_train.csv";
+string clsTestDatasetFileName  = "../data/batch/df_classification_test.csv";
+string regTrainDatasetFileName = "../data/batch/df_regression_train.csv";
+string regTestDatasetFileName  = "../data/batch/df_regression_test.csv";
+
+const size_t clsCategoricalFeaturesIndices[] = { 2 };
+const size_t nClsFeatures                    = 3;  /* Number of features in the classification data sets */
+const size_t nRegFeatures                    = 13; /* Number of features in the regression data sets */
+const size_t nClasses                        = 5;  /* Number of classes */
+
+/* Decision forest parameters */
+const size_t nTrees = 50;
+
+/* Largest allowed difference between the responses and probabilities predicted one row at a time and in the batch */
+const float tolerance = 1e-5f;
+
+void loadData(const string & fileName, size_t nFeatures, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+bool checkClassification();
+bool checkRegression();
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 4, &clsTrainDatasetFileName, &clsTestDatasetFileName, &regTrainDatasetFileName, &regTestDatasetFileName);
+
+    if (!checkClassification() || !checkRegression()) return 1;
+    return 0;
+}
+
+bool checkClassification()
+{
+    NumericTablePtr trainData, trainLabels, testData, testLabels;
+    loadData(clsTrainDatasetFileName, nClsFeatures, trainData, trainLabels);
+    loadData(clsTestDatasetFileName, nClsFeatures, testData, testLabels);
+
+    NumericTableDictionaryPtr pDictionary = trainData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(clsCategoricalFeaturesIndices) / sizeof(clsCategoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[clsCategoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+
+    /* Train the decision forest classification model */
+    decision_forest::classification::training::Batch<float> trainAlgorithm(nClasses);
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainLabels);
+    trainAlgorithm.parameter().nTrees          = nTrees;
+    trainAlgorithm.parameter().featuresPerNode = nClsFeatures;
+    trainAlgorithm.compute();
+
+    decision_forest::classification::ModelPtr model = trainAlgorithm.getResult()->get(classifier::training::model);
+
+    /* Predict the labels and the probabilities of the classes of the whole test data set */
+    decision_forest::classification::prediction::Batch<float> algorithm(nClasses);
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, model);
+    algorithm.parameter().resultsToEvaluate |= static_cast<DAAL_UINT64>(classifier::computeClassProbabilities);
+    algorithm.compute();
+
+    NumericTablePtr labels        = algorithm.getResult()->get(classifier::prediction::prediction);
+    NumericTablePtr probabilities = algorithm.getResult()->get(classifier::prediction::probabilities);
+    printNumericTable(labels, "Decision forest classification results (first 10 rows):", 10);
+
+    /* Predict the same observations one at a time, the training data defines the categorical features */
+    decision_forest::classification::prediction::RowPredictor<float> rowPredictor;
+    if (!rowPredictor.prepare(model, algorithm.parameter(), trainData))
+    {
+        cout << "ERROR: decision forest classification row predictor is not prepared" << endl;
+        return false;
+    }
+
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<float> xBlock, labelsBlock, probabilitiesBlock;
+    testData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    labels->getBlockOfRows(0, nRows, readOnly, labelsBlock);
+    probabilities->getBlockOfRows(0, nRows, readOnly, probabilitiesBlock);
+
+    bool result = true;
+    vector<float> rowProbabilities(nClasses);
+    for (size_t i = 0; i < nRows && result; ++i)
+    {
+        float rowLabel = 0.0f;
+        rowPredictor.predict(xBlock.getBlockPtr() + i * nClsFeatures, &rowLabel, rowProbabilities.data());
+        result = (rowLabel == labelsBlock.getBlockPtr()[i]);
+        for (size_t j = 0; j < nClasses && result; ++j)
+        {
+            result = (fabs(rowProbabilities[j] - probabilitiesBlock.getBlockPtr()[i * nClasses + j]) <= tolerance);
+        }
+        if (!result) cout << "ERROR: decision forest classification of the row " << i << " differs from the batch prediction" << endl;
+    }
+
+    testData->releaseBlockOfRows(xBlock);
+    labels->releaseBlockOfRows(labelsBlock);
+    probabilities->releaseBlockOfRows(probabilitiesBlock);
+    return result;
+}
+
+bool checkRegression()
+{
+    NumericTablePtr trainData, trainResponses, testData, testResponses;
+    loadData(regTrainDatasetFileName, nRegFeatures, trainData, trainResponses);
+    loadData(regTestDatasetFileName, nRegFeatures, testData, testResponses);
+
+    /* Train the decision forest regression model */
+    decision_forest::regression::training::Batch<float> trainAlgorithm;
+    trainAlgorithm.input.set(decision_forest::regression::training::data, trainData);
+    trainAlgorithm.input.set(decision_forest::regression::training::dependentVariable, trainResponses);
+    trainAlgorithm.parameter().nTrees = nTrees;
+    trainAlgorithm.compute();
+
+    decision_forest::regression::ModelPtr model = trainAlgorithm.getResult()->get(decision_forest::regression::training::model);
+
+    /* Predict the responses of the whole test data set */
+    decision_forest::regression::prediction::Batch<float> algorithm;
+    algorithm.input.set(decision_forest::regression::prediction::data, testData);
+    algorithm.input.set(decision_forest::regression::prediction::model, model);
+    algorithm.compute();
+
+    NumericTablePtr responses = algorithm.getResult()->get(decision_forest::regression::prediction::prediction);
+    printNumericTable(responses, "Decision forest regression results (first 10 rows):", 10);
+
+    /* Predict the same observations one at a time */
+    decision_forest::regression::prediction::RowPredictor<float> rowPredictor;
+    if (!rowPredictor.prepare(model, trainData))
+    {
+        cout << "ERROR: decision forest regression row predictor is not prepared" << endl;
+        return false;
+    }
+
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<float> xBlock, responsesBlock;
+    testData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    responses->getBlockOfRows(0, nRows, readOnly, responsesBlock);
+
+    bool result = true;
+    for (size_t i = 0; i < nRows && result; ++i)
+    {
+        float rowResponse    = 0.0f;
+        const float expected = responsesBlock.getBlockPtr()[i];
+        rowPredictor.predict(xBlock.getBlockPtr() + i * nRegFeatures, &rowResponse);
+        result = (fabs(rowResponse - expected) <= tolerance * (1.0f + fabs(expected)));
+        if (!result) cout << "ERROR: decision forest regression of the row " << i << " differs from the batch prediction" << endl;
+    }
+
+    testData->releaseBlockOfRows(xBlock);
+    responses->releaseBlockOfRows(responsesBlock);
+    return result;
+}
+
+void loadData(const string & fileName, size_t nFeatures, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<float>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,180 @@
+/* file: gbt_cls_shap_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of SHAP values computation with gradient boosted trees classification
+!    in the batch processing mode.
+!
+!    The program trains the gradient boosted trees classification model, computes
+!    the SHAP feature contributions to the raw boosted values of every class
+!    and checks that the class probabilities are restored from them.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_CLS_SHAP_DENSE_BATCH"></a>
+ * \example gbt_cls_shap_dense_batch.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::classification;
+
+/* Input data set parameters */
+string trainDatasetFileName               = "../data/batch/df_classification_train.csv";
+string testDatasetFileName                = "../data/batch/df_classification_test.csv";
+const size_t categoricalFeaturesIndices[] = { 2 };
+const size_t nFeatures                    = 3; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations             = 40;
+const size_t minObservationsInLeafNode = 8;
+
+const size_t nClasses = 5; /* Number of classes */
+
+/* Tolerance of the probabilities restored from SHAP values */
+const double eps = 1e-3;
+
+training::ResultPtr trainModel();
+int testModel(const training::ResultPtr & res);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    return testModel(trainingResult);
+}
+
+training::ResultPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the gradient boosted trees classification model */
+    training::Batch<> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainDependentVariable);
+
+    algorithm.parameter().maxIterations             = maxIterations;
+    algorithm.parameter().featuresPerNode           = nFeatures;
+    algorithm.parameter().minObservationsInLeafNode = minObservationsInLeafNode;
+
+    /* Build the gradient boosted trees classification model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult();
+}
+
+int testModel(const training::ResultPtr & trainingResult)
+{
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of gradient boosted trees classification */
+    prediction::Batch<> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Request the SHAP feature contributions in addition to the class probabilities */
+    algorithm.parameter().resultsToEvaluate = classifier::computeClassProbabilities | prediction::computeShapContributions;
+
+    /* Predict values of gradient boosted trees classification and compute their SHAP values */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results, the SHAP values are stored in the result of the gradient boosted trees */
+    prediction::ResultPtr predictionResult = prediction::Result::cast(algorithm.getResult());
+    NumericTablePtr probabilitiesTable     = predictionResult->get(classifier::prediction::probabilities);
+    NumericTablePtr contributionsTable     = predictionResult->get(prediction::predictionContributions);
+    printNumericTable(probabilitiesTable, "Gradient boosted trees class probabilities (first 10 rows):", 10);
+    printNumericTable(contributionsTable, "SHAP feature contributions of every class (first 10 rows):", 10);
+
+    /* The contributions of a class add up to its raw boosted value, the class probabilities are their softmax */
+    const size_t nRows = testData->getNumberOfRows();
+    const size_t nPhi  = nFeatures + 1;
+    BlockDescriptor<> probabilitiesBlock, contributionsBlock;
+    probabilitiesTable->getBlockOfRows(0, nRows, readOnly, probabilitiesBlock);
+    contributionsTable->getBlockOfRows(0, nRows, readOnly, contributionsBlock);
+    const float * const probabilities = probabilitiesBlock.getBlockPtr();
+    const float * const contributions = contributionsBlock.getBlockPtr();
+
+    double maxError = 0;
+    double rawValues[nClasses];
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        double maxRawValue = 0;
+        for (size_t c = 0; c < nClasses; ++c)
+        {
+            const float * const phi = contributions + (i * nClasses + c) * nPhi;
+            rawValues[c]            = 0;
+            for (size_t j = 0; j < nPhi; ++j) rawValues[c] += phi[j];
+            maxRawValue = (c == 0 || rawValues[c] > maxRawValue) ? rawValues[c] : maxRawValue;
+        }
+        double expSum = 0;
+        for (size_t c = 0; c < nClasses; ++c) expSum += exp(rawValues[c] - maxRawValue);
+        for (size_t c = 0; c < nClasses; ++c)
+            maxError = max(maxError, abs(exp(rawValues[c] - maxRawValue) / expSum - probabilities[i * nClasses + c]));
+    }
+
+    probabilitiesTable->releaseBlockOfRows(probabilitiesBlock);
+    contributionsTable->releaseBlockOfRows(contributionsBlock);
+
+    cout << "Max deviation of the probabilities restored from SHAP values: " << maxError << endl;
+    if (maxError > eps)
+    {
+        cout << "ERROR: SHAP values do not add up to the raw boosted values" << endl;
+        return 1;
+    }
+    return 0;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
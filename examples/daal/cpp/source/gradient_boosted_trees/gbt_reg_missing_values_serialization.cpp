@@ -0,0 +1,206 @@
+/* file: gbt_reg_missing_values_serialization.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression on the data with missing values.
+!
+!    The program trains the gradient boosted trees regression model on a training
+!    data set where some feature values are missing (NaN), serializes and deserializes
+!    the model and checks that both models give the same predictions on the test data
+!    with missing values.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_MISSING_VALUES_SERIALIZATION"></a>
+ * \example gbt_reg_missing_values_serialization.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <limits>
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName         = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName          = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Features and rows where the values are replaced with NaN */
+const size_t missingFeaturesIndices[] = { 0, 5, 12 };
+const size_t missingRowsStep          = 4;
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+ModelPtr trainModel();
+NumericTablePtr testModel(const ModelPtr & model, const NumericTablePtr & testData);
+ModelPtr serializeDeserializeModel(const ModelPtr & model);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+void setMissingValues(const NumericTablePtr & pData);
+bool isEqual(const NumericTablePtr & first, const NumericTablePtr & second);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    ModelPtr trainedModel  = trainModel();
+    ModelPtr restoredModel = serializeDeserializeModel(trainedModel);
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+    setMissingValues(testData);
+
+    NumericTablePtr trainedPrediction  = testModel(trainedModel, testData);
+    NumericTablePtr restoredPrediction = testModel(restoredModel, testData);
+
+    printNumericTable(trainedPrediction, "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    if (isEqual(trainedPrediction, restoredPrediction))
+    {
+        std::cout << "Model was serialized and deserialized successfully" << std::endl;
+    }
+    else
+    {
+        std::cout << "Predictions of the deserialized model differ from the predictions of the trained model" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+ModelPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+    setMissingValues(trainData);
+
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(training::model);
+}
+
+NumericTablePtr testModel(const ModelPtr & model, const NumericTablePtr & testData)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, model);
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+ModelPtr serializeDeserializeModel(const ModelPtr & model)
+{
+    /* Serialize the model into the data archive */
+    InputDataArchive inputArch;
+    model->serialize(inputArch);
+
+    /* Store the serialized data in an array */
+    const size_t length = inputArch.getSizeOfArchive();
+    daal::byte * buffer = new daal::byte[length];
+    inputArch.copyArchiveToArray(buffer, length);
+
+    /* Deserialize the model from the array */
+    OutputDataArchive outputArch(buffer, length);
+    ModelPtr restoredModel = Model::create(nFeatures);
+    checkPtr(restoredModel.get());
+    restoredModel->deserialize(outputArch);
+
+    delete[] buffer;
+    return restoredModel;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
+
+void setMissingValues(const NumericTablePtr & pData)
+{
+    const size_t nRows = pData->getNumberOfRows();
+
+    BlockDescriptor<float> block;
+    pData->getBlockOfRows(0, nRows, readWrite, block);
+    float * data = block.getBlockPtr();
+
+    /* Missing values are placed in different rows for different features */
+    for (size_t j = 0, n = sizeof(missingFeaturesIndices) / sizeof(missingFeaturesIndices[0]); j < n; ++j)
+    {
+        for (size_t i = j; i < nRows; i += missingRowsStep) data[i * nFeatures + missingFeaturesIndices[j]] = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    pData->releaseBlockOfRows(block);
+}
+
+bool isEqual(const NumericTablePtr & first, const NumericTablePtr & second)
+{
+    const size_t nRows = first->getNumberOfRows();
+    if (second->getNumberOfRows() != nRows) return false;
+
+    BlockDescriptor<float> firstBlock;
+    BlockDescriptor<float> secondBlock;
+    first->getBlockOfRows(0, nRows, readOnly, firstBlock);
+    second->getBlockOfRows(0, nRows, readOnly, secondBlock);
+
+    bool result = true;
+    for (size_t i = 0; i < nRows && result; ++i) result = (firstBlock.getBlockPtr()[i] == secondBlock.getBlockPtr()[i]);
+
+    first->releaseBlockOfRows(firstBlock);
+    second->releaseBlockOfRows(secondBlock);
+    return result;
+}
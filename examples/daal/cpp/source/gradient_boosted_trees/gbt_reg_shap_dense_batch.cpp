@@ -0,0 +1,176 @@
+/* file: gbt_reg_shap_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of SHAP values computation with gradient boosted trees regression
+!    in the batch processing mode.
+!
+!    The program trains the gradient boosted trees regression model, computes
+!    the SHAP feature contributions and interaction values of the test data
+!    and checks that they add up to the predicted responses.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_SHAP_DENSE_BATCH"></a>
+ * \example gbt_reg_shap_dense_batch.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+string trainDatasetFileName               = "../data/batch/df_regression_train.csv";
+string testDatasetFileName                = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+/* Relative tolerance of the sums of SHAP values */
+const double eps = 1e-3;
+
+training::ResultPtr trainModel();
+int testModel(const training::ResultPtr & res);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    return testModel(trainingResult);
+}
+
+training::ResultPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the gradient boosted trees regression model */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult();
+}
+
+int testModel(const training::ResultPtr & trainingResult)
+{
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Request the SHAP values in addition to the predicted responses */
+    algorithm.parameter().resultsToCompute = prediction::computeShapContributions | prediction::computeShapInteractions;
+
+    /* Predict values of gradient boosted trees regression and compute their SHAP values */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    NumericTablePtr predictionTable        = predictionResult->get(prediction::prediction);
+    NumericTablePtr contributionsTable     = predictionResult->get(prediction::predictionContributions);
+    NumericTablePtr interactionsTable      = predictionResult->get(prediction::predictionInteractions);
+    printNumericTable(predictionTable, "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(contributionsTable, "SHAP feature contributions, the last column holds the bias term (first 10 rows):", 10);
+
+    /* The contributions of every observation add up to its predicted response,
+       and the interaction values of a feature add up to its contribution */
+    const size_t nRows = testData->getNumberOfRows();
+    const size_t nPhi  = nFeatures + 1;
+    BlockDescriptor<> predictionBlock, contributionsBlock, interactionsBlock;
+    predictionTable->getBlockOfRows(0, nRows, readOnly, predictionBlock);
+    contributionsTable->getBlockOfRows(0, nRows, readOnly, contributionsBlock);
+    interactionsTable->getBlockOfRows(0, nRows, readOnly, interactionsBlock);
+    const float * const predictions   = predictionBlock.getBlockPtr();
+    const float * const contributions = contributionsBlock.getBlockPtr();
+    const float * const interactions  = interactionsBlock.getBlockPtr();
+
+    double maxError = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const float * const phi = contributions + i * nPhi;
+        double sum              = 0;
+        for (size_t j = 0; j < nPhi; ++j)
+        {
+            sum += phi[j];
+            double interactionsSum = 0;
+            for (size_t k = 0; k < nPhi; ++k) interactionsSum += interactions[(i * nPhi + j) * nPhi + k];
+            maxError = max(maxError, abs(interactionsSum - phi[j]) / max(1.0, abs(double(phi[j]))));
+        }
+        maxError = max(maxError, abs(sum - predictions[i]) / max(1.0, abs(double(predictions[i]))));
+    }
+
+    predictionTable->releaseBlockOfRows(predictionBlock);
+    contributionsTable->releaseBlockOfRows(contributionsBlock);
+    interactionsTable->releaseBlockOfRows(interactionsBlock);
+
+    cout << "Max relative deviation of the sums of SHAP values: " << maxError << endl;
+    if (maxError > eps)
+    {
+        cout << "ERROR: SHAP values do not add up to the predicted responses" << endl;
+        return 1;
+    }
+    return 0;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
@@ -0,0 +1,155 @@
+/* file: impl_als_csr_cg_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the implicit alternating least squares (ALS) algorithm in
+!    the batch processing mode with the conjugate gradient update of factors.
+!
+!    The program trains the implicit ALS model with the exact Cholesky solver
+!    and with the conjugate gradient solver and compares the predicted ratings.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-IMPLICIT_ALS_CSR_CG_BATCH"></a>
+ * \example impl_als_csr_cg_batch.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::implicit_als;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/implicit_als_csr.csv";
+
+typedef double algorithmFPType; /* Algorithm floating-point type */
+
+/* Algorithm parameters */
+const size_t nFactors = 4;
+
+/* Conjugate gradient converges in at most nFactors iterations, so the result matches the exact solution */
+const size_t nCGIterations = nFactors;
+
+/* Largest absolute difference of the predicted ratings allowed in this example */
+const double tolerance = 1e-4;
+
+NumericTablePtr dataTable;
+ModelPtr initialModel;
+
+void initializeModel();
+NumericTablePtr trainAndPredict(size_t nIterationsOfCG);
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    initializeModel();
+
+    /* Solve the systems of normal equations exactly by Cholesky decomposition */
+    NumericTablePtr choleskyRatings = trainAndPredict(0);
+
+    /* Approximate the solutions of the systems by conjugate gradient iterations */
+    NumericTablePtr cgRatings      = trainAndPredict(nCGIterations);
+    NumericTablePtr shortCGRatings = trainAndPredict(1);
+
+    printNumericTable(cgRatings, "Predicted ratings (conjugate gradient):", 10);
+
+    const double difference = maxAbsDifference(choleskyRatings, cgRatings);
+    cout << "Maximal difference from the Cholesky solver with " << nCGIterations << " conjugate gradient iterations: " << difference << endl;
+    cout << "Maximal difference from the Cholesky solver with 1 conjugate gradient iteration: "
+         << maxAbsDifference(choleskyRatings, shortCGRatings) << endl;
+
+    if (!(difference <= tolerance))
+    {
+        cout << "ERROR: the conjugate gradient solver gives ratings that differ from the Cholesky solver ones" << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+void initializeModel()
+{
+    /* Read trainDatasetFileName from a file and create a numeric table to store the input data */
+    dataTable = NumericTablePtr(createSparseTable<float>(trainDatasetFileName));
+
+    /* Create an algorithm object to initialize the implicit ALS model with the default method */
+    training::init::Batch<algorithmFPType, training::init::fastCSR> initAlgorithm;
+    initAlgorithm.parameter.nFactors = nFactors;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    initAlgorithm.input.set(training::init::data, dataTable);
+
+    /* Initialize the implicit ALS model */
+    initAlgorithm.compute();
+
+    initialModel = initAlgorithm.getResult()->get(training::init::model);
+}
+
+NumericTablePtr trainAndPredict(size_t nIterationsOfCG)
+{
+    /* Create an algorithm object to train the implicit ALS model with the default method */
+    training::Batch<algorithmFPType, training::fastCSR> algorithm;
+
+    /* Pass a training data set and the same initial model to every training */
+    algorithm.input.set(training::data, dataTable);
+    algorithm.input.set(training::inputModel, initialModel);
+
+    algorithm.parameter.nFactors      = nFactors;
+    algorithm.parameter.nCGIterations = nIterationsOfCG;
+
+    /* Build the implicit ALS model */
+    algorithm.compute();
+
+    /* Create an algorithm object to predict recommendations of the implicit ALS model */
+    prediction::ratings::Batch<algorithmFPType> predictAlgorithm;
+    predictAlgorithm.parameter.nFactors = nFactors;
+
+    predictAlgorithm.input.set(prediction::ratings::model, algorithm.getResult()->get(training::model));
+
+    predictAlgorithm.compute();
+
+    return predictAlgorithm.getResult()->get(prediction::ratings::prediction);
+}
+
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs)
+{
+    const size_t nRows = lhs->getNumberOfRows();
+    const size_t nCols = lhs->getNumberOfColumns();
+
+    BlockDescriptor<double> lhsBlock, rhsBlock;
+    lhs->getBlockOfRows(0, nRows, readOnly, lhsBlock);
+    rhs->getBlockOfRows(0, nRows, readOnly, rhsBlock);
+
+    double difference = 0.0;
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        const double d = fabs(lhsBlock.getBlockPtr()[i] - rhsBlock.getBlockPtr()[i]);
+        if (d > difference) difference = d;
+    }
+
+    lhs->releaseBlockOfRows(lhsBlock);
+    rhs->releaseBlockOfRows(rhsBlock);
+    return difference;
+}
@@ -55,6 +55,7 @@ typedef float algorithmFPType; /* Algorithm floating-point type */
 const size_t nUsers        = 46; /* Full number of users */
 const size_t nFactors      = 2;  /* Number of factors */
 const size_t maxIterations = 5;  /* Number of iterations in the implicit ALS training algorithm */
+const size_t nCGIterations = 2;  /* Number of conjugate gradient iterations that update each row of factors */
 
 CSRNumericTablePtr dataTable[nBlocks];
 CSRNumericTablePtr transposedDataTable[nBlocks];
@@ -218,11 +219,19 @@ KeyValueDataCollectionPtr computeStep3Local(const NumericTablePtr & offsetTable,
 }
 
 training::DistributedPartialResultStep4Ptr computeStep4Local(const CSRNumericTablePtr & dataTable, const NumericTablePtr & step2MasterResult,
-                                                             const KeyValueDataCollectionPtr & step4LocalInput)
+                                                             const KeyValueDataCollectionPtr & step4LocalInput,
+                                                             const training::DistributedPartialResultStep4Ptr & previousPartialResult)
 {
     /* Create an algorithm object to perform fourth step of the implicit ALS training algorithm on local-node data */
     training::Distributed<step4Local> algorithm;
-    algorithm.parameter.nFactors = nFactors;
+    algorithm.parameter.nFactors      = nFactors;
+    algorithm.parameter.nCGIterations = nCGIterations;
+
+    /* Update the factors of the previous iteration in place, so that the conjugate gradient iterations start from them */
+    if (previousPartialResult)
+    {
+        algorithm.setPartialResult(previousPartialResult);
+    }
 
     /* Set input objects for the algorithm */
     algorithm.input.set(training::partialModels, step4LocalInput);
@@ -272,7 +281,7 @@ void trainModel()
 
         for (size_t i = 0; i < nBlocks; i++)
         {
-            usersPartialResultLocal[i] = computeStep4Local(transposedDataTable[i], step2MasterResult, step4LocalInput[i]);
+            usersPartialResultLocal[i] = computeStep4Local(transposedDataTable[i], step2MasterResult, step4LocalInput[i], usersPartialResultLocal[i]);
         }
 
         /* Update partial items factors */
@@ -298,7 +307,7 @@ void trainModel()
 
         for (size_t i = 0; i < nBlocks; i++)
         {
-            itemsPartialResultLocal[i] = computeStep4Local(dataTable[i], step2MasterResult, step4LocalInput[i]);
+            itemsPartialResultLocal[i] = computeStep4Local(dataTable[i], step2MasterResult, step4LocalInput[i], itemsPartialResultLocal[i]);
         }
     }
 }
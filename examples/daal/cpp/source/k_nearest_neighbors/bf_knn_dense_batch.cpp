@@ -0,0 +1,148 @@
+/* file: bf_knn_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of brute force k nearest neighbors classification in the batch
+!    processing mode on CPU compared with the KD-tree based classification
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-BF_KNN_DENSE_BATCH"></a>
+ * \example bf_knn_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/k_nearest_neighbors_train.csv";
+string testDatasetFileName  = "../data/batch/k_nearest_neighbors_test.csv";
+
+const size_t nFeatures  = 5; /* Number of features in training and testing data sets */
+const size_t nClasses   = 5; /* Number of classes */
+const size_t nNeighbors = 5; /* Number of neighbors voting for the class */
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+NumericTablePtr predictWithBruteForce(const NumericTablePtr & trainData, const NumericTablePtr & trainLabels, const NumericTablePtr & testData);
+NumericTablePtr predictWithKDTree(const NumericTablePtr & trainData, const NumericTablePtr & trainLabels, const NumericTablePtr & testData);
+size_t countDifferentLabels(const NumericTablePtr & lhs, const NumericTablePtr & rhs);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData, trainLabels, testData, testLabels;
+    loadData(trainDatasetFileName, trainData, trainLabels);
+    loadData(testDatasetFileName, testData, testLabels);
+
+    NumericTablePtr bruteForceLabels = predictWithBruteForce(trainData, trainLabels, testData);
+    NumericTablePtr kdTreeLabels     = predictWithKDTree(trainData, trainLabels, testData);
+
+    printNumericTables<int, int>(testLabels, bruteForceLabels, "Ground truth", "Classification results",
+                                 "Brute force kNN classification results (first 20 observations):", 20);
+
+    /* Both methods search for the exact nearest neighbors, so they give the same labels */
+    const size_t nDifferent = countDifferentLabels(bruteForceLabels, kdTreeLabels);
+    if (nDifferent)
+    {
+        cout << "ERROR: " << nDifferent << " observations are classified differently by the brute force and the KD-tree based kNN" << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+NumericTablePtr predictWithBruteForce(const NumericTablePtr & trainData, const NumericTablePtr & trainLabels, const NumericTablePtr & testData)
+{
+    /* Create an algorithm object to train the brute force kNN model */
+    bf_knn_classification::training::Batch<float> trainAlgorithm;
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainLabels);
+    trainAlgorithm.parameter().nClasses = nClasses;
+    trainAlgorithm.parameter().k        = nNeighbors;
+    trainAlgorithm.compute();
+
+    /* Create an algorithm object to predict the labels with the brute force kNN model */
+    bf_knn_classification::prediction::Batch<float> algorithm;
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, trainAlgorithm.getResult()->get(classifier::training::model));
+    algorithm.parameter().nClasses = nClasses;
+    algorithm.parameter().k        = nNeighbors;
+    algorithm.compute();
+
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+NumericTablePtr predictWithKDTree(const NumericTablePtr & trainData, const NumericTablePtr & trainLabels, const NumericTablePtr & testData)
+{
+    /* Create an algorithm object to train the KD-tree based kNN model */
+    kdtree_knn_classification::training::Batch<float> trainAlgorithm;
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainLabels);
+    trainAlgorithm.parameter.nClasses = nClasses;
+    trainAlgorithm.parameter.k        = nNeighbors;
+    trainAlgorithm.compute();
+
+    /* Create an algorithm object to predict the labels with the KD-tree based kNN model */
+    kdtree_knn_classification::prediction::Batch<float> algorithm;
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, trainAlgorithm.getResult()->get(classifier::training::model));
+    algorithm.parameter.nClasses = nClasses;
+    algorithm.parameter.k        = nNeighbors;
+    algorithm.compute();
+
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+size_t countDifferentLabels(const NumericTablePtr & lhs, const NumericTablePtr & rhs)
+{
+    const size_t nRows = lhs->getNumberOfRows();
+
+    BlockDescriptor<int> lhsBlock, rhsBlock;
+    lhs->getBlockOfRows(0, nRows, readOnly, lhsBlock);
+    rhs->getBlockOfRows(0, nRows, readOnly, rhsBlock);
+
+    size_t nDifferent = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (lhsBlock.getBlockPtr()[i] != rhsBlock.getBlockPtr()[i]) nDifferent++;
+    }
+
+    lhs->releaseBlockOfRows(lhsBlock);
+    rhs->releaseBlockOfRows(rhsBlock);
+    return nDifferent;
+}
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<float>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,119 @@
+/* file: bf_knn_row_predictor.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+!  Content:
+!    C++ example of brute force k nearest neighbors classification of one
+!    observation at a time compared with the batch prediction
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-BF_KNN_ROW_PREDICTOR"></a>
+ * \example bf_knn_row_predictor.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::bf_knn_classification;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/k_nearest_neighbors_train.csv";
+string testDatasetFileName  = "../data/batch/k_nearest_neighbors_test.csv";
+
+const size_t nFeatures  = 5; /* Number of features in training and testing data sets */
+const size_t nClasses   = 5; /* Number of classes */
+const size_t nNeighbors = 5; /* Number of neighbors voting for the class */
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData, trainLabels, testData, testLabels;
+    loadData(trainDatasetFileName, trainData, trainLabels);
+    loadData(testDatasetFileName, testData, testLabels);
+
+    /* The row predictor searches the neighbors in the training data kept in the model */
+    const bf_knn_classification::Parameter parameter(nClasses, nNeighbors, doUse);
+
+    /* Train the brute force kNN model */
+    training::Batch<float> trainAlgorithm;
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainLabels);
+    trainAlgorithm.parameter() = parameter;
+    trainAlgorithm.compute();
+
+    bf_knn_classification::ModelPtr model = trainAlgorithm.getResult()->get(classifier::training::model);
+
+    /* Predict the labels of the whole test data set */
+    prediction::Batch<float> algorithm;
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, model);
+    algorithm.parameter() = parameter;
+    algorithm.compute();
+
+    NumericTablePtr labels = algorithm.getResult()->get(classifier::prediction::prediction);
+    printNumericTables<int, int>(testLabels, labels, "Ground truth", "Classification results",
+                                 "Brute force kNN classification results (first 20 observations):", 20);
+
+    /* Predict the same observations one at a time */
+    prediction::RowPredictor<float> rowPredictor;
+    if (!rowPredictor.prepare(model, parameter) || rowPredictor.getNumberOfFeatures() != nFeatures)
+    {
+        cout << "ERROR: brute force kNN row predictor is not prepared" << endl;
+        return 1;
+    }
+
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<float> xBlock, labelsBlock;
+    testData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    labels->getBlockOfRows(0, nRows, readOnly, labelsBlock);
+
+    bool result = true;
+    for (size_t i = 0; i < nRows && result; ++i)
+    {
+        float rowLabel = 0.0f;
+        rowPredictor.predict(xBlock.getBlockPtr() + i * nFeatures, &rowLabel);
+        result = (rowLabel == labelsBlock.getBlockPtr()[i]);
+        if (!result) cout << "ERROR: brute force kNN classification of the row " << i << " differs from the batch prediction" << endl;
+    }
+
+    testData->releaseBlockOfRows(xBlock);
+    labels->releaseBlockOfRows(labelsBlock);
+    return (result ? 0 : 1);
+}
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<float>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
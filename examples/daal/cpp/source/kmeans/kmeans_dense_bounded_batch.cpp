@@ -0,0 +1,123 @@
+/* file: kmeans_dense_bounded_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense K-Means clustering with the bounded Lloyd method
+!    in the batch processing mode
+!
+!    The program checks that the bounded Lloyd method assigns the observations
+!    to the same clusters as the Lloyd method.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_BOUNDED_BATCH"></a>
+ * \example kmeans_dense_bounded_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 20;
+const size_t nIterations = 5;
+
+template <kmeans::Method method>
+kmeans::ResultPtr computeKMeans(const NumericTablePtr & data, const NumericTablePtr & initialCentroids);
+size_t countDifferentAssignments(const NumericTablePtr & lhs, const NumericTablePtr & rhs);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    NumericTablePtr data = dataSource.getNumericTable();
+
+    /* Get initial clusters for the K-Means algorithm */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, data);
+    init.compute();
+
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    /* Both methods start from the same centroids */
+    kmeans::ResultPtr lloydResult   = computeKMeans<kmeans::lloydDense>(data, centroids);
+    kmeans::ResultPtr boundedResult = computeKMeans<kmeans::boundedLloydDense>(data, centroids);
+
+    /* Print the clusterization results */
+    printNumericTable(boundedResult->get(kmeans::assignments), "First 10 cluster assignments:", 10);
+    printNumericTable(boundedResult->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(boundedResult->get(kmeans::objectiveFunction), "Objective function value:");
+    printNumericTable(lloydResult->get(kmeans::objectiveFunction), "Objective function value of the Lloyd method:");
+
+    const size_t nDifferent = countDifferentAssignments(lloydResult->get(kmeans::assignments), boundedResult->get(kmeans::assignments));
+    if (nDifferent)
+    {
+        cout << "ERROR: " << nDifferent << " observations are assigned to different clusters by the bounded Lloyd and the Lloyd methods" << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+template <kmeans::Method method>
+kmeans::ResultPtr computeKMeans(const NumericTablePtr & data, const NumericTablePtr & initialCentroids)
+{
+    /* Create an algorithm object for the K-Means algorithm */
+    kmeans::Batch<float, method> algorithm(nClusters, nIterations);
+
+    algorithm.input.set(kmeans::data, data);
+    algorithm.input.set(kmeans::inputCentroids, initialCentroids);
+
+    algorithm.parameter().resultsToEvaluate = kmeans::computeCentroids | kmeans::computeAssignments | kmeans::computeExactObjectiveFunction;
+
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+size_t countDifferentAssignments(const NumericTablePtr & lhs, const NumericTablePtr & rhs)
+{
+    const size_t nRows = lhs->getNumberOfRows();
+
+    BlockDescriptor<int> lhsBlock, rhsBlock;
+    lhs->getBlockOfRows(0, nRows, readOnly, lhsBlock);
+    rhs->getBlockOfRows(0, nRows, readOnly, rhsBlock);
+
+    size_t nDifferent = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (lhsBlock.getBlockPtr()[i] != rhsBlock.getBlockPtr()[i]) nDifferent++;
+    }
+
+    lhs->releaseBlockOfRows(lhsBlock);
+    rhs->releaseBlockOfRows(rhsBlock);
+    return nDifferent;
+}
@@ -18,6 +18,7 @@
 /*
 !  Content:
 !    C++ example of dense K-Means clustering in the distributed processing mode
+!    with the bounded Lloyd method
 !******************************************************************************/
 
 /**
@@ -48,7 +49,11 @@ int main(int argc, char * argv[])
 {
     checkArguments(argc, argv, 4, &dataFileNames[0], &dataFileNames[1], &dataFileNames[2], &dataFileNames[3]);
 
-    kmeans::Distributed<step2Master> masterAlgorithm(nClusters);
+    kmeans::Distributed<step2Master, algorithmFPType, kmeans::boundedLloydDense> masterAlgorithm(nClusters);
+
+    /* The local algorithm objects are kept between iterations: their partial results hold the distance bounds
+       that let the bounded Lloyd method skip observations whose nearest centroid can not change */
+    services::SharedPtr<kmeans::Distributed<step1Local, algorithmFPType, kmeans::boundedLloydDense> > localAlgorithms[nBlocks];
 
     NumericTablePtr data[nBlocks];
 
@@ -74,6 +79,12 @@ int main(int argc, char * argv[])
         localInit.compute();
 
         masterInit.input.add(kmeans::init::partialResults, localInit.getPartialResult());
+
+        /* Create an algorithm object for the K-Means algorithm */
+        localAlgorithms[i].reset(new kmeans::Distributed<step1Local, algorithmFPType, kmeans::boundedLloydDense>(nClusters, false));
+
+        /* Set the input data to the algorithm */
+        localAlgorithms[i]->input.set(kmeans::data, data[i]);
     }
     masterInit.compute();
     masterInit.finalizeCompute();
@@ -84,16 +95,12 @@ int main(int argc, char * argv[])
     {
         for (size_t i = 0; i < nBlocks; i++)
         {
-            /* Create an algorithm object for the K-Means algorithm */
-            kmeans::Distributed<step1Local> localAlgorithm(nClusters, false);
-
-            /* Set the input data to the algorithm */
-            localAlgorithm.input.set(kmeans::data, data[i]);
-            localAlgorithm.input.set(kmeans::inputCentroids, centroids);
+            /* Set the centroids of the current iteration */
+            localAlgorithms[i]->input.set(kmeans::inputCentroids, centroids);
 
-            localAlgorithm.compute();
+            localAlgorithms[i]->compute();
 
-            masterAlgorithm.input.add(kmeans::partialResults, localAlgorithm.getPartialResult());
+            masterAlgorithm.input.add(kmeans::partialResults, localAlgorithms[i]->getPartialResult());
         }
 
         masterAlgorithm.compute();
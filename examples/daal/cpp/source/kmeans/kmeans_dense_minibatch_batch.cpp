@@ -0,0 +1,113 @@
+/* file: kmeans_dense_minibatch_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense mini-batch K-Means clustering in the batch processing mode
+!    compared with the Lloyd method started from the same initial centroids
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_MINIBATCH_BATCH"></a>
+ * \example kmeans_dense_minibatch_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+/* K-Means algorithm parameters */
+const size_t nClusters        = 20;
+const size_t nLloydIterations = 5;
+const size_t nBatchIterations = 50;
+const size_t batchSize        = 1024;
+
+/* Largest allowed ratio of the mini-batch objective function to the Lloyd one */
+const float objectiveTolerance = 1.1f;
+
+float getObjectiveFunction(const kmeans::ResultPtr & result)
+{
+    BlockDescriptor<float> block;
+    NumericTablePtr objectiveFunction = result->get(kmeans::objectiveFunction);
+    objectiveFunction->getBlockOfRows(0, 1, readOnly, block);
+    const float value = block.getBlockPtr()[0];
+    objectiveFunction->releaseBlockOfRows(block);
+    return value;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Get initial clusters for the K-Means algorithm */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, dataSource.getNumericTable());
+    init.compute();
+
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    /* Create an algorithm object for the mini-batch K-Means algorithm */
+    kmeans::Batch<float, kmeans::miniBatchDense> algorithm(nClusters, nBatchIterations);
+
+    algorithm.input.set(kmeans::data, dataSource.getNumericTable());
+    algorithm.input.set(kmeans::inputCentroids, centroids);
+
+    algorithm.parameter().batchSize         = batchSize;
+    algorithm.parameter().engine            = engines::mt2203::Batch<>::create(777);
+    algorithm.parameter().resultsToEvaluate = kmeans::computeCentroids | kmeans::computeAssignments | kmeans::computeExactObjectiveFunction;
+
+    algorithm.compute();
+
+    /* Create an algorithm object for the Lloyd K-Means algorithm started from the same centroids */
+    kmeans::Batch<float, kmeans::lloydDense> lloyd(nClusters, nLloydIterations);
+
+    lloyd.input.set(kmeans::data, dataSource.getNumericTable());
+    lloyd.input.set(kmeans::inputCentroids, centroids);
+
+    lloyd.compute();
+
+    /* Print the clusterization results */
+    printNumericTable(algorithm.getResult()->get(kmeans::assignments), "First 10 cluster assignments:", 10);
+    printNumericTable(algorithm.getResult()->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(algorithm.getResult()->get(kmeans::objectiveFunction), "Objective function value:");
+    printNumericTable(lloyd.getResult()->get(kmeans::objectiveFunction), "Objective function value of the Lloyd method:");
+
+    const float miniBatchObjective = getObjectiveFunction(algorithm.getResult());
+    const float lloydObjective     = getObjectiveFunction(lloyd.getResult());
+
+    if (!(miniBatchObjective <= objectiveTolerance * lloydObjective))
+    {
+        cout << "ERROR: objective function of the mini-batch method is too far from the Lloyd one" << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/* file: lin_reg_norm_eq_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multiple linear regression in the batch processing mode
+!    on the data in the compressed sparse rows (CSR) format.
+!
+!    The program trains the multiple linear regression model with the normal
+!    equations method on the same sparse data set stored in the dense and
+!    in the CSR numeric tables and compares the regression coefficients.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LINEAR_REGRESSION_NORM_EQ_CSR_BATCH"></a>
+ * \example lin_reg_norm_eq_csr_batch.cpp
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::linear_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training data set */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+/* Largest absolute difference of the regression coefficients allowed in this example */
+const double tolerance = 1e-3;
+
+void loadSparseData(NumericTablePtr & denseData, CSRNumericTablePtr & csrData, NumericTablePtr & dependentVariables);
+NumericTablePtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariables);
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    NumericTablePtr denseData, dependentVariables;
+    CSRNumericTablePtr csrData;
+    loadSparseData(denseData, csrData, dependentVariables);
+
+    NumericTablePtr denseBeta = trainModel(denseData, dependentVariables);
+    NumericTablePtr csrBeta   = trainModel(csrData, dependentVariables);
+
+    printNumericTable(csrBeta, "Linear Regression coefficients (CSR data):");
+
+    const double difference = maxAbsDifference(denseBeta, csrBeta);
+    cout << "Maximal difference of the coefficients trained on the dense and the CSR data: " << difference << endl;
+
+    if (!(difference <= tolerance))
+    {
+        cout << "ERROR: the models trained on the dense and the CSR data have different coefficients" << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+void loadSparseData(NumericTablePtr & denseData, CSRNumericTablePtr & csrData, NumericTablePtr & dependentVariables)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    denseData                  = HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate);
+    dependentVariables         = HomogenNumericTable<>::create(nDependentVariables, 0, NumericTable::doNotAllocate);
+    NumericTablePtr mergedData = MergedNumericTable::create(denseData, dependentVariables);
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    const size_t nRows = denseData->getNumberOfRows();
+
+    /* Zero out a part of the features so that the rows have different numbers of non-zero values
+       and store the non-zero values in the CSR numeric table with one-based indexing */
+    BlockDescriptor<float> block;
+    denseData->getBlockOfRows(0, nRows, readWrite, block);
+    float * x = block.getBlockPtr();
+
+    std::vector<float> values;
+    std::vector<size_t> colIndices;
+    std::vector<size_t> rowOffsets(1, 1);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if ((i + j) % 3 == 0) x[i * nFeatures + j] = 0.0f;
+            if (x[i * nFeatures + j] == 0.0f) continue;
+
+            values.push_back(x[i * nFeatures + j]);
+            colIndices.push_back(j + 1);
+        }
+        rowOffsets.push_back(values.size() + 1);
+    }
+    denseData->releaseBlockOfRows(block);
+
+    csrData = CSRNumericTable::create<float>(NULL, NULL, NULL, nFeatures, nRows);
+    checkPtr(csrData.get());
+    csrData->allocateDataMemory(values.size());
+
+    float * csrValues     = NULL;
+    size_t * csrColumns   = NULL;
+    size_t * csrRowOffset = NULL;
+    csrData->getArrays<float>(&csrValues, &csrColumns, &csrRowOffset);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        csrValues[i]  = values[i];
+        csrColumns[i] = colIndices[i];
+    }
+    for (size_t i = 0; i < rowOffsets.size(); i++)
+    {
+        csrRowOffset[i] = rowOffsets[i];
+    }
+}
+
+NumericTablePtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariables)
+{
+    /* Create an algorithm object to train the multiple linear regression model with the normal equations method */
+    training::Batch<> algorithm;
+
+    /* The normal equations method accepts the training data set both in the dense and in the CSR numeric tables */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariables, dependentVariables);
+
+    /* Build the multiple linear regression model */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(training::model)->getBeta();
+}
+
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs)
+{
+    const size_t nRows = lhs->getNumberOfRows();
+    const size_t nCols = lhs->getNumberOfColumns();
+
+    BlockDescriptor<float> lhsBlock, rhsBlock;
+    lhs->getBlockOfRows(0, nRows, readOnly, lhsBlock);
+    rhs->getBlockOfRows(0, nRows, readOnly, rhsBlock);
+
+    double difference = 0.0;
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        const double d = fabs(lhsBlock.getBlockPtr()[i] - rhsBlock.getBlockPtr()[i]);
+        if (d > difference) difference = d;
+    }
+
+    lhs->releaseBlockOfRows(lhsBlock);
+    rhs->releaseBlockOfRows(rhsBlock);
+    return difference;
+}
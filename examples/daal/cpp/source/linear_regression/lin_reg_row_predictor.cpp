@@ -0,0 +1,115 @@
+/* file: lin_reg_row_predictor.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multiple linear regression prediction of one observation
+!    at a time compared with the batch prediction
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LIN_REG_ROW_PREDICTOR"></a>
+ * \example lin_reg_row_predictor.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::linear_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+string testDatasetFileName  = "../data/batch/linear_regression_test.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+/* Largest allowed relative difference between the responses predicted one row at a time and in the batch */
+const float tolerance = 1e-5f;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from .csv files */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    NumericTablePtr trainData(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(new HomogenNumericTable<float>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr testData(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr testGroundTruth(new HomogenNumericTable<float>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedTrainData(new MergedNumericTable(trainData, trainDependentVariables));
+    NumericTablePtr mergedTestData(new MergedNumericTable(testData, testGroundTruth));
+
+    /* Retrieve the data from input files */
+    trainDataSource.loadDataBlock(mergedTrainData.get());
+    testDataSource.loadDataBlock(mergedTestData.get());
+
+    /* Train the multiple linear regression model with the normal equations method */
+    training::Batch<float> trainAlgorithm;
+    trainAlgorithm.input.set(training::data, trainData);
+    trainAlgorithm.input.set(training::dependentVariables, trainDependentVariables);
+    trainAlgorithm.compute();
+
+    ModelPtr model = trainAlgorithm.getResult()->get(training::model);
+
+    /* Predict the responses of the whole test data set */
+    prediction::Batch<float> algorithm;
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, model);
+    algorithm.compute();
+
+    NumericTablePtr responses = algorithm.getResult()->get(prediction::prediction);
+    printNumericTable(responses, "Linear Regression prediction results: (first 10 rows):", 10);
+
+    /* Predict the same observations one at a time */
+    prediction::RowPredictor<float> rowPredictor;
+    if (!rowPredictor.prepare(model) || rowPredictor.getNumberOfResponses() != nDependentVariables)
+    {
+        cout << "ERROR: linear regression row predictor is not prepared" << endl;
+        return 1;
+    }
+
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<float> xBlock, responsesBlock;
+    testData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    responses->getBlockOfRows(0, nRows, readOnly, responsesBlock);
+
+    bool result = true;
+    vector<float> rowResponses(nDependentVariables);
+    for (size_t i = 0; i < nRows && result; ++i)
+    {
+        rowPredictor.predict(xBlock.getBlockPtr() + i * nFeatures, rowResponses.data());
+        for (size_t j = 0; j < nDependentVariables && result; ++j)
+        {
+            const float expected = responsesBlock.getBlockPtr()[i * nDependentVariables + j];
+            result               = (fabs(rowResponses[j] - expected) <= tolerance * (1.0f + fabs(expected)));
+        }
+        if (!result) cout << "ERROR: linear regression of the row " << i << " differs from the batch prediction" << endl;
+    }
+
+    testData->releaseBlockOfRows(xBlock);
+    responses->releaseBlockOfRows(responsesBlock);
+    return (result ? 0 : 1);
+}
@@ -0,0 +1,127 @@
+/* file: log_reg_row_predictor.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of logistic regression prediction of one observation
+!    at a time compared with the batch prediction
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOG_REG_ROW_PREDICTOR"></a>
+ * \example log_reg_row_predictor.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::logistic_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/logreg_train.csv";
+string testDatasetFileName  = "../data/batch/logreg_test.csv";
+
+const size_t nFeatures = 6; /* Number of features in training and testing data sets */
+const size_t nClasses  = 5; /* Number of classes */
+
+/* Largest allowed difference between the probabilities predicted one row at a time and in the batch */
+const float tolerance = 1e-5f;
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData, trainLabels, testData, testLabels;
+    loadData(trainDatasetFileName, trainData, trainLabels);
+    loadData(testDatasetFileName, testData, testLabels);
+
+    /* Train the logistic regression model */
+    training::Batch<float> trainAlgorithm(nClasses);
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainLabels);
+    trainAlgorithm.parameter().penaltyL1 = 0.1f;
+    trainAlgorithm.parameter().penaltyL2 = 0.1f;
+    trainAlgorithm.compute();
+
+    logistic_regression::ModelPtr model = trainAlgorithm.getResult()->get(classifier::training::model);
+
+    /* Predict the labels and the probabilities of the classes of the whole test data set */
+    prediction::Batch<float> algorithm(nClasses);
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, model);
+    algorithm.parameter().resultsToEvaluate |= static_cast<DAAL_UINT64>(classifier::computeClassProbabilities);
+    algorithm.compute();
+
+    NumericTablePtr labels        = algorithm.getResult()->get(classifier::prediction::prediction);
+    NumericTablePtr probabilities = algorithm.getResult()->get(classifier::prediction::probabilities);
+    printNumericTable(labels, "Logistic regression prediction results (first 10 rows):", 10);
+
+    /* Predict the same observations one at a time */
+    prediction::RowPredictor<float> rowPredictor;
+    if (!rowPredictor.prepare(model, algorithm.parameter()) || rowPredictor.getNumberOfFeatures() != nFeatures)
+    {
+        cout << "ERROR: logistic regression row predictor is not prepared" << endl;
+        return 1;
+    }
+
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<float> xBlock, labelsBlock, probabilitiesBlock;
+    testData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    labels->getBlockOfRows(0, nRows, readOnly, labelsBlock);
+    probabilities->getBlockOfRows(0, nRows, readOnly, probabilitiesBlock);
+
+    bool result = true;
+    vector<float> rowProbabilities(nClasses);
+    for (size_t i = 0; i < nRows && result; ++i)
+    {
+        float rowLabel = 0.0f;
+        rowPredictor.predict(xBlock.getBlockPtr() + i * nFeatures, &rowLabel, rowProbabilities.data());
+        result = (rowLabel == labelsBlock.getBlockPtr()[i]);
+        for (size_t j = 0; j < nClasses && result; ++j)
+        {
+            result = (fabs(rowProbabilities[j] - probabilitiesBlock.getBlockPtr()[i * nClasses + j]) <= tolerance);
+        }
+        if (!result) cout << "ERROR: logistic regression of the row " << i << " differs from the batch prediction" << endl;
+    }
+
+    testData->releaseBlockOfRows(xBlock);
+    labels->releaseBlockOfRows(labelsBlock);
+    probabilities->releaseBlockOfRows(probabilitiesBlock);
+    return (result ? 0 : 1);
+}
+
+void loadData(const string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<float>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,121 @@
+/* file: quantiles_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing approximate quantiles with the sketch method in
+!    the distributed processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QUANTILES_DENSE_DISTRIBUTED"></a>
+ * \example quantiles_dense_distr.cpp
+ */
+
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName     = "../data/batch/quantiles.csv";
+const size_t nBlocks       = 4;
+const size_t nObservations = 250;
+
+/* Number of values kept on the top level of the sketch of a feature */
+const size_t sketchSize = 64;
+
+/* Partial results serialized on the local nodes and sent to the master node */
+vector<daal::byte> serializedPartialResults[nBlocks];
+quantiles::ResultPtr result;
+
+void computestep1Local(FileDataSource<CSVFeatureManager> & dataSource, size_t block);
+void computeOnMasterNode();
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(dataSource, i);
+    }
+
+    computeOnMasterNode();
+
+    printNumericTable(result->get(quantiles::quantiles), "Quantiles:");
+
+    return 0;
+}
+
+void computestep1Local(FileDataSource<CSVFeatureManager> & dataSource, size_t block)
+{
+    /* Retrieve the part of the data set processed on the local node */
+    dataSource.loadDataBlock(nObservations);
+
+    /* Create an algorithm to build the sketches of the features on the local node */
+    quantiles::Distributed<step1Local, float, quantiles::sketchDense> algorithm;
+    algorithm.parameter.sketchSize = sketchSize;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(quantiles::data, dataSource.getNumericTable());
+
+    /* Compute the sketches on the local node */
+    algorithm.compute();
+
+    /* Serialize the sketches to send them to the master node */
+    InputDataArchive dataArch;
+    algorithm.getPartialResult()->serialize(dataArch);
+
+    serializedPartialResults[block].resize(dataArch.getSizeOfArchive());
+    dataArch.copyArchiveToArray(&serializedPartialResults[block][0], dataArch.getSizeOfArchive());
+}
+
+void computeOnMasterNode()
+{
+    /* Create an algorithm to merge the sketches on the master node */
+    quantiles::Distributed<step2Master, float, quantiles::sketchDense> algorithm;
+    algorithm.parameter.sketchSize = sketchSize;
+
+    /* Set input objects for the algorithm */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        /* Deserialize the sketches computed on the local node */
+        OutputDataArchive dataArch(&serializedPartialResults[i][0], serializedPartialResults[i].size());
+        quantiles::PartialResultPtr partialResult(new quantiles::PartialResult());
+        partialResult->deserialize(dataArch);
+
+        algorithm.input.add(quantiles::partialResults, partialResult);
+    }
+
+    /* Merge the sketches of the local nodes */
+    algorithm.compute();
+
+    /* Finalize the result in the distributed processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed quantiles of the default order 0.5 */
+    result = algorithm.getResult();
+}
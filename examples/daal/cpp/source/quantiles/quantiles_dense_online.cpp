@@ -0,0 +1,132 @@
+/* file: quantiles_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing approximate quantiles with the sketch method in
+!    the online processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QUANTILES_DENSE_ONLINE"></a>
+ * \example quantiles_dense_online.cpp
+ */
+
+#include <algorithm>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName     = "../data/batch/quantiles.csv";
+const size_t nObservations = 100;
+
+/* Number of values kept on the top level of the sketch of a feature */
+const size_t sketchSize = 64;
+
+/* Quantile orders */
+const size_t nOrders         = 5;
+const double orders[nOrders] = { 0.1, 0.25, 0.5, 0.75, 0.9 };
+
+/* Largest rank error of the computed quantiles allowed in this example, as a fraction of the number of observations */
+const double rankTolerance = 0.05;
+
+bool checkRanks(const NumericTablePtr & quantilesTable);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create a numeric table with the quantile orders */
+    NumericTablePtr quantileOrders = HomogenNumericTable<double>::create(nOrders, 1, NumericTable::doAllocate);
+    BlockDescriptor<double> block;
+    quantileOrders->getBlockOfRows(0, 1, writeOnly, block);
+    copy(orders, orders + nOrders, block.getBlockPtr());
+    quantileOrders->releaseBlockOfRows(block);
+
+    /* Create an algorithm to compute quantiles in the online processing mode using the sketch method */
+    quantiles::Online<float, quantiles::sketchDense> algorithm;
+    algorithm.parameter.quantileOrders = quantileOrders;
+    algorithm.parameter.sketchSize     = sketchSize;
+
+    while (dataSource.loadDataBlock(nObservations) == nObservations)
+    {
+        /* Set input objects for the algorithm */
+        algorithm.input.set(quantiles::data, dataSource.getNumericTable());
+
+        /* Merge the block into the sketches of the features */
+        algorithm.compute();
+    }
+
+    /* The sketches hold a bounded number of values whatever the number of the processed blocks is */
+    quantiles::PartialResultPtr partialResult = algorithm.getPartialResult();
+    cout << "Size of the sketch values table: " << partialResult->get(quantiles::sketchValues)->getNumberOfRows() << " x "
+         << partialResult->get(quantiles::sketchValues)->getNumberOfColumns() << endl;
+
+    /* Finalize the result in the online processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed quantiles */
+    quantiles::ResultPtr res = algorithm.getResult();
+    printNumericTable(res->get(quantiles::quantiles), "Quantiles:");
+
+    return checkRanks(res->get(quantiles::quantiles)) ? 0 : 1;
+}
+
+/* Checks that the rank of every computed quantile in the sorted values of its feature is close to the quantile order */
+bool checkRanks(const NumericTablePtr & quantilesTable)
+{
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+    dataSource.loadDataBlock();
+    NumericTablePtr data = dataSource.getNumericTable();
+
+    const size_t nRows     = data->getNumberOfRows();
+    const size_t nFeatures = data->getNumberOfColumns();
+
+    BlockDescriptor<float> dataBlock, quantilesBlock;
+    data->getBlockOfRows(0, nRows, readOnly, dataBlock);
+    quantilesTable->getBlockOfRows(0, nFeatures, readOnly, quantilesBlock);
+
+    bool result = true;
+    vector<float> values(nRows);
+    for (size_t j = 0; j < nFeatures && result; j++)
+    {
+        for (size_t i = 0; i < nRows; i++) values[i] = dataBlock.getBlockPtr()[i * nFeatures + j];
+        sort(values.begin(), values.end());
+
+        for (size_t k = 0; k < nOrders && result; k++)
+        {
+            const float quantile = quantilesBlock.getBlockPtr()[j * nOrders + k];
+            const double rankLow = (double)(lower_bound(values.begin(), values.end(), quantile) - values.begin()) / nRows;
+            const double rankUp  = (double)(upper_bound(values.begin(), values.end(), quantile) - values.begin()) / nRows;
+            result               = (rankLow <= orders[k] + rankTolerance) && (rankUp >= orders[k] - rankTolerance);
+        }
+        if (!result) cout << "ERROR: the rank of a quantile of the feature " << j << " is too far from its order" << endl;
+    }
+
+    data->releaseBlockOfRows(dataBlock);
+    quantilesTable->releaseBlockOfRows(quantilesBlock);
+    return result;
+}
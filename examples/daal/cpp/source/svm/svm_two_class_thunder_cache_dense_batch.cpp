@@ -0,0 +1,153 @@
+/* file: svm_two_class_thunder_cache_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of two-class support vector machine (SVM) classification using
+!    the Thunder method with and without the cache of the kernel matrix rows
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SVM_TWO_CLASS_THUNDER_CACHE_DENSE_BATCH"></a>
+ * \example svm_two_class_thunder_cache_dense_batch.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/svm_two_class_train_dense.csv";
+string testDatasetFileName  = "../data/batch/svm_two_class_test_dense.csv";
+
+const size_t nFeatures = 20;
+
+/* Size of the cache in bytes. It holds 1500 of 2000 kernel matrix rows of the training data set, which is more than
+   the 1024 rows of the working set, so the least recently used rows are evicted during the training */
+const size_t cacheSize = 1500 * 2000 * sizeof(float);
+
+/* Largest absolute difference of the decision function values allowed in this example */
+const double tolerance = 1e-2;
+
+/* Parameters for the SVM kernel function */
+kernel_function::KernelIfacePtr kernel(new kernel_function::rbf::Batch<>());
+
+NumericTablePtr trainData;
+NumericTablePtr trainGroundTruth;
+NumericTablePtr testData;
+NumericTablePtr testGroundTruth;
+
+void loadData(const string & fileName, NumericTablePtr & data, NumericTablePtr & groundTruth);
+NumericTablePtr trainAndTestModel(size_t cacheSizeInBytes);
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    loadData(trainDatasetFileName, trainData, trainGroundTruth);
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* The kernel matrix rows are computed on every request when the cache size is zero */
+    NumericTablePtr noCacheResults = trainAndTestModel(0);
+    NumericTablePtr cacheResults   = trainAndTestModel(cacheSize);
+
+    printNumericTables<int, float>(testGroundTruth, cacheResults, "Ground truth\t", "Classification results",
+                                   "SVM classification results (first 20 observations):", 20);
+
+    const double difference = maxAbsDifference(noCacheResults, cacheResults);
+    cout << "Maximal difference of the decision function values with and without the cache: " << difference << endl;
+
+    if (!(difference <= tolerance))
+    {
+        cout << "ERROR: the models trained with and without the cache give different results" << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+void loadData(const string & fileName, NumericTablePtr & data, NumericTablePtr & groundTruth)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and labels */
+    data                       = HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate);
+    groundTruth                = HomogenNumericTable<>::create(1, 0, NumericTable::doNotAllocate);
+    NumericTablePtr mergedData = MergedNumericTable::create(data, groundTruth);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
+
+NumericTablePtr trainAndTestModel(size_t cacheSizeInBytes)
+{
+    /* Create an algorithm object to train the SVM model using the Thunder method */
+    svm::training::Batch<float, svm::training::thunder> trainAlgorithm;
+
+    trainAlgorithm.parameter.kernel    = kernel;
+    trainAlgorithm.parameter.cacheSize = cacheSizeInBytes;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    trainAlgorithm.input.set(classifier::training::data, trainData);
+    trainAlgorithm.input.set(classifier::training::labels, trainGroundTruth);
+
+    /* Build the SVM model */
+    trainAlgorithm.compute();
+
+    /* Create an algorithm object to predict SVM values */
+    svm::prediction::Batch<> predictAlgorithm;
+
+    predictAlgorithm.parameter.kernel = kernel;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    predictAlgorithm.input.set(classifier::prediction::data, testData);
+    predictAlgorithm.input.set(classifier::prediction::model, trainAlgorithm.getResult()->get(classifier::training::model));
+
+    /* Predict SVM values */
+    predictAlgorithm.compute();
+
+    return predictAlgorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+double maxAbsDifference(const NumericTablePtr & lhs, const NumericTablePtr & rhs)
+{
+    const size_t nRows = lhs->getNumberOfRows();
+
+    BlockDescriptor<float> lhsBlock, rhsBlock;
+    lhs->getBlockOfRows(0, nRows, readOnly, lhsBlock);
+    rhs->getBlockOfRows(0, nRows, readOnly, rhsBlock);
+
+    double difference = 0.0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const double d = fabs(lhsBlock.getBlockPtr()[i] - rhsBlock.getBlockPtr()[i]);
+        if (d > difference) difference = d;
+    }
+
+    lhs->releaseBlockOfRows(lhsBlock);
+    rhs->releaseBlockOfRows(rhsBlock);
+    return difference;
+}
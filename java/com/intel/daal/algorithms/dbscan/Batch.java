@@ -95,7 +95,7 @@ public class Batch extends AnalysisBatch {
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != Method.defaultDense) {
+        if (this.method != Method.defaultDense && this.method != Method.kdTreeDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -79,7 +79,7 @@ public class DistributedStep6Local extends AnalysisDistributed {
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != Method.defaultDense) {
+        if (this.method != Method.defaultDense && this.method != Method.kdTreeDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -27,32 +27,32 @@ using namespace daal::algorithms::dbscan;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_Batch_cInit(JNIEnv *, jobject, jint prec, jint method, jdouble epsilon,
                                                                           jlong minObservations)
 {
-    return jniBatch<dbscan::Method, Batch, defaultDense>::newObj(prec, method, epsilon, minObservations);
+    return jniBatch<dbscan::Method, Batch, defaultDense, kdTreeDense>::newObj(prec, method, epsilon, minObservations);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_Batch_cInitParameter(JNIEnv * env, jobject thisObj, jlong algAddr, jint prec,
                                                                                    jint method)
 {
-    return jniBatch<dbscan::Method, Batch, defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<dbscan::Method, Batch, defaultDense, kdTreeDense>::getParameter(prec, method, algAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_Batch_cGetInput(JNIEnv * env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<dbscan::Method, Batch, defaultDense>::getInput(prec, method, algAddr);
+    return jniBatch<dbscan::Method, Batch, defaultDense, kdTreeDense>::getInput(prec, method, algAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_Batch_cGetResult(JNIEnv * env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<dbscan::Method, Batch, defaultDense>::getResult(prec, method, algAddr);
+    return jniBatch<dbscan::Method, Batch, defaultDense, kdTreeDense>::getResult(prec, method, algAddr);
 }
 
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_dbscan_Batch_cSetResult(JNIEnv *, jobject, jlong algAddr, jint prec, jint method,
                                                                               jlong resultAddr)
 {
-    jniBatch<dbscan::Method, Batch, defaultDense>::setResult<dbscan::Result>(prec, method, algAddr, resultAddr);
+    jniBatch<dbscan::Method, Batch, defaultDense, kdTreeDense>::setResult<dbscan::Result>(prec, method, algAddr, resultAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_Batch_cClone(JNIEnv * env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<dbscan::Method, Batch, defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<dbscan::Method, Batch, defaultDense, kdTreeDense>::getClone(prec, method, algAddr);
 }
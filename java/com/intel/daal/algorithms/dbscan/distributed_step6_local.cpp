@@ -27,36 +27,37 @@ using namespace daal::algorithms::dbscan;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_DistributedStep6Local_cInit(JNIEnv *, jobject, jint prec, jint method, jlong blockIndex,
                                                                                           jlong nBlocks, jdouble epsilon, jlong minObservations)
 {
-    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense>::newObj(prec, method, blockIndex, nBlocks, epsilon, minObservations);
+    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense, kdTreeDense>::newObj(prec, method, blockIndex, nBlocks, epsilon,
+                                                                                                     minObservations);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_DistributedStep6Local_cInitParameter(JNIEnv * env, jobject thisObj, jlong algAddr,
                                                                                                    jint prec, jint method)
 {
-    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense>::getBaseParameter(prec, method, algAddr);
+    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense, kdTreeDense>::getBaseParameter(prec, method, algAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_DistributedStep6Local_cGetInput(JNIEnv * env, jobject thisObj, jlong algAddr, jint prec,
                                                                                               jint method)
 {
-    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense>::getInput(prec, method, algAddr);
+    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense, kdTreeDense>::getInput(prec, method, algAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_DistributedStep6Local_cGetPartialResult(JNIEnv * env, jobject thisObj, jlong algAddr,
                                                                                                       jint prec, jint method)
 {
-    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense>::getPartialResult(prec, method, algAddr);
+    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense, kdTreeDense>::getPartialResult(prec, method, algAddr);
 }
 
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_dbscan_DistributedStep6Local_cSetPartialResult(JNIEnv *, jobject, jlong algAddr, jint prec,
                                                                                                      jint method, jlong partialResultAddr)
 {
-    jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense>::setPartialResult<dbscan::DistributedPartialResultStep6>(
+    jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense, kdTreeDense>::setPartialResult<dbscan::DistributedPartialResultStep6>(
         prec, method, algAddr, partialResultAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_dbscan_DistributedStep6Local_cClone(JNIEnv * env, jobject thisObj, jlong algAddr, jint prec,
                                                                                            jint method)
 {
-    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense>::getClone(prec, method, algAddr);
+    return jniDistributed<step6Local, dbscan::Method, Distributed, defaultDense, kdTreeDense>::getClone(prec, method, algAddr);
 }